@@ -23,15 +23,27 @@
 //   3.) Matrix determinant via LU factorization:
 //       T d = hd::ga::det(A);
 //
+//   4.) Tree-sparse SPD systems (joint-space mass matrix of a kinematic tree):
+//       hd::ga::ltdl_decomp(H, lambda);      // H = L^T D L in place, no pivoting
+//       hd::ga::ltdl_backsubs(H, lambda, b); // or: x = hd::ga::ltdl_solve(H, lambda, b)
+//
+//   5.) Bordered KKT systems with a tree-sparse M and block-sparse G (closed loops):
+//       hd::ga::kkt_schur_analyze(ws, lambda, block_rows, block_cols); // once
+//       x = hd::ga::kkt_schur_solve(ws, M, G, f, g, &l);               // per solve
+//
 // Adapted from the hd utility library and made internal to the ga library
 // so the physics ops carry no external dependency.
 /////////////////////////////////////////////////////////////////////////////////////////
 
-#include <cmath>     // std::abs
-#include <mdspan>    // std::mdspan, std::dextents, std::extents
-#include <stdexcept> // std::runtime_error, std::invalid_argument
-#include <string>    // std::string
-#include <vector>    // std::vector (scratch storage in det / lu_decomp)
+#include <algorithm>   // std::copy, std::fill, std::max, std::min
+#include <array>       // std::array (fixed-size det scratch)
+#include <cmath>       // std::abs
+#include <mdspan>      // std::mdspan, std::dextents, std::extents
+#include <stdexcept>   // std::runtime_error, std::invalid_argument
+#include <string>      // std::string
+#include <type_traits> // std::is_same_v, std::remove_const_t (fixed-size overloads)
+#include <utility>     // std::pair (kkt_schur_workspace)
+#include <vector>      // std::vector (scratch storage in det / lu_decomp)
 
 namespace hd::ga {
 
@@ -39,8 +51,8 @@ namespace hd::ga {
 // Solver_error: thrown by lu_decomp on a singular or malformed input.
 //
 // Caught locally in det() (singular matrix → returns 0). Higher-level
-// physics callers (e.g. get_inertia_inverse) detect singularity by
-// checking the determinant first and never let this exception escape.
+// physics callers (e.g. get_inertia_inverse) translate it into their own
+// std::invalid_argument and never let this exception escape.
 /////////////////////////////////////////////////////////////////////////////////////////
 struct Solver_error : std::runtime_error {
     explicit Solver_error(char const* msg) : std::runtime_error(msg) {}
@@ -54,20 +66,24 @@ struct Solver_error : std::runtime_error {
 //   a    - n×n matrix; on exit, contains L (below diag, unit diagonal implicit)
 //          and U (on/above diag) packed in place.
 //   perm - length-n permutation vector recording row swaps.
+//   vv   - length-n scratch for the per-row scaling factors (implicit pivoting). The
+//          overload without it allocates this scratch; pass a reused buffer when
+//          factorizing repeatedly on a hot path (e.g. sdirk3_integrator).
 /////////////////////////////////////////////////////////////////////////////////////////
 inline void lu_decomp(std::mdspan<double, std::dextents<size_t, 2>> a,
-                      std::mdspan<int, std::dextents<size_t, 1>> perm)
+                      std::mdspan<int, std::dextents<size_t, 1>> perm,
+                      std::mdspan<double, std::dextents<size_t, 1>> vv)
 {
-    if (a.extent(0) != a.extent(1) || a.extent(0) != perm.extent(0)) {
+    if (a.extent(0) != a.extent(1) || a.extent(0) != perm.extent(0) ||
+        a.extent(0) != vv.extent(0)) {
         throw Solver_error("hd::ga::lu_decomp: matrix is non-square or "
-                           "permutation-vector size incompatible.");
+                           "permutation-vector / scratch size incompatible.");
     }
 
     constexpr double TINY = 1.e-20;
     int const ubound = static_cast<int>(a.extent(0)) - 1;
 
     // Per-row scaling factors (for implicit pivoting).
-    std::vector<double> vv(a.extent(0));
     for (int i = 0; i <= ubound; ++i) {
         double aamax = 0.0;
         for (int j = 0; j <= ubound; ++j) {
@@ -124,6 +140,14 @@ inline void lu_decomp(std::mdspan<double, std::dextents<size_t, 2>> a,
     if (a[ubound, ubound] == 0.0) a[ubound, ubound] = TINY;
 }
 
+inline void lu_decomp(std::mdspan<double, std::dextents<size_t, 2>> a,
+                      std::mdspan<int, std::dextents<size_t, 1>> perm)
+{
+    std::vector<double> vv(a.extent(0));
+    lu_decomp(a, perm,
+              std::mdspan<double, std::dextents<size_t, 1>>(vv.data(), vv.size()));
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 // Back-substitution for the LU factorization produced by lu_decomp().
@@ -172,6 +196,201 @@ inline void lu_backsubs(std::mdspan<double const, std::dextents<size_t, 2>> a,
 }
 
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// Fixed-size (compile-time extent) LU and LDL^T: 3x3 (2D inertia map), 6x6 (3D), ...
+//
+// Overloads of lu_decomp / lu_backsubs, plus ldlt_decomp / ldlt_backsubs, for mdspans
+// with STATIC extents, e.g. std::extents<size_t, 6, 6>. Compared with the runtime-extent
+// path above they
+//   - never touch the heap (plain partial pivoting: no row-scaling vector),
+//   - are constexpr, so they also run in constant expressions,
+//   - have every loop bound fixed at compile time, so the compiler unrolls them fully.
+// The packed LU layout and the permutation convention are those of lu_decomp, so either
+// lu_backsubs can consume either factorization. A pivot that is EXACTLY zero throws
+// Solver_error (instead of the TINY substitution of the runtime path).
+//
+// ldlt_decomp: A = L D L^T of a SYMMETRIC matrix with non-singular leading minors (any
+// definite matrix), without pivoting -- half the work of LU. The 6x6 PGA inertia map
+// becomes symmetric (and definite) once its two 3-row blocks are swapped, see
+// get_inertia_inverse in ga_pga3dp_ops_mechanics.hpp.
+//
+// The *_batch variants sweep a rank-3 mdspan [B x N x N] of B matrices (and a [B x N]
+// mdspan of permutations / right-hand sides), e.g. the inertia maps of every body after
+// a payload change.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// constexpr |x| (std::abs is not usable in constant expressions before C++23 on all
+// supported standard libraries)
+constexpr double solver_abs(double x) { return x < 0.0 ? -x : x; }
+
+// fixed-size LU with partial pivoting; returns false on an exactly zero pivot
+template <size_t N>
+constexpr bool lu_decomp_fixed(std::mdspan<double, std::extents<size_t, N, N>> a,
+                               std::mdspan<int, std::extents<size_t, N>> perm)
+{
+    for (size_t k = 0; k < N; ++k) {
+        size_t p = k; // pivot row: largest |a[i, k]| for i >= k
+        for (size_t i = k + 1; i < N; ++i)
+            if (solver_abs(a[i, k]) > solver_abs(a[p, k])) p = i;
+        perm[k] = static_cast<int>(p);
+        if (a[p, k] == 0.0) return false;
+        if (p != k) {
+            for (size_t j = 0; j < N; ++j) {
+                double const t = a[k, j];
+                a[k, j] = a[p, j];
+                a[p, j] = t;
+            }
+        }
+        double const inv = 1.0 / a[k, k];
+        for (size_t i = k + 1; i < N; ++i) {
+            double const l = (a[i, k] *= inv);
+            for (size_t j = k + 1; j < N; ++j)
+                a[i, j] -= l * a[k, j];
+        }
+    }
+    return true;
+}
+
+// fixed-size LDL^T without pivoting; returns false on an exactly zero pivot
+template <size_t N>
+constexpr bool ldlt_decomp_fixed(std::mdspan<double, std::extents<size_t, N, N>> a)
+{
+    for (size_t j = 0; j < N; ++j) {
+        double d = a[j, j];
+        for (size_t k = 0; k < j; ++k)
+            d -= a[j, k] * a[j, k] * a[k, k];
+        if (d == 0.0) return false;
+        a[j, j] = d;
+        for (size_t i = j + 1; i < N; ++i) {
+            double s = a[i, j];
+            for (size_t k = 0; k < j; ++k)
+                s -= a[i, k] * a[j, k] * a[k, k];
+            a[i, j] = s / d;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+// LU decomposition with partial pivoting, compile-time size N (see above).
+template <size_t N>
+    requires(N != std::dynamic_extent)
+constexpr void lu_decomp(std::mdspan<double, std::extents<size_t, N, N>> a,
+                         std::mdspan<int, std::extents<size_t, N>> perm)
+{
+    if (!detail::lu_decomp_fixed<N>(a, perm))
+        throw Solver_error("hd::ga::lu_decomp: singular matrix.");
+}
+
+// Back-substitution for a fixed-size LU factorization; b is overwritten by x.
+template <size_t N, typename TA, typename TP>
+    requires(N != std::dynamic_extent &&
+             std::is_same_v<std::remove_const_t<TA>, double> &&
+             std::is_same_v<std::remove_const_t<TP>, int>)
+constexpr void lu_backsubs(std::mdspan<TA, std::extents<size_t, N, N>> a,
+                           std::mdspan<TP, std::extents<size_t, N>> perm,
+                           std::mdspan<double, std::extents<size_t, N>> b)
+{
+    for (size_t i = 0; i < N; ++i) { // apply the row swaps, then L y = P b (unit L)
+        size_t const p = static_cast<size_t>(perm[i]);
+        double s = b[p];
+        b[p] = b[i];
+        for (size_t j = 0; j < i; ++j)
+            s -= a[i, j] * b[j];
+        b[i] = s;
+    }
+    for (size_t i = N; i-- > 0;) { // U x = y
+        double s = b[i];
+        for (size_t j = i + 1; j < N; ++j)
+            s -= a[i, j] * b[j];
+        b[i] = s / a[i, i];
+    }
+}
+
+// LDL^T decomposition of a symmetric matrix, compile-time size N, no pivoting. Only the
+// lower triangle is read; on exit the diagonal holds D and the strict lower triangle L
+// (unit diagonal implicit), the upper triangle is untouched. Throws Solver_error on a
+// zero pivot.
+template <size_t N>
+    requires(N != std::dynamic_extent)
+constexpr void ldlt_decomp(std::mdspan<double, std::extents<size_t, N, N>> a)
+{
+    if (!detail::ldlt_decomp_fixed<N>(a))
+        throw Solver_error("hd::ga::ldlt_decomp: zero pivot (matrix singular or not "
+                           "definite).");
+}
+
+// Solve A x = b from the ldlt_decomp factorization; b is overwritten by x.
+template <size_t N, typename TA>
+    requires(N != std::dynamic_extent && std::is_same_v<std::remove_const_t<TA>, double>)
+constexpr void ldlt_backsubs(std::mdspan<TA, std::extents<size_t, N, N>> a,
+                             std::mdspan<double, std::extents<size_t, N>> b)
+{
+    for (size_t i = 0; i < N; ++i) // L y = b
+        for (size_t j = 0; j < i; ++j)
+            b[i] -= a[i, j] * b[j];
+    for (size_t i = 0; i < N; ++i) // D z = y
+        b[i] /= a[i, i];
+    for (size_t i = N; i-- > 0;) // L^T x = z
+        for (size_t j = i + 1; j < N; ++j)
+            b[i] -= a[j, i] * b[j];
+}
+
+// Batched fixed-size LU / LDL^T over B matrices stored [B x N x N] (row-major, packed).
+template <size_t N>
+    requires(N != std::dynamic_extent)
+constexpr void lu_decomp_batch(
+    std::mdspan<double, std::extents<size_t, std::dynamic_extent, N, N>> a,
+    std::mdspan<int, std::extents<size_t, std::dynamic_extent, N>> perm)
+{
+    if (a.extent(0) != perm.extent(0))
+        throw Solver_error("hd::ga::lu_decomp_batch: batch sizes incompatible.");
+    for (size_t k = 0; k < a.extent(0); ++k)
+        lu_decomp(std::mdspan<double, std::extents<size_t, N, N>>(&a[k, 0, 0]),
+                  std::mdspan<int, std::extents<size_t, N>>(&perm[k, 0]));
+}
+
+template <size_t N>
+    requires(N != std::dynamic_extent)
+constexpr void lu_backsubs_batch(
+    std::mdspan<double const, std::extents<size_t, std::dynamic_extent, N, N>> a,
+    std::mdspan<int const, std::extents<size_t, std::dynamic_extent, N>> perm,
+    std::mdspan<double, std::extents<size_t, std::dynamic_extent, N>> b)
+{
+    if (a.extent(0) != perm.extent(0) || a.extent(0) != b.extent(0))
+        throw Solver_error("hd::ga::lu_backsubs_batch: batch sizes incompatible.");
+    for (size_t k = 0; k < a.extent(0); ++k)
+        lu_backsubs(std::mdspan<double const, std::extents<size_t, N, N>>(&a[k, 0, 0]),
+                    std::mdspan<int const, std::extents<size_t, N>>(&perm[k, 0]),
+                    std::mdspan<double, std::extents<size_t, N>>(&b[k, 0]));
+}
+
+template <size_t N>
+    requires(N != std::dynamic_extent)
+constexpr void ldlt_decomp_batch(
+    std::mdspan<double, std::extents<size_t, std::dynamic_extent, N, N>> a)
+{
+    for (size_t k = 0; k < a.extent(0); ++k)
+        ldlt_decomp(std::mdspan<double, std::extents<size_t, N, N>>(&a[k, 0, 0]));
+}
+
+template <size_t N>
+    requires(N != std::dynamic_extent)
+constexpr void ldlt_backsubs_batch(
+    std::mdspan<double const, std::extents<size_t, std::dynamic_extent, N, N>> a,
+    std::mdspan<double, std::extents<size_t, std::dynamic_extent, N>> b)
+{
+    if (a.extent(0) != b.extent(0))
+        throw Solver_error("hd::ga::ldlt_backsubs_batch: batch sizes incompatible.");
+    for (size_t k = 0; k < a.extent(0); ++k)
+        ldlt_backsubs(std::mdspan<double const, std::extents<size_t, N, N>>(&a[k, 0, 0]),
+                      std::mdspan<double, std::extents<size_t, N>>(&b[k, 0]));
+}
+
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // Convenience: solve a small dense system A x = b given as flat ROW-MAJOR std::vector
 // (A has n*n entries, b has n). Wraps lu_decomp + lu_backsubs -- the factorization is
@@ -265,6 +484,96 @@ std::vector<T> lstsq_solve(std::vector<T> const& A, std::vector<T> const& b, siz
 }
 
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// lstsq_solve split into a reusable factorization and a cheap apply step, for callers
+// that solve many right-hand sides against the same (or a slowly changing) A -- the
+// chord iteration of the closed-loop position projection reuses one factorization of
+// the constraint Jacobian across Newton iterations and steps.
+//
+// lstsq_factorize builds and LU-factorizes the square system of the regime (A, A A^T
+// or A^T A, see lstsq_solve) and keeps a copy of A; lstsq_apply then returns x = A^+ b
+// at the cost of two triangular solves and one or two products with A. Same results as
+// lstsq_solve for the same A and b.
+/////////////////////////////////////////////////////////////////////////////////////////
+template <typename T> struct lstsq_factorization {
+    size_t m{0}, ncols{0};
+    std::vector<T> A;       // the factorized matrix (m x ncols, row-major)
+    std::vector<double> lu; // LU of A, A A^T or A^T A (packed in place)
+    std::vector<int> perm;  // row permutation of the LU
+    bool valid{false};
+};
+
+template <typename T>
+void lstsq_factorize(lstsq_factorization<T>& f, std::vector<T> const& A, size_t m,
+                     size_t ncols)
+{
+    if (A.size() != m * ncols) {
+        throw Solver_error("hd::ga::lstsq_factorize: matrix size incompatible with "
+                           "m x ncols.");
+    }
+    f.valid = false;
+    f.m = m;
+    f.ncols = ncols;
+    f.A = A;
+    size_t const ns = std::min(m, ncols); // order of the square system
+    f.lu.assign(ns * ns, 0.0);
+    f.perm.assign(ns, 0);
+    for (size_t i = 0; i < ns; ++i)
+        for (size_t j = 0; j < ns; ++j) {
+            double s = 0.0;
+            if (ncols == m) s = static_cast<double>(A[i * ncols + j]);
+            else if (ncols > m) // A A^T
+                for (size_t k = 0; k < ncols; ++k)
+                    s += static_cast<double>(A[i * ncols + k] * A[j * ncols + k]);
+            else // A^T A
+                for (size_t k = 0; k < m; ++k)
+                    s += static_cast<double>(A[k * ncols + i] * A[k * ncols + j]);
+            f.lu[i * ns + j] = s;
+        }
+    std::mdspan<double, std::dextents<size_t, 2>> am(f.lu.data(), ns, ns);
+    std::mdspan<int, std::dextents<size_t, 1>> pm(f.perm.data(), ns);
+    lu_decomp(am, pm);
+    f.valid = true;
+}
+
+template <typename T>
+std::vector<T> lstsq_apply(lstsq_factorization<T> const& f, std::vector<T> const& b)
+{
+    size_t const m = f.m;
+    size_t const ncols = f.ncols;
+    if (!f.valid || b.size() != m) {
+        throw Solver_error("hd::ga::lstsq_apply: no factorization or right-hand side "
+                           "size incompatible with it.");
+    }
+    size_t const ns = std::min(m, ncols);
+    std::vector<double> y(ns, 0.0);
+    if (ncols < m) // A^T b
+        for (size_t a = 0; a < ncols; ++a)
+            for (size_t i = 0; i < m; ++i)
+                y[a] += static_cast<double>(f.A[i * ncols + a] * b[i]);
+    else
+        for (size_t i = 0; i < m; ++i)
+            y[i] = static_cast<double>(b[i]);
+
+    std::mdspan<double const, std::dextents<size_t, 2>> ac(f.lu.data(), ns, ns);
+    std::mdspan<int const, std::dextents<size_t, 1>> pc(f.perm.data(), ns);
+    lu_backsubs(ac, pc, std::mdspan<double, std::dextents<size_t, 1>>(y.data(), ns));
+
+    std::vector<T> x(ncols, T(0));
+    if (ncols > m) // x = A^T y
+        for (size_t k = 0; k < ncols; ++k) {
+            T s = T(0);
+            for (size_t i = 0; i < m; ++i)
+                s += f.A[i * ncols + k] * static_cast<T>(y[i]);
+            x[k] = s;
+        }
+    else
+        for (size_t k = 0; k < ncols; ++k)
+            x[k] = static_cast<T>(y[k]);
+    return x;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // Bordered (saddle-point / KKT) dense solve. For the equality-constrained system
 //
@@ -308,6 +617,301 @@ std::vector<T> kkt_solve(std::vector<T> const& M, std::vector<T> const& G,
 }
 
 
+/////////////////////////////////////////////////////////////////////////////////////////
+// Tree-sparse LTDL factorization H = L^T D L (Featherstone, "Rigid Body Dynamics
+// Algorithms", sec. 6.3) of a symmetric positive-definite n x n matrix H (flat ROW-MAJOR)
+// whose sparsity follows a tree: H[i][j] != 0 only if i == j or one of i, j is an
+// ancestor of the other. lambda[i] is the parent of i, with lambda[i] < i for every
+// non-root and lambda[i] == i for a root (the self-parent convention of the frame trees).
+// The joint-space mass matrix of a kinematic tree has exactly this pattern, with lambda
+// the nearest dof ancestor of each joint.
+//
+// In place: on exit the strict lower triangle (along the ancestor paths) holds L (unit
+// diagonal implicit) and the diagonal holds D. Only the ancestor entries are touched, so
+// the cost is O(n d^2) for tree depth d -- O(n) for wide, shallow trees and never worse
+// than the dense O(n^3). No fill-in outside the pattern, and no pivoting (H is SPD).
+// Throws Solver_error on a non-positive pivot (H not positive definite).
+/////////////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void ltdl_decomp(std::vector<T>& H, std::vector<size_t> const& lambda)
+{
+    size_t const n = lambda.size();
+    if (H.size() != n * n) {
+        throw Solver_error("hd::ga::ltdl_decomp: matrix size incompatible with the "
+                           "parent vector.");
+    }
+    for (size_t k = n; k-- > 0;) {
+        if (!(H[k * n + k] > T(0))) {
+            throw Solver_error("hd::ga::ltdl_decomp: matrix not positive definite.");
+        }
+        for (size_t i = k; lambda[i] != i;) {
+            i = lambda[i];
+            T const a = H[k * n + i] / H[k * n + k];
+            for (size_t j = i;; j = lambda[j]) {
+                H[i * n + j] -= a * H[k * n + j];
+                if (lambda[j] == j) break;
+            }
+            H[k * n + i] = a;
+        }
+    }
+}
+
+// Solve H x = b given the factorization from ltdl_decomp; the solution overwrites b.
+// Three sparse sweeps: L^T y = b (leaves -> roots), y /= D, L x = y (roots -> leaves).
+template <typename T>
+void ltdl_backsubs(std::vector<T> const& H, std::vector<size_t> const& lambda,
+                   std::vector<T>& b)
+{
+    size_t const n = lambda.size();
+    if (H.size() != n * n || b.size() != n) {
+        throw Solver_error("hd::ga::ltdl_backsubs: matrix / right-hand side size "
+                           "incompatible with the parent vector.");
+    }
+    for (size_t i = n; i-- > 0;) {
+        for (size_t j = i; lambda[j] != j;) {
+            j = lambda[j];
+            b[j] -= H[i * n + j] * b[i];
+        }
+    }
+    for (size_t i = 0; i < n; ++i)
+        b[i] /= H[i * n + i];
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i; lambda[j] != j;) {
+            j = lambda[j];
+            b[i] -= H[i * n + j] * b[j];
+        }
+    }
+}
+
+// Convenience: solve the tree-sparse SPD system H x = b (H left unmodified). Returns x.
+template <typename T>
+std::vector<T> ltdl_solve(std::vector<T> H, std::vector<size_t> const& lambda,
+                          std::vector<T> b)
+{
+    ltdl_decomp(H, lambda);
+    ltdl_backsubs(H, lambda, b);
+    return b;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// Structured (Schur-complement) solve of the same bordered KKT system as kkt_solve, for
+// M symmetric positive definite with the tree sparsity of ltdl_decomp (the joint-space
+// mass matrix) and G made of row BLOCKS (one per loop-closure constraint) whose columns
+// touch only a part of the tree:
+//
+//   M = L^T D L               (tree-sparse LTDL, no pivoting)
+//   Z = L^-T G^T              (one sparse leaves -> roots sweep per constraint row)
+//   C = G M^-1 G^T = Z^T D^-1 Z          (the small m x m Schur complement)
+//   C l = G M^-1 f - g,   x = M^-1 (f - G^T l)
+//
+// The (n+m)^2 bordered matrix is never formed. The work is the LTDL of M plus O(m) sparse
+// sweeps and an m x m factorization, instead of the dense O((n+m)^3) LU.
+//
+// The SYMBOLIC part depends only on the topology and is built once by kkt_schur_analyze:
+// the dof-tree parents of M, the row range of each block and its column support closed
+// under tree ancestors (the only entries the L^-T sweep can fill), and the list of block
+// pairs with overlapping support. Blocks on disjoint sub-chains (independent loops) give
+// exact zero blocks in C, which are skipped. kkt_schur_solve then only does numeric work
+// in the workspace buffers, so repeated solves (e.g. every RK4 stage) do not allocate.
+//
+// Returns x (length n, held in the workspace until the next solve); writes the Lagrange
+// multipliers l (length m) into `lambda_out` if non-null. Throws Solver_error if M is not
+// positive definite. A numerically singular C (redundant constraints, e.g. a flat
+// linkage) falls back to the pivoting kkt_solve so the result matches the bordered path.
+/////////////////////////////////////////////////////////////////////////////////////////
+template <typename T> struct kkt_schur_workspace {
+    // symbolic (set by kkt_schur_analyze)
+    size_t n{0}, m{0};
+    std::vector<size_t> lambda;                       // dof-tree parents of M
+    std::vector<size_t> block_row;                    // first row of block b (+ end)
+    std::vector<std::vector<size_t>> support;         // block columns, ascending
+    std::vector<std::pair<size_t, size_t>> couplings; // block pairs (a <= b) to form
+    std::vector<size_t> chain;                        // dense LTDL parents for C
+    bool analyzed{false};
+    // numeric scratch
+    std::vector<T> H; // factorized M
+    std::vector<T> Z; // L^-T G^T, row r of G -> Z[r * n ...]
+    std::vector<T> C; // Schur complement (m x m), factorized in place
+    std::vector<T> x; // M^-1 f, then the solution
+    std::vector<T> l; // Lagrange multipliers
+};
+
+// Symbolic analysis. `lambda` are the dof-tree parents of M (as for ltdl_decomp).
+// `block_cols[b]` lists the columns that constraint block b can structurally touch; its
+// rows are the next `block_rows[b]` rows of G.
+template <typename T>
+void kkt_schur_analyze(kkt_schur_workspace<T>& ws, std::vector<size_t> const& lambda,
+                       std::vector<size_t> const& block_rows,
+                       std::vector<std::vector<size_t>> const& block_cols)
+{
+    if (block_rows.size() != block_cols.size()) {
+        throw Solver_error("hd::ga::kkt_schur_analyze: block_rows and block_cols "
+                           "differ in size.");
+    }
+    size_t const n = lambda.size();
+    size_t const nb = block_rows.size();
+    ws.n = n;
+    ws.lambda = lambda;
+    ws.block_row.assign(nb + 1, 0);
+    for (size_t b = 0; b < nb; ++b)
+        ws.block_row[b + 1] = ws.block_row[b] + block_rows[b];
+    ws.m = ws.block_row[nb];
+
+    // close every support under tree ancestors
+    std::vector<char> mark(n);
+    ws.support.assign(nb, {});
+    for (size_t b = 0; b < nb; ++b) {
+        std::fill(mark.begin(), mark.end(), char(0));
+        for (size_t k : block_cols[b]) {
+            if (k >= n) {
+                throw Solver_error("hd::ga::kkt_schur_analyze: column index out of "
+                                   "range.");
+            }
+            for (; !mark[k]; k = lambda[k]) {
+                mark[k] = 1;
+                if (lambda[k] == k) break;
+            }
+        }
+        for (size_t k = 0; k < n; ++k)
+            if (mark[k]) ws.support[b].push_back(k);
+    }
+
+    // coupled block pairs: overlapping supports (sorted -> linear merge)
+    ws.couplings.clear();
+    for (size_t a = 0; a < nb; ++a)
+        for (size_t b = a; b < nb; ++b) {
+            auto const& sa = ws.support[a];
+            auto const& sb = ws.support[b];
+            bool overlap = false;
+            for (size_t i = 0, j = 0; i < sa.size() && j < sb.size() && !overlap;) {
+                if (sa[i] == sb[j]) overlap = true;
+                else if (sa[i] < sb[j]) ++i;
+                else ++j;
+            }
+            if (overlap) ws.couplings.emplace_back(a, b);
+        }
+
+    ws.chain.resize(ws.m); // C is (block-)dense: factor it as a chain
+    for (size_t i = 0; i < ws.m; ++i)
+        ws.chain[i] = (i == 0) ? 0 : i - 1;
+
+    ws.H.assign(n * n, T(0));
+    ws.Z.assign(ws.m * n, T(0));
+    ws.C.assign(ws.m * ws.m, T(0));
+    ws.x.assign(n, T(0));
+    ws.l.assign(ws.m, T(0));
+    ws.analyzed = true;
+}
+
+// Numeric solve on an analyzed workspace (M, G flat ROW-MAJOR as for kkt_solve).
+template <typename T>
+std::vector<T> const& kkt_schur_solve(kkt_schur_workspace<T>& ws, std::vector<T> const& M,
+                                      std::vector<T> const& G, std::vector<T> const& f,
+                                      std::vector<T> const& g,
+                                      std::vector<T>* lambda_out = nullptr)
+{
+    size_t const n = ws.n;
+    size_t const m = ws.m;
+    if (!ws.analyzed || M.size() != n * n || G.size() != m * n || f.size() != n ||
+        g.size() != m) {
+        throw Solver_error("hd::ga::kkt_schur_solve: workspace not analyzed or "
+                           "dimensions incompatible with the analysis.");
+    }
+    size_t const nb = ws.support.size();
+
+    // M = L^T D L
+    std::copy(M.begin(), M.end(), ws.H.begin());
+    ltdl_decomp(ws.H, ws.lambda);
+    auto const& H = ws.H;
+
+    // Z = L^-T G^T: the leaves -> roots sweep of ltdl_backsubs, restricted to the support
+    for (size_t b = 0; b < nb; ++b) {
+        auto const& sup = ws.support[b];
+        for (size_t r = ws.block_row[b]; r < ws.block_row[b + 1]; ++r) {
+            T* z = ws.Z.data() + r * n;
+            for (size_t const k : sup)
+                z[k] = G[r * n + k];
+            for (size_t s = sup.size(); s-- > 0;) {
+                size_t const i = sup[s];
+                for (size_t j = i; ws.lambda[j] != j;) {
+                    j = ws.lambda[j];
+                    z[j] -= H[i * n + j] * z[i];
+                }
+            }
+        }
+    }
+
+    // C = Z^T D^-1 Z over the coupled blocks only (all other blocks of C are zero)
+    std::fill(ws.C.begin(), ws.C.end(), T(0));
+    T cmax = T(0);
+    for (auto const& [a, b] : ws.couplings) {
+        auto const& sa = ws.support[a];
+        auto const& sb = ws.support[b];
+        for (size_t r = ws.block_row[a]; r < ws.block_row[a + 1]; ++r) {
+            T const* zr = ws.Z.data() + r * n;
+            for (size_t c = ws.block_row[b]; c < ws.block_row[b + 1]; ++c) {
+                T const* zc = ws.Z.data() + c * n;
+                T s = T(0);
+                for (size_t i = 0, j = 0; i < sa.size() && j < sb.size();) {
+                    if (sa[i] == sb[j]) {
+                        s += zr[sa[i]] * zc[sa[i]] / H[sa[i] * n + sa[i]];
+                        ++i;
+                        ++j;
+                    }
+                    else if (sa[i] < sb[j]) ++i;
+                    else ++j;
+                }
+                ws.C[r * m + c] = ws.C[c * m + r] = s;
+            }
+        }
+    }
+    for (size_t r = 0; r < m; ++r)
+        cmax = std::max(cmax, ws.C[r * m + r]);
+
+    // C = L_c^T D_c L_c (dense); a (relatively) vanishing pivot means redundant
+    // constraints -> pivoting bordered fallback
+    bool singular = !(cmax > T(0));
+    if (!singular) {
+        try {
+            ltdl_decomp(ws.C, ws.chain);
+        }
+        catch (Solver_error const&) {
+            singular = true;
+        }
+        for (size_t r = 0; r < m && !singular; ++r)
+            singular = ws.C[r * m + r] <= T(1e-12) * cmax;
+    }
+    if (singular) {
+        ws.x = kkt_solve(M, G, f, g, n, m, lambda_out);
+        return ws.x;
+    }
+
+    // C l = G M^-1 f - g
+    std::copy(f.begin(), f.end(), ws.x.begin());
+    ltdl_backsubs(H, ws.lambda, ws.x);
+    for (size_t b = 0; b < nb; ++b)
+        for (size_t r = ws.block_row[b]; r < ws.block_row[b + 1]; ++r) {
+            T s = -g[r];
+            for (size_t const k : ws.support[b])
+                s += G[r * n + k] * ws.x[k];
+            ws.l[r] = s;
+        }
+    ltdl_backsubs(ws.C, ws.chain, ws.l);
+
+    // x = M^-1 (f - G^T l)
+    std::copy(f.begin(), f.end(), ws.x.begin());
+    for (size_t b = 0; b < nb; ++b)
+        for (size_t r = ws.block_row[b]; r < ws.block_row[b + 1]; ++r)
+            for (size_t const k : ws.support[b])
+                ws.x[k] -= G[r * n + k] * ws.l[r];
+    ltdl_backsubs(H, ws.lambda, ws.x);
+
+    if (lambda_out) lambda_out->assign(ws.l.begin(), ws.l.end());
+    return ws.x;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // Determinant of a square matrix via the LU factorization.
 //
@@ -315,10 +919,34 @@ std::vector<T> kkt_solve(std::vector<T> const& M, std::vector<T> const& G,
 // buffer first. Returns T(0) for a singular matrix (rather than
 // propagating Solver_error), which is the convention physics callers
 // rely on for "is this inertia tensor invertible?" checks.
+//
+// A matrix with STATIC extents (e.g. the Inertia2dp/3dp views) takes the
+// fixed-size LU on a stack buffer: heap-free and usable in constant
+// expressions.
 /////////////////////////////////////////////////////////////////////////////////////////
 template <typename T, typename Extents, typename LayoutPolicy, typename AccessorPolicy>
-T det(std::mdspan<T, Extents, LayoutPolicy, AccessorPolicy> A)
+constexpr T det(std::mdspan<T, Extents, LayoutPolicy, AccessorPolicy> A)
 {
+    if constexpr (Extents::rank_dynamic() == 0) {
+        constexpr size_t N = Extents::static_extent(0);
+        static_assert(N == Extents::static_extent(1),
+                      "hd::ga::det: matrix must be square.");
+        std::array<double, N * N> data{};
+        std::array<int, N> perm{};
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < N; ++j)
+                data[i * N + j] = static_cast<double>(A[i, j]);
+        std::mdspan<double, std::extents<size_t, N, N>> a(data.data());
+        if (!detail::lu_decomp_fixed<N>(a, std::mdspan<int, std::extents<size_t, N>>(
+                                                perm.data()))) {
+            return T(0); // singular matrix has determinant 0
+        }
+        double result = 1.0;
+        for (size_t i = 0; i < N; ++i)
+            result *= (perm[i] != static_cast<int>(i)) ? -a[i, i] : a[i, i];
+        return static_cast<T>(result);
+    }
+
     size_t const n = A.extent(0);
 
     if (n != A.extent(1)) {
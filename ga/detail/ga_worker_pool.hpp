@@ -0,0 +1,150 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// Persistent worker threads for the parallel loops of the physics layers.
+//
+// A worker_pool keeps its threads alive between calls, so a loop that is run once per
+// time step (free bodies of dynamic_system3dp, the instances of ensemble3dp) pays for
+// thread creation only once, not on every step:
+//
+//   hd::ga::detail::worker_pool pool;
+//   pool.run(n, [&](size_t w) { ... }); // f(w) for w = 0..n-1, in parallel
+//
+// w = 0 runs on the calling thread, w = 1..n-1 on the pool's threads. The threads are
+// started on the first call that needs them and joined by the destructor. run() blocks
+// until all n calls have returned and rethrows the exception of the lowest w that threw.
+// Once the pool has grown to n, run(n, f) performs no heap allocation.
+//
+// One run() at a time per pool (the owner's loop, not a shared task queue). A copy or
+// move of a pool is a fresh pool without threads, so the owning class stays copyable.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // size_t
+#include <exception>          // std::exception_ptr
+#include <memory>             // std::addressof
+#include <mutex>              // std::mutex, std::unique_lock, std::lock_guard
+#include <thread>             // std::jthread
+#include <type_traits>        // std::remove_reference_t
+#include <vector>
+
+namespace hd::ga::detail {
+
+class worker_pool {
+
+  public:
+
+    worker_pool() = default;
+    worker_pool(worker_pool const&) : worker_pool() {}
+    worker_pool(worker_pool&&) noexcept : worker_pool() {}
+    worker_pool& operator=(worker_pool const&) { return *this; }
+    worker_pool& operator=(worker_pool&&) noexcept { return *this; }
+
+    ~worker_pool()
+    {
+        {
+            std::lock_guard lk(m_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        threads_.clear(); // joins
+    }
+
+    // number of threads started so far (the calling thread not included)
+    size_t size() const { return threads_.size(); }
+
+    // Call f(w) for w = 0..n-1 in parallel and wait for all of them.
+    template <typename F> void run(size_t n, F&& f)
+    {
+        if (n == 0) return;
+        if (n == 1) { // serial: no hand-off at all
+            f(size_t{0});
+            return;
+        }
+        grow(n - 1);
+        using Fn = std::remove_reference_t<F>;
+        {
+            std::lock_guard lk(m_);
+            fn_ = [](void const* ctx, size_t w) {
+                (*static_cast<Fn*>(const_cast<void*>(ctx)))(w);
+            };
+            ctx_ = std::addressof(f);
+            active_ = n;
+            pending_ = n - 1;
+            for (auto& e : err_)
+                e = nullptr;
+            ++gen_;
+        }
+        wake_.notify_all();
+
+        std::exception_ptr e0;
+        try {
+            f(size_t{0});
+        }
+        catch (...) {
+            e0 = std::current_exception();
+        }
+        {
+            std::unique_lock lk(m_);
+            done_.wait(lk, [&] { return pending_ == 0; });
+        }
+        if (e0) std::rethrow_exception(e0);
+        for (size_t w = 1; w < n; ++w)
+            if (err_[w]) std::rethrow_exception(err_[w]);
+    }
+
+  private:
+
+    std::mutex m_;
+    std::condition_variable wake_;             // a new job (gen_) or stop_
+    std::condition_variable done_;             // pending_ reached 0
+    void (*fn_)(void const*, size_t){nullptr}; // type-erased call of the job's f
+    void const* ctx_{nullptr};                 // the job's f
+    size_t active_{0};                         // workers of the job (incl. w = 0)
+    size_t pending_{0};                        // pool workers not yet finished
+    size_t gen_{0};                            // job counter
+    bool stop_{false};                         // set by the destructor
+    std::vector<std::exception_ptr> err_;      // per worker index (err_[0] unused)
+    std::vector<std::jthread> threads_;        // last member: joined first
+
+    // make sure there are at least n pool threads (worker indices 1..n)
+    void grow(size_t n)
+    {
+        if (threads_.size() >= n) return;
+        std::lock_guard lk(m_); // no job in flight: run() is not reentrant
+        err_.resize(n + 1);
+        threads_.reserve(n);
+        while (threads_.size() < n)
+            threads_.emplace_back([this, w = threads_.size() + 1, seen = gen_] {
+                loop(w, seen);
+            });
+    }
+
+    void loop(size_t w, size_t seen)
+    {
+        for (;;) {
+            {
+                std::unique_lock lk(m_);
+                wake_.wait(lk, [&] { return stop_ || gen_ != seen; });
+                if (stop_) return;
+                seen = gen_;
+                if (w >= active_) continue; // not needed for this job
+            }
+            try {
+                fn_(ctx_, w);
+            }
+            catch (...) {
+                err_[w] = std::current_exception();
+            }
+            {
+                std::lock_guard lk(m_);
+                if (--pending_ == 0) done_.notify_one();
+            }
+        }
+    }
+};
+
+} // namespace hd::ga::detail
@@ -0,0 +1,462 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+#include <algorithm>   // std::copy_n, std::fill_n, std::max, std::min
+#include <array>       // std::array (component pointers, transform matrix)
+#include <cstddef>     // size_t
+#include <memory>      // std::assume_aligned, std::unique_ptr
+#include <new>         // ::operator new / delete with std::align_val_t
+#include <span>        // std::span (component view, AoS batch kernel)
+#include <stdexcept>   // std::invalid_argument
+#include <string>      // std::string, std::to_string
+#include <type_traits> // std::is_trivially_copyable_v
+#include <utility>     // std::exchange, std::move
+#include <vector>
+
+#include "ga_type_tags.hpp"
+
+#include "ga_bvec10_t.hpp" // bivector / trivector 3dc
+#include "ga_bvec6_t.hpp"  // bivector 3dp, 2dc, 4ds
+#include "ga_vec2_t.hpp"   // vector 2d
+#include "ga_vec3_t.hpp"   // vector 3d, 2dp, bivector 3d, 2dp
+#include "ga_vec4_t.hpp"   // vector 3dp, 2dc, 4ds, trivector 3dp, 2dc, 4ds
+#include "ga_vec5_t.hpp"   // vector / quadvector 3dc
+
+namespace hd::ga {
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// SoA_t<E> definition: structure-of-arrays container for a GA element type E
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+// std::vector<Vec3dp<T>> stores the points interleaved (AoS): x0 y0 z0 w0 x1 y1 ...
+// A loop that transforms all points has to gather every component with a stride of 4,
+// which leaves most of the SIMD width unused. SoA_t<E> stores each component in its own
+// contiguous array instead (x0 x1 x2 ... | y0 y1 y2 ... | ...), so the same loop reads
+// and writes unit-stride streams and vectorizes across the points.
+//
+// LAYOUT: ONE allocation, aligned to soa_alignment (64 bytes, a cache line and a full
+// AVX-512 register). The component arrays follow each other with a stride of
+// capacity() elements, which is always a multiple of soa_alignment / sizeof(T): EVERY
+// component array starts aligned, and the kernels below tell the compiler so
+// (std::assume_aligned). Elements beyond size() are zero.
+//
+// The component order is the member order of E:
+//
+//   Vec2_t   (Vec2d):                         0..1 = x, y
+//   Vec3_t   (Vec3d, BiVec3d, Vec2dp, ...):    0..2 = x, y, z
+//   Vec4_t   (Vec3dp, TriVec3dp, Vec4ds, ...): 0..3 = x, y, z, w
+//   Vec5_t   (Vec3dc, QuadVec3dc):             0..4 = x, y, z, w, u
+//   BVec6_t  (BiVec3dp, BiVec4ds, BiVec2dc):   0..5 = vx, vy, vz, mx, my, mz
+//   BVec10_t (BiVec3dc, TriVec3dc):            0..9 = vx, ..., mz, px, py, pz, pw
+//
+// Elements are read and written by value (operator[] returns an E, set() stores one);
+// bulk data is accessed through the component arrays (data(k), component(k)).
+/////////////////////////////////////////////////////////////////////////////////////////
+
+inline constexpr size_t soa_alignment = 64; // [bytes]
+
+// Component mapping of the supported element types (member order): to_array() and
+// from_array() convert between an element and its components. The SoA container and the
+// batch kernels below are written against this mapping only.
+template <typename E> struct soa_traits;
+
+template <typename T, typename Tag> struct soa_traits<Vec2_t<T, Tag>> {
+    using value_type = T;
+    static constexpr size_t ncomp = 2;
+    static constexpr std::array<T, 2> to_array(Vec2_t<T, Tag> const& e)
+    {
+        return {e.x, e.y};
+    }
+    static constexpr Vec2_t<T, Tag> from_array(std::array<T, 2> const& a)
+    {
+        return Vec2_t<T, Tag>(a[0], a[1]);
+    }
+};
+
+template <typename T, typename Tag> struct soa_traits<Vec3_t<T, Tag>> {
+    using value_type = T;
+    static constexpr size_t ncomp = 3;
+    static constexpr std::array<T, 3> to_array(Vec3_t<T, Tag> const& e)
+    {
+        return {e.x, e.y, e.z};
+    }
+    static constexpr Vec3_t<T, Tag> from_array(std::array<T, 3> const& a)
+    {
+        return Vec3_t<T, Tag>(a[0], a[1], a[2]);
+    }
+};
+
+template <typename T, typename Tag> struct soa_traits<Vec4_t<T, Tag>> {
+    using value_type = T;
+    static constexpr size_t ncomp = 4;
+    static constexpr std::array<T, 4> to_array(Vec4_t<T, Tag> const& e)
+    {
+        return {e.x, e.y, e.z, e.w};
+    }
+    static constexpr Vec4_t<T, Tag> from_array(std::array<T, 4> const& a)
+    {
+        return Vec4_t<T, Tag>(a[0], a[1], a[2], a[3]);
+    }
+};
+
+template <typename T, typename Tag> struct soa_traits<Vec5_t<T, Tag>> {
+    using value_type = T;
+    static constexpr size_t ncomp = 5;
+    static constexpr std::array<T, 5> to_array(Vec5_t<T, Tag> const& e)
+    {
+        return {e.x, e.y, e.z, e.w, e.u};
+    }
+    static constexpr Vec5_t<T, Tag> from_array(std::array<T, 5> const& a)
+    {
+        return Vec5_t<T, Tag>(a[0], a[1], a[2], a[3], a[4]);
+    }
+};
+
+template <typename T, typename Tag> struct soa_traits<BVec6_t<T, Tag>> {
+    using value_type = T;
+    static constexpr size_t ncomp = 6;
+    static constexpr std::array<T, 6> to_array(BVec6_t<T, Tag> const& e)
+    {
+        return {e.vx, e.vy, e.vz, e.mx, e.my, e.mz};
+    }
+    static constexpr BVec6_t<T, Tag> from_array(std::array<T, 6> const& a)
+    {
+        return BVec6_t<T, Tag>(a[0], a[1], a[2], a[3], a[4], a[5]);
+    }
+};
+
+template <typename T, typename Tag> struct soa_traits<BVec10_t<T, Tag>> {
+    using value_type = T;
+    static constexpr size_t ncomp = 10;
+    static constexpr std::array<T, 10> to_array(BVec10_t<T, Tag> const& e)
+    {
+        return {e.vx, e.vy, e.vz, e.mx, e.my, e.mz, e.px, e.py, e.pz, e.pw};
+    }
+    static constexpr BVec10_t<T, Tag> from_array(std::array<T, 10> const& a)
+    {
+        return BVec10_t<T, Tag>(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8],
+                                a[9]);
+    }
+};
+
+template <typename E> class SoA_t {
+
+  public:
+
+    using element_type = E;
+    using value_type = typename soa_traits<E>::value_type;
+    static constexpr size_t ncomp = soa_traits<E>::ncomp;
+
+    static_assert(std::is_trivially_copyable_v<value_type>);
+
+    // ctors
+    SoA_t() = default;
+
+    explicit SoA_t(size_t n) { resize(n); }
+
+    explicit SoA_t(std::span<E const> elems)
+    {
+        reserve(elems.size());
+        size_ = elems.size();
+        auto const p = data_ptrs();
+        for (size_t i = 0; i < size_; ++i) {
+            store(p, i, elems[i]);
+        }
+    }
+
+    explicit SoA_t(std::vector<E> const& elems) : SoA_t(std::span<E const>(elems)) {}
+
+    SoA_t(SoA_t const& other) { *this = other; }
+    SoA_t(SoA_t&& other) noexcept :
+        buf_(std::move(other.buf_)), size_(std::exchange(other.size_, 0)),
+        cap_(std::exchange(other.cap_, 0))
+    {
+    }
+
+    SoA_t& operator=(SoA_t const& other)
+    {
+        if (this == &other) return *this;
+        clear(); // keeps the tail beyond size() zero
+        reserve(other.size_);
+        for (size_t k = 0; k < ncomp; ++k) {
+            std::copy_n(other.data(k), other.size_, data(k));
+        }
+        size_ = other.size_;
+        return *this;
+    }
+    SoA_t& operator=(SoA_t&& other) noexcept
+    {
+        buf_ = std::move(other.buf_);
+        size_ = std::exchange(other.size_, 0);
+        cap_ = std::exchange(other.cap_, 0);
+        return *this;
+    }
+
+    size_t size() const { return size_; }
+    size_t capacity() const { return cap_; }
+    bool empty() const { return size_ == 0; }
+
+    // grow the component arrays to hold at least n elements (keeps the contents)
+    void reserve(size_t n)
+    {
+        if (n <= cap_) return;
+        size_t const chunk = std::max(size_t(1), soa_alignment / sizeof(value_type));
+        size_t const cap = (n + chunk - 1) / chunk * chunk;
+        buffer_t buf(static_cast<value_type*>(::operator new(
+            ncomp * cap * sizeof(value_type), std::align_val_t{soa_alignment})));
+        for (size_t k = 0; k < ncomp; ++k) {
+            std::copy_n(data(k), size_, buf.get() + k * cap);
+            std::fill_n(buf.get() + k * cap + size_, cap - size_, value_type(0));
+        }
+        buf_ = std::move(buf);
+        cap_ = cap;
+    }
+
+    // new elements are zero; shrinking zeroes the released tail (keeps the capacity)
+    void resize(size_t n)
+    {
+        if (n > cap_) reserve(std::max(n, 2 * cap_));
+        if (n < size_) {
+            for (size_t k = 0; k < ncomp; ++k) {
+                std::fill_n(data(k) + n, size_ - n, value_type(0));
+            }
+        }
+        size_ = n;
+    }
+
+    void clear() { resize(0); }
+
+    void push_back(E const& e)
+    {
+        if (size_ == cap_) reserve(std::max(size_t(16), 2 * cap_));
+        store(data_ptrs(), size_, e);
+        ++size_;
+    }
+
+    // element access by value (gather / scatter of the components)
+    E operator[](size_t i) const { return load(data_ptrs(), i); }
+    void set(size_t i, E const& e) { store(data_ptrs(), i, e); }
+
+    // component arrays (aligned to soa_alignment)
+    value_type* data(size_t k) { return buf_.get() + k * cap_; }
+    value_type const* data(size_t k) const { return buf_.get() + k * cap_; }
+
+    std::span<value_type> component(size_t k) { return {data(k), size_}; }
+    std::span<value_type const> component(size_t k) const { return {data(k), size_}; }
+
+    std::array<value_type*, ncomp> data_ptrs()
+    {
+        std::array<value_type*, ncomp> p{};
+        for (size_t k = 0; k < ncomp; ++k) {
+            p[k] = data(k);
+        }
+        return p;
+    }
+    std::array<value_type const*, ncomp> data_ptrs() const
+    {
+        std::array<value_type const*, ncomp> p{};
+        for (size_t k = 0; k < ncomp; ++k) {
+            p[k] = data(k);
+        }
+        return p;
+    }
+
+    // back to the interleaved (AoS) layout
+    std::vector<E> to_vector() const
+    {
+        std::vector<E> res;
+        res.reserve(size_);
+        auto const p = data_ptrs();
+        for (size_t i = 0; i < size_; ++i) {
+            res.push_back(load(p, i));
+        }
+        return res;
+    }
+
+  private:
+
+    static E load(std::array<value_type const*, ncomp> const& p, size_t i)
+    {
+        std::array<value_type, ncomp> a;
+        for (size_t k = 0; k < ncomp; ++k) {
+            a[k] = p[k][i];
+        }
+        return soa_traits<E>::from_array(a);
+    }
+    static void store(std::array<value_type*, ncomp> const& p, size_t i, E const& e)
+    {
+        auto const a = soa_traits<E>::to_array(e);
+        for (size_t k = 0; k < ncomp; ++k) {
+            p[k][i] = a[k];
+        }
+    }
+
+    struct aligned_delete {
+        void operator()(value_type* p) const
+        {
+            ::operator delete(p, std::align_val_t{soa_alignment});
+        }
+    };
+    using buffer_t = std::unique_ptr<value_type[], aligned_delete>;
+
+    buffer_t buf_{};
+    size_t size_{0};
+    size_t cap_{0};
+};
+
+namespace detail {
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// batch kernel: out_r[i] = sum_c k[r][c] * in_c[i] for all i < n
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+// The linear map of a sandwich product on one grade (e.g. a motor acting on points) is
+// a small N x N matrix that is the same for all elements. Applied to SoA component
+// arrays, the loop body has no stride and no gather, and the compiler vectorizes it
+// across i (4 doubles per AVX2 op, 8 per AVX-512 op). The sums are accumulated in the
+// column order c = 0, 1, ..., N-1, i.e. in the same order as the hand-expanded
+// single-element move3dp_opt() / move2dp_opt().
+//
+// BLOCKING: the results of a block of soa_block elements are first written to a local
+// array and only then copied to out. The compiler can see that the local aliases
+// nothing, so it needs NO runtime overlap checks between the 2 N component pointers
+// (too many for it to version the loop otherwise), and in and out may be identical (in
+// place: a block is read completely before it is overwritten). The full blocks have a
+// constant trip count and vectorize without a scalar epilogue.
+//
+// pre: the component arrays are aligned to soa_alignment (SoA_t guarantees it); in and
+//      out are disjoint or identical.
+
+inline constexpr size_t soa_block = 64; // [elements]
+
+// one block: r[rr][i] = sum_c m[rr][c] * src[c][i0 + i] for i < len (len <= soa_block)
+template <typename T, size_t N>
+inline void soa_transform_block(std::array<std::array<T, N>, N> const& m,
+                                std::array<T const*, N> const& src, size_t i0,
+                                size_t len, T (&r)[N][soa_block])
+{
+    for (size_t rr = 0; rr < N; ++rr) {
+        for (size_t i = 0; i < len; ++i) {
+            T s = m[rr][0] * src[0][i0 + i];
+            for (size_t c = 1; c < N; ++c) {
+                s += m[rr][c] * src[c][i0 + i];
+            }
+            r[rr][i] = s;
+        }
+    }
+}
+
+template <typename T, size_t N>
+void soa_transform(std::array<std::array<T, N>, N> const& k,
+                   std::array<T const*, N> const& in, std::array<T*, N> const& out,
+                   size_t n)
+{
+    std::array<std::array<T, N>, N> const m = k; // local copy: cannot alias out
+    alignas(soa_alignment) T r[N][soa_block];
+    size_t i0 = 0;
+    for (; i0 + soa_block <= n; i0 += soa_block) {
+        soa_transform_block(m, in, i0, soa_block, r);
+        for (size_t rr = 0; rr < N; ++rr) {
+            std::copy_n(r[rr], soa_block,
+                        std::assume_aligned<soa_alignment>(out[rr] + i0));
+        }
+    }
+    if (i0 < n) {
+        soa_transform_block(m, in, i0, n - i0, r);
+        for (size_t rr = 0; rr < N; ++rr) {
+            std::copy_n(r[rr], n - i0, std::assume_aligned<soa_alignment>(out[rr] + i0));
+        }
+    }
+}
+
+// single element: the matrix-vector product k * e (same summation order as the kernel)
+template <typename E>
+constexpr E matrix_apply(std::array<std::array<typename soa_traits<E>::value_type,
+                                               soa_traits<E>::ncomp>,
+                                    soa_traits<E>::ncomp> const& k,
+                         E const& e)
+{
+    using T = typename soa_traits<E>::value_type;
+    constexpr size_t N = soa_traits<E>::ncomp;
+    auto const a = soa_traits<E>::to_array(e);
+    std::array<T, N> r{};
+    for (size_t rr = 0; rr < N; ++rr) {
+        T s = k[rr][0] * a[0];
+        for (size_t c = 1; c < N; ++c) {
+            s += k[rr][c] * a[c];
+        }
+        r[rr] = s;
+    }
+    return soa_traits<E>::from_array(r);
+}
+
+// the matrix k rounded to value type T (a matrix built in the common type of motor and
+// elements, applied to elements of type T)
+template <typename T, typename U, size_t N>
+constexpr std::array<std::array<T, N>, N>
+matrix_cast(std::array<std::array<U, N>, N> const& k)
+{
+    std::array<std::array<T, N>, N> r{};
+    for (size_t rr = 0; rr < N; ++rr) {
+        for (size_t c = 0; c < N; ++c) {
+            r[rr][c] = static_cast<T>(k[rr][c]);
+        }
+    }
+    return r;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// AoS batch kernel: out[i] = k * in[i] for the elements of two spans
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+// The same matrix as above, applied to interleaved elements in caller-owned storage
+// (std::vector, std::array, a ring buffer, ...). Nothing is allocated. Every element is
+// read completely before its result is written, so out may be the same span as in (in
+// place).
+//
+// pre: in and out are disjoint or identical
+// throws std::invalid_argument if in and out differ in size
+
+template <typename E>
+void span_transform(std::array<std::array<typename soa_traits<E>::value_type,
+                                          soa_traits<E>::ncomp>,
+                               soa_traits<E>::ncomp> const& k,
+                    std::span<E const> in, std::span<E> out)
+{
+    if (in.size() != out.size()) {
+        throw std::invalid_argument(std::string("span_transform: in.size() = ") +
+                                    std::to_string(in.size()) +
+                                    std::string(" differs from out.size() = ") +
+                                    std::to_string(out.size()));
+    }
+    for (size_t i = 0; i < in.size(); ++i) {
+        out[i] = matrix_apply(k, in[i]);
+    }
+}
+
+// matrix of a linear map on E from the images of its basis elements: column c is
+// f(e_c), with e_c the element whose component c is 1 (all others 0)
+template <typename E, typename F>
+std::array<std::array<typename soa_traits<E>::value_type, soa_traits<E>::ncomp>,
+           soa_traits<E>::ncomp>
+soa_matrix(F&& f)
+{
+    using T = typename soa_traits<E>::value_type;
+    constexpr size_t N = soa_traits<E>::ncomp;
+    std::array<std::array<T, N>, N> k{};
+    for (size_t c = 0; c < N; ++c) {
+        std::array<T, N> basis{};
+        basis[c] = T(1);
+        auto const col = soa_traits<E>::to_array(f(soa_traits<E>::from_array(basis)));
+        for (size_t r = 0; r < N; ++r) {
+            k[r][c] = col[r];
+        }
+    }
+    return k;
+}
+
+} // namespace detail
+
+} // namespace hd::ga
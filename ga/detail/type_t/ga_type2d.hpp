@@ -11,6 +11,9 @@
 #include "ga_mvec2_t.hpp"
 #include "ga_mvec4_t.hpp"
 
+#include "ga_soa_t.hpp"   // batch transform kernels
+#include "ga_xform_t.hpp" // precomputed transform objects
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // consistent type and grade definitions (ega2d)
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +26,9 @@ template <typename T> using PScalar2d = Scalar_t<T, pscalar2d_tag>;
 template <typename T> using MVec2d_E = MVec2_t<T, mvec2d_e_tag>;
 template <typename T> using MVec2d = MVec4_t<T, mvec2d_tag>;
 
+// precomputed transform object of a rotor (see ga_xform_t.hpp)
+template <typename T> using Xform2d = Xform_t<Vec2d<T>>;
+
 // return the grades of the basic types
 
 template <typename T>
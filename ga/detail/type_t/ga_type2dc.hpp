@@ -14,6 +14,9 @@
 
 #include "ga_mvec2_t.hpp" // for DualNum2dc
 
+#include "ga_soa_t.hpp"   // batch transform kernels
+#include "ga_xform_t.hpp" // precomputed transform objects
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // consistent type and grade definitions in namespace hd::ga for cga2dc
 //
@@ -48,6 +51,9 @@ template <typename T> using MVec2dc = MVec16_t<T, mvec2dc_tag>;
 // which has a scalar part (c0 component) and a pseudoscalar part (c1 component)
 template <typename T> using DualNum2dc = MVec2_t<T, dual_number2dc_tag>;
 
+// precomputed transform object of a motor (see ga_xform_t.hpp)
+template <typename T> using Xform2dc = Xform_t<Vec2dc<T>, BiVec2dc<T>, TriVec2dc<T>>;
+
 // return the grades of the basic types
 
 template <typename T>
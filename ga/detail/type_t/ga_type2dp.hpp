@@ -14,6 +14,9 @@
 #include "ga_mvec2_t.hpp" // for DualNum2dp
 #include "ga_type2d.hpp"  // for Vec2d<T>
 
+#include "ga_soa_t.hpp"   // structure-of-arrays containers
+#include "ga_xform_t.hpp" // precomputed transform objects
+
 /////////////////////////////////////////////////////////////////////////////////////////
 //
 // consistent type and grade definitions for pga2dp (in namespace hd::ga)
@@ -39,6 +42,13 @@ template <typename T> using MVec2dp = MVec8_t<T, mvec2dp_tag>;
 // which has a scalar part (c0 component) and a pseudoscalar part (c1 component)
 template <typename T> using DualNum2dp = MVec2_t<T, dual_number2dp_tag>;
 
+// structure-of-arrays containers for batch transformations (see ga_soa_t.hpp)
+template <typename T> using Vec2dp_SoA = SoA_t<Vec2dp<T>>;
+template <typename T> using BiVec2dp_SoA = SoA_t<BiVec2dp<T>>;
+
+// precomputed transform object of a motor (see ga_xform_t.hpp)
+template <typename T> using Xform2dp = Xform_t<Vec2dp<T>, BiVec2dp<T>>;
+
 // return the grades of the basic types
 
 template <typename T>
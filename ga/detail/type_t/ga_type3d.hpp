@@ -11,6 +11,9 @@
 #include "ga_mvec4_t.hpp"
 #include "ga_mvec8_t.hpp"
 
+#include "ga_soa_t.hpp"   // batch transform kernels
+#include "ga_xform_t.hpp" // precomputed transform objects
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // consistent type and grade definitions (ega3d)
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +28,9 @@ template <typename T> using MVec3d_E = MVec4_t<T, mvec3d_e_tag>;
 template <typename T> using MVec3d_U = MVec4_t<T, mvec3d_u_tag>;
 template <typename T> using MVec3d = MVec8_t<T, mvec3d_tag>;
 
+// precomputed transform object of a rotor (see ga_xform_t.hpp)
+template <typename T> using Xform3d = Xform_t<Vec3d<T>, BiVec3d<T>>;
+
 // return the grades of the basic types
 
 template <typename T>
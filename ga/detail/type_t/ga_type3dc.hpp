@@ -14,6 +14,9 @@
 
 #include "ga_mvec2_t.hpp" // for DualNum3dc
 
+#include "ga_soa_t.hpp"   // batch transform kernels
+#include "ga_xform_t.hpp" // precomputed transform objects
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // consistent type and grade definitions in namespace hd::ga for cga3dc
 //
@@ -56,6 +59,10 @@ template <typename T> using MVec3dc = MVec32_t<T, mvec3dc_tag>;
 // which has a scalar part (c0 component) and a pseudoscalar part (c1 component)
 template <typename T> using DualNum3dc = MVec2_t<T, dual_number3dc_tag>;
 
+// precomputed transform object of a motor (see ga_xform_t.hpp)
+template <typename T>
+using Xform3dc = Xform_t<Vec3dc<T>, BiVec3dc<T>, TriVec3dc<T>, QuadVec3dc<T>>;
+
 // return the grades of the basic types
 
 template <typename T>
@@ -15,6 +15,9 @@
 #include "ga_mvec2_t.hpp" // for DualNum3dp
 #include "ga_type3d.hpp"  // for Vec3d<T>
 
+#include "ga_soa_t.hpp"   // structure-of-arrays containers
+#include "ga_xform_t.hpp" // precomputed transform objects
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // consistent type and grade definitions in namespace hd::ga for pga3dp
 // convenience type aliases in namespace hd::ga::pga (needed there for name resolution)
@@ -40,6 +43,14 @@ template <typename T> using MVec3dp = MVec16_t<T, mvec3dp_tag>;
 // which has a scalar part (c0 component) and a pseudoscalar part (c1 component)
 template <typename T> using DualNum3dp = MVec2_t<T, dual_number3dp_tag>;
 
+// structure-of-arrays containers for batch transformations (see ga_soa_t.hpp)
+template <typename T> using Vec3dp_SoA = SoA_t<Vec3dp<T>>;
+template <typename T> using BiVec3dp_SoA = SoA_t<BiVec3dp<T>>;
+template <typename T> using TriVec3dp_SoA = SoA_t<TriVec3dp<T>>;
+
+// precomputed transform object of a motor (see ga_xform_t.hpp)
+template <typename T> using Xform3dp = Xform_t<Vec3dp<T>, BiVec3dp<T>, TriVec3dp<T>>;
+
 // return the grades of the basic types
 
 template <typename T>
@@ -14,6 +14,9 @@
 
 #include "ga_mvec2_t.hpp" // for DualNum4ds
 
+#include "ga_soa_t.hpp"   // batch transform kernels
+#include "ga_xform_t.hpp" // precomputed transform objects
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // consistent type and grade definitions in namespace hd::ga for pga4ds
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +36,9 @@ template <typename T> using MVec4ds = MVec16_t<T, mvec4ds_tag>;
 // which has a scalar part (c0 component) and a pseudoscalar part (c1 component)
 template <typename T> using DualNum4ds = MVec2_t<T, dual_number4ds_tag>;
 
+// precomputed transform object of a rotor (see ga_xform_t.hpp)
+template <typename T> using Xform4ds = Xform_t<Vec4ds<T>, BiVec4ds<T>, TriVec4ds<T>>;
+
 // return the grades of the basic types
 
 template <typename T>
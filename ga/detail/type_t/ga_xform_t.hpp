@@ -0,0 +1,140 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+#include <array>   // std::array (transform matrix)
+#include <cstddef> // size_t
+#include <span>    // std::span (batch application)
+
+#include "ga_soa_t.hpp" // soa_traits, SoA_t and the batch kernels
+
+namespace hd::ga {
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// GradeXform_t<E> / Xform_t<E...>: precomputed transform objects
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+// A sandwich product with a fixed motor / rotor / versor is a LINEAR map on every grade
+// it acts on. move3dp_opt(v, M) and friends rebuild the coefficients of that map (the
+// h* products and the k11 ... k44 entries) on every call. When the same motor moves
+// many elements (one frame motor applied to all geometry of a body in every step), it
+// pays to build the matrices ONCE and keep them:
+//
+//   auto const xf = get_xform(M); // one N x N matrix per grade (e.g. points, lines,
+//                                 // planes in pga3dp)
+//   auto p1 = xf(p);              // single element: one matrix-vector product
+//   xf(pts_in, pts_out);          // batch: std::span (or std::vector) and SoA_t
+//   xf.apply_inplace(lines);      // batch in place
+//
+// GradeXform_t<E> holds the matrix for ONE grade E; Xform_t<E...> bundles the grades an
+// algebra's motors act on and dispatches on the element type. Both are trivially
+// copyable value types (a few std::arrays, no allocation), so they are cheap to cache
+// per frame.
+//
+// COMPOSITION is the matrix product: (a * b)(x) == a(b(x)), i.e. b is applied first.
+//
+// The matrices are obtained from the closed-form single-element functions applied to
+// the basis elements (detail::soa_matrix), or taken directly where a closed-form
+// coefficient matrix already exists (sta: sta_rotor_xf_mat_vec / _bivec). The per-
+// algebra factories get_xform() live with the ops of the algebra; the bundle types are
+// Xform2d, Xform3d, Xform2dp, Xform3dp, Xform4ds, Xform2dc and Xform3dc.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename E> class GradeXform_t {
+
+  public:
+
+    using element_type = E;
+    using value_type = typename soa_traits<E>::value_type;
+    static constexpr size_t ncomp = soa_traits<E>::ncomp;
+    using matrix_type = std::array<std::array<value_type, ncomp>, ncomp>;
+
+    // ctors: identity, or a given matrix (row r, column c: out_r = sum_c k[r][c] * in_c)
+    constexpr GradeXform_t()
+    {
+        for (size_t r = 0; r < ncomp; ++r) {
+            k_[r][r] = value_type(1);
+        }
+    }
+    constexpr explicit GradeXform_t(matrix_type const& k) : k_(k) {}
+
+    // matrix of the linear map f on E (f is evaluated once per basis element)
+    template <typename F> static GradeXform_t from_map(F&& f)
+    {
+        return GradeXform_t(detail::soa_matrix<E>(f));
+    }
+
+    constexpr matrix_type const& matrix() const { return k_; }
+
+    // single element
+    constexpr E operator()(E const& e) const { return detail::matrix_apply(k_, e); }
+
+    // batch on caller-owned AoS storage (no allocation): in and out must have the same
+    // size (throws std::invalid_argument) and be disjoint or identical
+    void operator()(std::span<E const> in, std::span<E> out) const
+    {
+        detail::span_transform<E>(k_, in, out);
+    }
+    void apply_inplace(std::span<E> v) const { detail::span_transform<E>(k_, v, v); }
+
+    // batch on SoA containers (vectorized kernel): out is resized to in.size()
+    void operator()(SoA_t<E> const& in, SoA_t<E>& out) const
+    {
+        out.resize(in.size());
+        detail::soa_transform(k_, in.data_ptrs(), out.data_ptrs(), in.size());
+    }
+    void apply_inplace(SoA_t<E>& v) const
+    {
+        SoA_t<E> const& cv = v;
+        detail::soa_transform(k_, cv.data_ptrs(), v.data_ptrs(), v.size());
+    }
+
+    // composition: (a * b)(x) == a(b(x))
+    friend constexpr GradeXform_t operator*(GradeXform_t const& a, GradeXform_t const& b)
+    {
+        matrix_type k{};
+        for (size_t r = 0; r < ncomp; ++r) {
+            for (size_t c = 0; c < ncomp; ++c) {
+                value_type s = a.k_[r][0] * b.k_[0][c];
+                for (size_t j = 1; j < ncomp; ++j) {
+                    s += a.k_[r][j] * b.k_[j][c];
+                }
+                k[r][c] = s;
+            }
+        }
+        return GradeXform_t(k);
+    }
+
+  private:
+
+    matrix_type k_{};
+};
+
+// one GradeXform_t per grade the motors of an algebra act on; the element types E...
+// must be distinct (they are: the grades differ by their type tags)
+template <typename... E> class Xform_t : private GradeXform_t<E>... {
+
+  public:
+
+    // identity on all grades
+    constexpr Xform_t() = default;
+    constexpr explicit Xform_t(GradeXform_t<E> const&... g) : GradeXform_t<E>(g)... {}
+
+    // the transform of a single grade, e.g. xf.grade<Vec3dp<T>>().matrix()
+    template <typename X> constexpr GradeXform_t<X> const& grade() const
+    {
+        return *this;
+    }
+
+    using GradeXform_t<E>::operator()...;
+    using GradeXform_t<E>::apply_inplace...;
+
+    // composition, grade by grade: (a * b)(x) == a(b(x))
+    friend constexpr Xform_t operator*(Xform_t const& a, Xform_t const& b)
+    {
+        return Xform_t((a.template grade<E>() * b.template grade<E>())...);
+    }
+};
+
+} // namespace hd::ga
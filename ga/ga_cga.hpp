@@ -42,6 +42,8 @@
                                       // inv, rinv, ...)
 #include "ga_cga3dc_ops.hpp"          // geometric operations (is_congruent, is_close;
                                       // layer under construction)
+#include "ga_cga3dc_ops_simd.hpp"     // SIMD backend for the full mv products (gpr_simd,
+                                      // wdg_simd, rwdg_simd, rgpr_simd)
 
 // fmt-support is defined outside of other namespaces
 #include "detail/ga_fmt_support.hpp" // printing support (fmt library)
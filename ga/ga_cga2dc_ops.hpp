@@ -6,9 +6,156 @@
 #include "ga_cga2dc_ops_basics.hpp"
 #include "ga_cga2dc_ops_products.hpp"
 
+#include <array>   // std::array (transform_opt coefficient matrices)
 #include <complex> // exp/log/sqrt of regressive versors (central subalgebra = C)
+#include <vector>  // std::vector (batch transform_opt)
 
 
+namespace hd::ga::detail {
+
+// Closed-form motor-sandwich matrices for cga::transform_opt(), kept in `detail` so the
+// binding generator skips them (like the sta rotor matrices). On each grade the sandwich
+// u' = M (v) u (v) rrev(M) is a linear map whose matrix entries are quadratic forms in
+// the motor coefficients M.c0..M.c7 with small integer coefficients; every distinct
+// product is collected into a named temporary once (aI = M.cI^2, bIJ = M.cI*M.cJ).
+//
+// ga_prdxpr has no sandwich code generation yet: the coefficients were obtained by
+// polarizing transform() on the basis motors (evaluating it for M = e_I and
+// M = e_I + e_J) and are cross-checked against transform() in the test suite. The
+// sandwich is exactly quadratic in M, so they hold for any even M, not only unit ones.
+//
+// Layout as detail::soa_matrix: out_r = sum_c k[r][c] * in_c, rows/cols in field order,
+// so the matrices feed span_transform() and GradeXform_t directly.
+
+// 4x4 matrix for the grade-1 (round point) sandwich; rows/cols ordered
+// (x,y,z,w) = (e1,e2,e3,e4). Uses 32 distinct products of the motor coefficients.
+template <typename T>
+constexpr std::array<std::array<T, 4>, 4> cga2dc_motor_xf_mat_vec(MVec2dc_E<T> const& M)
+{
+    T const a0 = M.c0 * M.c0, a1 = M.c1 * M.c1, a2 = M.c2 * M.c2, a3 = M.c3 * M.c3;
+    T const a4 = M.c4 * M.c4, a5 = M.c5 * M.c5, a6 = M.c6 * M.c6, a7 = M.c7 * M.c7;
+
+    T const b01 = M.c0 * M.c1, b02 = M.c0 * M.c2, b03 = M.c0 * M.c3, b04 = M.c0 * M.c4;
+    T const b05 = M.c0 * M.c5, b06 = M.c0 * M.c6, b13 = M.c1 * M.c3, b14 = M.c1 * M.c4;
+    T const b15 = M.c1 * M.c5, b16 = M.c1 * M.c6, b17 = M.c1 * M.c7, b23 = M.c2 * M.c3;
+    T const b24 = M.c2 * M.c4, b25 = M.c2 * M.c5, b26 = M.c2 * M.c6, b27 = M.c2 * M.c7;
+    T const b34 = M.c3 * M.c4, b35 = M.c3 * M.c5, b37 = M.c3 * M.c7, b46 = M.c4 * M.c6;
+    T const b47 = M.c4 * M.c7, b56 = M.c5 * M.c6, b57 = M.c5 * M.c7, b67 = M.c6 * M.c7;
+
+    std::array<std::array<T, 4>, 4> k{};
+    k[0][0] = a0 - a3 - a6 + a7 + T(2.0) * (-b14 + b25);
+    k[0][1] = T(2.0) * (-b03 - b15 - b24 + b67);
+    k[0][2] = T(2.0) * (b04 - b35 + b46 - b57);
+    k[0][3] = T(2.0) * (-b01 + b16 + b23 - b27);
+    k[1][0] = T(2.0) * (b03 - b15 - b24 - b67);
+    k[1][1] = a0 - a3 - a6 + a7 + T(2.0) * (b14 - b25);
+    k[1][2] = T(2.0) * (b05 + b34 + b47 + b56);
+    k[1][3] = T(2.0) * (-b02 - b13 + b17 + b26);
+    k[2][0] = T(2.0) * (-b01 - b16 - b23 - b27);
+    k[2][1] = T(2.0) * (-b02 + b13 + b17 - b26);
+    k[2][2] = a0 + a3 + a6 + a7 + T(2.0) * (b06 + b37);
+    k[2][3] = T(2.0) * (a1 + a2);
+    k[3][0] = T(2.0) * (b04 + b35 - b46 - b57);
+    k[3][1] = T(2.0) * (b05 - b34 + b47 - b56);
+    k[3][2] = T(2.0) * (a4 + a5);
+    k[3][3] = a0 + a3 + a6 + a7 + T(2.0) * (-b06 - b37);
+    return k;
+}
+
+// 6x6 matrix for the grade-2 (dipole / flat point) sandwich; rows/cols ordered
+// (vx,vy,vz,mx,my,mz) = (e31,e32,e12,e14,e24,e34). Uses 36 distinct products.
+template <typename T>
+constexpr std::array<std::array<T, 6>, 6> cga2dc_motor_xf_mat_bivec(MVec2dc_E<T> const& M)
+{
+    T const a0 = M.c0 * M.c0, a1 = M.c1 * M.c1, a2 = M.c2 * M.c2, a3 = M.c3 * M.c3;
+    T const a4 = M.c4 * M.c4, a5 = M.c5 * M.c5, a6 = M.c6 * M.c6, a7 = M.c7 * M.c7;
+
+    T const b01 = M.c0 * M.c1, b02 = M.c0 * M.c2, b03 = M.c0 * M.c3, b04 = M.c0 * M.c4;
+    T const b05 = M.c0 * M.c5, b06 = M.c0 * M.c6, b07 = M.c0 * M.c7, b12 = M.c1 * M.c2;
+    T const b13 = M.c1 * M.c3, b14 = M.c1 * M.c4, b15 = M.c1 * M.c5, b16 = M.c1 * M.c6;
+    T const b17 = M.c1 * M.c7, b23 = M.c2 * M.c3, b24 = M.c2 * M.c4, b25 = M.c2 * M.c5;
+    T const b26 = M.c2 * M.c6, b27 = M.c2 * M.c7, b34 = M.c3 * M.c4, b35 = M.c3 * M.c5;
+    T const b36 = M.c3 * M.c6, b37 = M.c3 * M.c7, b45 = M.c4 * M.c5, b46 = M.c4 * M.c6;
+    T const b47 = M.c4 * M.c7, b56 = M.c5 * M.c6, b57 = M.c5 * M.c7, b67 = M.c6 * M.c7;
+
+    std::array<std::array<T, 6>, 6> k{};
+    k[0][0] = -a0 + a3 - a6 + a7 + T(2.0) * (-b06 + b37);
+    k[0][1] = T(2.0) * (b03 + b07 + b36 + b67);
+    k[0][2] = T(2.0) * (-b02 - b13 - b17 - b26);
+    k[0][3] = T(2.0) * (-a1 + a2);
+    k[0][4] = -T(4.0) * b12;
+    k[0][5] = T(2.0) * (b01 + b16 - b23 - b27);
+    k[1][0] = T(2.0) * (-b03 - b07 - b36 - b67);
+    k[1][1] = -a0 + a3 - a6 + a7 + T(2.0) * (-b06 + b37);
+    k[1][2] = T(2.0) * (b01 + b16 - b23 - b27);
+    k[1][3] = -T(4.0) * b12;
+    k[1][4] = T(2.0) * (a1 - a2);
+    k[1][5] = T(2.0) * (b02 + b13 + b17 + b26);
+    k[2][0] = T(2.0) * (b05 - b34 - b47 + b56);
+    k[2][1] = T(2.0) * (-b04 - b35 - b46 - b57);
+    k[2][2] = -a0 - a3 + a6 + a7 + T(2.0) * (b14 + b25);
+    k[2][3] = T(2.0) * (b02 - b13 + b17 - b26);
+    k[2][4] = T(2.0) * (-b01 + b16 - b23 + b27);
+    k[2][5] = T(2.0) * (-b07 - b15 + b24 + b36);
+    k[3][0] = T(2.0) * (-a4 + a5);
+    k[3][1] = -T(4.0) * b45;
+    k[3][2] = T(2.0) * (-b05 - b34 + b47 + b56);
+    k[3][3] = -a0 + a3 - a6 + a7 + T(2.0) * (b06 - b37);
+    k[3][4] = T(2.0) * (b03 - b07 - b36 + b67);
+    k[3][5] = T(2.0) * (-b04 + b35 + b46 - b57);
+    k[4][0] = -T(4.0) * b45;
+    k[4][1] = T(2.0) * (a4 - a5);
+    k[4][2] = T(2.0) * (b04 - b35 - b46 + b57);
+    k[4][3] = T(2.0) * (-b03 + b07 + b36 - b67);
+    k[4][4] = -a0 + a3 - a6 + a7 + T(2.0) * (b06 - b37);
+    k[4][5] = T(2.0) * (-b05 - b34 + b47 + b56);
+    k[5][0] = T(2.0) * (-b04 - b35 - b46 - b57);
+    k[5][1] = T(2.0) * (-b05 + b34 + b47 - b56);
+    k[5][2] = T(2.0) * (b07 + b15 - b24 - b36);
+    k[5][3] = T(2.0) * (b01 - b16 + b23 - b27);
+    k[5][4] = T(2.0) * (b02 - b13 + b17 - b26);
+    k[5][5] = -a0 - a3 + a6 + a7 + T(2.0) * (b14 + b25);
+    return k;
+}
+
+// 4x4 matrix for the grade-3 (circle / line) sandwich; rows/cols ordered
+// (x,y,z,w) = (e314,e324,e124,e321). Uses 32 distinct products.
+template <typename T>
+constexpr std::array<std::array<T, 4>, 4>
+cga2dc_motor_xf_mat_trivec(MVec2dc_E<T> const& M)
+{
+    T const a0 = M.c0 * M.c0, a1 = M.c1 * M.c1, a2 = M.c2 * M.c2, a3 = M.c3 * M.c3;
+    T const a4 = M.c4 * M.c4, a5 = M.c5 * M.c5, a6 = M.c6 * M.c6, a7 = M.c7 * M.c7;
+
+    T const b01 = M.c0 * M.c1, b02 = M.c0 * M.c2, b03 = M.c0 * M.c3, b04 = M.c0 * M.c4;
+    T const b05 = M.c0 * M.c5, b06 = M.c0 * M.c6, b13 = M.c1 * M.c3, b14 = M.c1 * M.c4;
+    T const b15 = M.c1 * M.c5, b16 = M.c1 * M.c6, b17 = M.c1 * M.c7, b23 = M.c2 * M.c3;
+    T const b24 = M.c2 * M.c4, b25 = M.c2 * M.c5, b26 = M.c2 * M.c6, b27 = M.c2 * M.c7;
+    T const b34 = M.c3 * M.c4, b35 = M.c3 * M.c5, b37 = M.c3 * M.c7, b46 = M.c4 * M.c6;
+    T const b47 = M.c4 * M.c7, b56 = M.c5 * M.c6, b57 = M.c5 * M.c7, b67 = M.c6 * M.c7;
+
+    std::array<std::array<T, 4>, 4> k{};
+    k[0][0] = a0 - a3 - a6 + a7 + T(2.0) * (b14 - b25);
+    k[0][1] = T(2.0) * (-b03 + b15 + b24 + b67);
+    k[0][2] = T(2.0) * (b02 + b13 - b17 - b26);
+    k[0][3] = T(2.0) * (-b05 - b34 - b47 - b56);
+    k[1][0] = T(2.0) * (b03 + b15 + b24 - b67);
+    k[1][1] = a0 - a3 - a6 + a7 + T(2.0) * (-b14 + b25);
+    k[1][2] = T(2.0) * (-b01 + b16 + b23 - b27);
+    k[1][3] = T(2.0) * (b04 - b35 + b46 - b57);
+    k[2][0] = T(2.0) * (-b05 + b34 - b47 + b56);
+    k[2][1] = T(2.0) * (b04 + b35 - b46 - b57);
+    k[2][2] = a0 + a3 + a6 + a7 + T(2.0) * (-b06 - b37);
+    k[2][3] = T(2.0) * (a4 + a5);
+    k[3][0] = T(2.0) * (b02 - b13 - b17 + b26);
+    k[3][1] = T(2.0) * (-b01 - b16 - b23 - b27);
+    k[3][2] = T(2.0) * (a1 + a2);
+    k[3][3] = a0 + a3 + a6 + a7 + T(2.0) * (b06 + b37);
+    return k;
+}
+
+} // namespace hd::ga::detail
+
 namespace hd::ga::cga {
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +170,11 @@ namespace hd::ga::cga {
 // - get_rotation()          -> motor rotating by theta about a point
 // - get_dilation()          -> motor scaling by sigma about a point
 // - transform()             -> apply motor: sandwich M (v) u (v) rrev(M)
+//                              (single object or std::span batch)
+// - transform_opt()         -> closed-form transform (single object or
+//                              std::vector batch), all grades
+// - transform_inplace()     -> apply motor to a std::span batch in place
+// - get_xform()             -> precomputed motor transform (Xform2dc)
 // - invert_on()             -> inversion in a circle or line (flector sandwich)
 //
 // Object construction (grade encodes the object kind: round point = vector,
@@ -207,6 +359,185 @@ constexpr TriVec2dc<std::common_type_t<T, U>> transform(TriVec2dc<T> const& t,
     return gr3(rgpr(rgpr(M, t), rrev(M)));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// optimized closed-form transformation:  u' = M (v) u (v) rrev(M)
+//
+// The sandwich collapses to one matrix per grade acting on the components of u,
+// quadratic in the motor coefficients (built by the helpers in hd::ga::detail,
+// every distinct product M.ci*M.cj collected once). It replaces the two full
+// rgpr products of transform() by one matrix-vector product; the matrix depends
+// only on M, so the std::vector batch overloads below build it once and reuse it
+// for all elements (the bottleneck case: many spheres, circles or points moved by
+// one motor). The span overloads transform(in, M, out) and get_xform() use the
+// same matrices.
+//
+// validated against the direct transform() in the test suite.
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+constexpr Vec2dc<std::common_type_t<T, U>> transform_opt(Vec2dc<T> const& v,
+                                                         MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::matrix_apply(detail::cga2dc_motor_xf_mat_vec<ctype>(M),
+                                Vec2dc<ctype>(v));
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+constexpr BiVec2dc<std::common_type_t<T, U>> transform_opt(BiVec2dc<T> const& B,
+                                                           MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::matrix_apply(detail::cga2dc_motor_xf_mat_bivec<ctype>(M),
+                                BiVec2dc<ctype>(B));
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+constexpr TriVec2dc<std::common_type_t<T, U>> transform_opt(TriVec2dc<T> const& t,
+                                                            MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::matrix_apply(detail::cga2dc_motor_xf_mat_trivec<ctype>(M),
+                                TriVec2dc<ctype>(t));
+}
+
+// batch transformation of many objects by the SAME motor M: the matrix is built
+// once, then applied to every element (one matrix-vector product each).
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+std::vector<Vec2dc<std::common_type_t<T, U>>>
+transform_opt(std::vector<Vec2dc<T>> const& vecs, MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::cga2dc_motor_xf_mat_vec<ctype>(M);
+    std::vector<Vec2dc<ctype>> res;
+    res.reserve(vecs.size());
+    for (auto const& v : vecs) {
+        res.emplace_back(detail::matrix_apply(k, Vec2dc<ctype>(v)));
+    }
+    return res;
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+std::vector<BiVec2dc<std::common_type_t<T, U>>>
+transform_opt(std::vector<BiVec2dc<T>> const& bvecs, MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::cga2dc_motor_xf_mat_bivec<ctype>(M);
+    std::vector<BiVec2dc<ctype>> res;
+    res.reserve(bvecs.size());
+    for (auto const& B : bvecs) {
+        res.emplace_back(detail::matrix_apply(k, BiVec2dc<ctype>(B)));
+    }
+    return res;
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+std::vector<TriVec2dc<std::common_type_t<T, U>>>
+transform_opt(std::vector<TriVec2dc<T>> const& tvecs, MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::cga2dc_motor_xf_mat_trivec<ctype>(M);
+    std::vector<TriVec2dc<ctype>> res;
+    res.reserve(tvecs.size());
+    for (auto const& t : tvecs) {
+        res.emplace_back(detail::matrix_apply(k, TriVec2dc<ctype>(t)));
+    }
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// batch transformation on caller-owned storage (std::span over a std::vector,
+// std::array, a reused stream buffer, ...): nothing is allocated
+//
+//   transform(in, M, out)    out[i] = transform(in[i], M); in and out must have
+//                            the same size (throws std::invalid_argument) and
+//                            must be disjoint or identical
+//   transform_inplace(v, M)  overwrites v
+//
+// The matrix of the map on the grade is built once in closed form (as for
+// transform_opt()); every element then costs one matrix-vector product instead of
+// two full rgpr products (detail::span_transform). T is deduced
+// from out; a std::vector<Vec2dc<T>> converts implicitly to in, out is passed as
+// std::span(vec). The matrix is rounded to T.
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform(std::type_identity_t<std::span<Vec2dc<T> const>> in, MVec2dc_E<U> const& M,
+               std::span<Vec2dc<T>> out)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga2dc_motor_xf_mat_vec<ctype>(M));
+    detail::span_transform<Vec2dc<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<Vec2dc<T>> vec, MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga2dc_motor_xf_mat_vec<ctype>(M));
+    detail::span_transform<Vec2dc<T>>(k, vec, vec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform(std::type_identity_t<std::span<BiVec2dc<T> const>> in,
+               MVec2dc_E<U> const& M, std::span<BiVec2dc<T>> out)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga2dc_motor_xf_mat_bivec<ctype>(M));
+    detail::span_transform<BiVec2dc<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<BiVec2dc<T>> bvec, MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga2dc_motor_xf_mat_bivec<ctype>(M));
+    detail::span_transform<BiVec2dc<T>>(k, bvec, bvec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform(std::type_identity_t<std::span<TriVec2dc<T> const>> in,
+               MVec2dc_E<U> const& M, std::span<TriVec2dc<T>> out)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga2dc_motor_xf_mat_trivec<ctype>(M));
+    detail::span_transform<TriVec2dc<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<TriVec2dc<T>> tvec, MVec2dc_E<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga2dc_motor_xf_mat_trivec<ctype>(M));
+    detail::span_transform<TriVec2dc<T>>(k, tvec, tvec);
+}
+
+// precomputed motor transform (Xform2dc, see ga_xform_t.hpp): the closed-form matrices
+// of M on round points, dipoles / flat points and circles / lines (as for
+// transform_opt()) are built once and kept. Apply with xf(u), xf(in, out) or
+// xf.apply_inplace(v); compose with operator*: (xf2 * xf1)(x) == xf2(xf1(x)).
+template <typename T>
+    requires(numeric_type<T>)
+Xform2dc<T> get_xform(MVec2dc_E<T> const& M)
+{
+    return Xform2dc<T>(GradeXform_t<Vec2dc<T>>(detail::cga2dc_motor_xf_mat_vec(M)),
+                       GradeXform_t<BiVec2dc<T>>(detail::cga2dc_motor_xf_mat_bivec(M)),
+                       GradeXform_t<TriVec2dc<T>>(detail::cga2dc_motor_xf_mat_trivec(M)));
+}
+
 template <typename T, typename U>
     requires(numeric_type<T> && numeric_type<U>)
 constexpr Vec2dc<std::common_type_t<T, U>> invert_on(Vec2dc<T> const& v,
@@ -6,10 +6,514 @@
 #include "ga_cga3dc_ops_basics.hpp"
 #include "ga_cga3dc_ops_products.hpp"
 
+#include <array>   // std::array (transform_opt coefficient matrices)
 #include <complex> // exp/log/sqrt of regressive versors (central subalgebra = C)
 #include <limits>  // get_translation zero-direction guard
+#include <vector>  // std::vector (batch transform_opt)
 
 
+namespace hd::ga::detail {
+
+// Closed-form motor-sandwich matrices for cga::transform_opt(), kept in `detail` so the
+// binding generator skips them (like the sta rotor matrices). On each grade the sandwich
+// u' = M (v) u (v) rrev(M) is a linear map whose matrix entries are quadratic forms in
+// the motor coefficients M.c0..M.c15 with small integer coefficients; every distinct
+// product is collected into a named temporary once (aI = M.cI^2, bI_J = M.cI*M.cJ).
+//
+// ga_prdxpr has no sandwich code generation yet: the coefficients were obtained by
+// polarizing transform() on the basis motors (evaluating it for M = e_I and
+// M = e_I + e_J) and are cross-checked against transform() in the test suite. The
+// sandwich is exactly quadratic in M, so they hold for any odd M, not only unit ones.
+//
+// Layout as detail::soa_matrix: out_r = sum_c k[r][c] * in_c, rows/cols in field order,
+// so the matrices feed span_transform() and GradeXform_t directly.
+
+// 5x5 matrix for the grade-1 (round point) sandwich; rows/cols ordered
+// (x,y,z,w,u) = (e1,e2,e3,e4,e5). Uses 96 distinct products of the motor
+// coefficients.
+template <typename T>
+constexpr std::array<std::array<T, 5>, 5> cga3dc_motor_xf_mat_vec(MVec3dc_U<T> const& M)
+{
+    T const a0 = M.c0 * M.c0, a1 = M.c1 * M.c1, a2 = M.c2 * M.c2, a3 = M.c3 * M.c3;
+    T const a4 = M.c4 * M.c4, a5 = M.c5 * M.c5, a6 = M.c6 * M.c6, a7 = M.c7 * M.c7;
+    T const a8 = M.c8 * M.c8, a9 = M.c9 * M.c9, a10 = M.c10 * M.c10, a11 = M.c11 * M.c11;
+    T const a12 = M.c12 * M.c12, a13 = M.c13 * M.c13, a14 = M.c14 * M.c14;
+    T const a15 = M.c15 * M.c15;
+
+    T const b0_1 = M.c0 * M.c1, b0_2 = M.c0 * M.c2, b0_3 = M.c0 * M.c3;
+    T const b0_4 = M.c0 * M.c4, b0_5 = M.c0 * M.c5, b0_9 = M.c0 * M.c9;
+    T const b0_10 = M.c0 * M.c10, b0_12 = M.c0 * M.c12, b0_13 = M.c0 * M.c13;
+    T const b0_14 = M.c0 * M.c14, b1_2 = M.c1 * M.c2, b1_3 = M.c1 * M.c3;
+    T const b1_4 = M.c1 * M.c4, b1_6 = M.c1 * M.c6, b1_8 = M.c1 * M.c8;
+    T const b1_10 = M.c1 * M.c10, b1_11 = M.c1 * M.c11, b1_13 = M.c1 * M.c13;
+    T const b1_14 = M.c1 * M.c14, b2_3 = M.c2 * M.c3, b2_4 = M.c2 * M.c4;
+    T const b2_7 = M.c2 * M.c7, b2_8 = M.c2 * M.c8, b2_9 = M.c2 * M.c9;
+    T const b2_11 = M.c2 * M.c11, b2_12 = M.c2 * M.c12, b2_14 = M.c2 * M.c14;
+    T const b3_4 = M.c3 * M.c4, b3_5 = M.c3 * M.c5, b3_6 = M.c3 * M.c6;
+    T const b3_7 = M.c3 * M.c7, b3_8 = M.c3 * M.c8, b3_9 = M.c3 * M.c9;
+    T const b3_10 = M.c3 * M.c10, b4_5 = M.c4 * M.c5, b4_6 = M.c4 * M.c6;
+    T const b4_7 = M.c4 * M.c7, b4_11 = M.c4 * M.c11, b4_12 = M.c4 * M.c12;
+    T const b4_13 = M.c4 * M.c13, b5_6 = M.c5 * M.c6, b5_7 = M.c5 * M.c7;
+    T const b5_9 = M.c5 * M.c9, b5_10 = M.c5 * M.c10, b5_12 = M.c5 * M.c12;
+    T const b5_13 = M.c5 * M.c13, b5_15 = M.c5 * M.c15, b6_7 = M.c6 * M.c7;
+    T const b6_8 = M.c6 * M.c8, b6_10 = M.c6 * M.c10, b6_11 = M.c6 * M.c11;
+    T const b6_13 = M.c6 * M.c13, b6_15 = M.c6 * M.c15, b7_8 = M.c7 * M.c8;
+    T const b7_9 = M.c7 * M.c9, b7_11 = M.c7 * M.c11, b7_12 = M.c7 * M.c12;
+    T const b7_15 = M.c7 * M.c15, b8_11 = M.c8 * M.c11, b8_12 = M.c8 * M.c12;
+    T const b8_13 = M.c8 * M.c13, b8_14 = M.c8 * M.c14, b8_15 = M.c8 * M.c15;
+    T const b9_11 = M.c9 * M.c11, b9_12 = M.c9 * M.c12, b9_13 = M.c9 * M.c13;
+    T const b9_14 = M.c9 * M.c14, b9_15 = M.c9 * M.c15, b10_11 = M.c10 * M.c11;
+    T const b10_12 = M.c10 * M.c12, b10_13 = M.c10 * M.c13, b10_14 = M.c10 * M.c14;
+    T const b10_15 = M.c10 * M.c15, b11_14 = M.c11 * M.c14, b11_15 = M.c11 * M.c15;
+    T const b12_14 = M.c12 * M.c14, b12_15 = M.c12 * M.c15, b13_14 = M.c13 * M.c14;
+    T const b13_15 = M.c13 * M.c15, b14_15 = M.c14 * M.c15;
+
+    std::array<std::array<T, 5>, 5> k{};
+    k[0][0] = -a0 + a1 + a2 + a5 - a6 - a7 - a14 + a15 +
+              T(2.0) * (-b3_4 - b8_11 + b9_12 + b10_13);
+    k[0][1] = T(2.0) * (-b0_1 + b2_14 + b3_10 + b4_13 + b5_6 - b7_15 - b8_12 - b9_11);
+    k[0][2] = T(2.0) * (-b0_2 - b1_14 - b3_9 - b4_12 + b5_7 + b6_15 - b8_13 - b10_11);
+    k[0][3] = T(2.0) * (b0_4 - b1_10 + b2_9 - b4_5 + b6_10 - b7_9 - b8_14 + b8_15);
+    k[0][4] = T(2.0) * (b0_3 - b1_13 + b2_12 + b3_5 - b6_13 + b7_12 - b11_14 - b11_15);
+    k[1][0] = T(2.0) * (-b0_1 - b2_14 - b3_10 - b4_13 + b5_6 + b7_15 - b8_12 - b9_11);
+    k[1][1] = a0 - a1 + a2 - a5 + a6 - a7 - a14 + a15 +
+              T(2.0) * (-b3_4 + b8_11 - b9_12 + b10_13);
+    k[1][2] = T(2.0) * (b0_14 - b1_2 + b3_8 + b4_11 - b5_15 + b6_7 - b9_13 - b10_12);
+    k[1][3] = T(2.0) * (b0_10 + b1_4 - b2_8 - b4_6 - b5_10 + b7_8 - b9_14 + b9_15);
+    k[1][4] = T(2.0) * (b0_13 + b1_3 - b2_11 + b3_6 + b5_13 - b7_11 - b12_14 - b12_15);
+    k[2][0] = T(2.0) * (-b0_2 + b1_14 + b3_9 + b4_12 + b5_7 - b6_15 - b8_13 - b10_11);
+    k[2][1] = T(2.0) * (-b0_14 - b1_2 - b3_8 - b4_11 + b5_15 + b6_7 - b9_13 - b10_12);
+    k[2][2] = a0 + a1 - a2 - a5 - a6 + a7 - a14 + a15 +
+              T(2.0) * (-b3_4 + b8_11 + b9_12 - b10_13);
+    k[2][3] = T(2.0) * (-b0_9 + b1_8 + b2_4 - b4_7 + b5_9 - b6_8 - b10_14 + b10_15);
+    k[2][4] = T(2.0) * (-b0_12 + b1_11 + b2_3 + b3_7 - b5_12 + b6_11 - b13_14 - b13_15);
+    k[3][0] = T(2.0) * (-b0_3 - b1_13 + b2_12 + b3_5 + b6_13 - b7_12 + b11_14 - b11_15);
+    k[3][1] = T(2.0) * (b0_13 - b1_3 - b2_11 + b3_6 - b5_13 + b7_11 + b12_14 - b12_15);
+    k[3][2] = T(2.0) * (-b0_12 + b1_11 - b2_3 + b3_7 + b5_12 - b6_11 + b13_14 - b13_15);
+    k[3][3] = a0 + a1 + a2 + a5 + a6 + a7 + a14 + a15 +
+              T(2.0) * (-b0_5 - b1_6 - b2_7 - b14_15);
+    k[3][4] = T(2.0) * (a3 + a11 + a12 + a13);
+    k[4][0] = T(2.0) * (-b0_4 - b1_10 + b2_9 - b4_5 - b6_10 + b7_9 + b8_14 + b8_15);
+    k[4][1] = T(2.0) * (b0_10 - b1_4 - b2_8 - b4_6 + b5_10 - b7_8 + b9_14 + b9_15);
+    k[4][2] = T(2.0) * (-b0_9 + b1_8 - b2_4 - b4_7 - b5_9 + b6_8 + b10_14 + b10_15);
+    k[4][3] = T(2.0) * (a4 + a8 + a9 + a10);
+    k[4][4] = a0 + a1 + a2 + a5 + a6 + a7 + a14 + a15 +
+              T(2.0) * (b0_5 + b1_6 + b2_7 + b14_15);
+    return k;
+}
+
+// 10x10 matrix for the grade-2 (dipole / flat point) sandwich; rows/cols ordered
+// (vx,vy,vz,mx,my,mz,px,py,pz,pw) = (e41,e42,e43,e23,e31,e12,e15,e25,e35,e45).
+// Uses all 136 distinct products.
+template <typename T>
+constexpr std::array<std::array<T, 10>, 10>
+cga3dc_motor_xf_mat_bivec(MVec3dc_U<T> const& M)
+{
+    T const a0 = M.c0 * M.c0, a1 = M.c1 * M.c1, a2 = M.c2 * M.c2, a3 = M.c3 * M.c3;
+    T const a4 = M.c4 * M.c4, a5 = M.c5 * M.c5, a6 = M.c6 * M.c6, a7 = M.c7 * M.c7;
+    T const a8 = M.c8 * M.c8, a9 = M.c9 * M.c9, a10 = M.c10 * M.c10, a11 = M.c11 * M.c11;
+    T const a12 = M.c12 * M.c12, a13 = M.c13 * M.c13, a14 = M.c14 * M.c14;
+    T const a15 = M.c15 * M.c15;
+
+    T const b0_1 = M.c0 * M.c1, b0_2 = M.c0 * M.c2, b0_3 = M.c0 * M.c3;
+    T const b0_4 = M.c0 * M.c4, b0_5 = M.c0 * M.c5, b0_6 = M.c0 * M.c6;
+    T const b0_7 = M.c0 * M.c7, b0_8 = M.c0 * M.c8, b0_9 = M.c0 * M.c9;
+    T const b0_10 = M.c0 * M.c10, b0_11 = M.c0 * M.c11, b0_12 = M.c0 * M.c12;
+    T const b0_13 = M.c0 * M.c13, b0_14 = M.c0 * M.c14, b0_15 = M.c0 * M.c15;
+    T const b1_2 = M.c1 * M.c2, b1_3 = M.c1 * M.c3, b1_4 = M.c1 * M.c4;
+    T const b1_5 = M.c1 * M.c5, b1_6 = M.c1 * M.c6, b1_7 = M.c1 * M.c7;
+    T const b1_8 = M.c1 * M.c8, b1_9 = M.c1 * M.c9, b1_10 = M.c1 * M.c10;
+    T const b1_11 = M.c1 * M.c11, b1_12 = M.c1 * M.c12, b1_13 = M.c1 * M.c13;
+    T const b1_14 = M.c1 * M.c14, b1_15 = M.c1 * M.c15, b2_3 = M.c2 * M.c3;
+    T const b2_4 = M.c2 * M.c4, b2_5 = M.c2 * M.c5, b2_6 = M.c2 * M.c6;
+    T const b2_7 = M.c2 * M.c7, b2_8 = M.c2 * M.c8, b2_9 = M.c2 * M.c9;
+    T const b2_10 = M.c2 * M.c10, b2_11 = M.c2 * M.c11, b2_12 = M.c2 * M.c12;
+    T const b2_13 = M.c2 * M.c13, b2_14 = M.c2 * M.c14, b2_15 = M.c2 * M.c15;
+    T const b3_4 = M.c3 * M.c4, b3_5 = M.c3 * M.c5, b3_6 = M.c3 * M.c6;
+    T const b3_7 = M.c3 * M.c7, b3_8 = M.c3 * M.c8, b3_9 = M.c3 * M.c9;
+    T const b3_10 = M.c3 * M.c10, b3_11 = M.c3 * M.c11, b3_12 = M.c3 * M.c12;
+    T const b3_13 = M.c3 * M.c13, b3_14 = M.c3 * M.c14, b3_15 = M.c3 * M.c15;
+    T const b4_5 = M.c4 * M.c5, b4_6 = M.c4 * M.c6, b4_7 = M.c4 * M.c7;
+    T const b4_8 = M.c4 * M.c8, b4_9 = M.c4 * M.c9, b4_10 = M.c4 * M.c10;
+    T const b4_11 = M.c4 * M.c11, b4_12 = M.c4 * M.c12, b4_13 = M.c4 * M.c13;
+    T const b4_14 = M.c4 * M.c14, b4_15 = M.c4 * M.c15, b5_6 = M.c5 * M.c6;
+    T const b5_7 = M.c5 * M.c7, b5_8 = M.c5 * M.c8, b5_9 = M.c5 * M.c9;
+    T const b5_10 = M.c5 * M.c10, b5_11 = M.c5 * M.c11, b5_12 = M.c5 * M.c12;
+    T const b5_13 = M.c5 * M.c13, b5_14 = M.c5 * M.c14, b5_15 = M.c5 * M.c15;
+    T const b6_7 = M.c6 * M.c7, b6_8 = M.c6 * M.c8, b6_9 = M.c6 * M.c9;
+    T const b6_10 = M.c6 * M.c10, b6_11 = M.c6 * M.c11, b6_12 = M.c6 * M.c12;
+    T const b6_13 = M.c6 * M.c13, b6_14 = M.c6 * M.c14, b6_15 = M.c6 * M.c15;
+    T const b7_8 = M.c7 * M.c8, b7_9 = M.c7 * M.c9, b7_10 = M.c7 * M.c10;
+    T const b7_11 = M.c7 * M.c11, b7_12 = M.c7 * M.c12, b7_13 = M.c7 * M.c13;
+    T const b7_14 = M.c7 * M.c14, b7_15 = M.c7 * M.c15, b8_9 = M.c8 * M.c9;
+    T const b8_10 = M.c8 * M.c10, b8_11 = M.c8 * M.c11, b8_12 = M.c8 * M.c12;
+    T const b8_13 = M.c8 * M.c13, b8_14 = M.c8 * M.c14, b8_15 = M.c8 * M.c15;
+    T const b9_10 = M.c9 * M.c10, b9_11 = M.c9 * M.c11, b9_12 = M.c9 * M.c12;
+    T const b9_13 = M.c9 * M.c13, b9_14 = M.c9 * M.c14, b9_15 = M.c9 * M.c15;
+    T const b10_11 = M.c10 * M.c11, b10_12 = M.c10 * M.c12, b10_13 = M.c10 * M.c13;
+    T const b10_14 = M.c10 * M.c14, b10_15 = M.c10 * M.c15, b11_12 = M.c11 * M.c12;
+    T const b11_13 = M.c11 * M.c13, b11_14 = M.c11 * M.c14, b11_15 = M.c11 * M.c15;
+    T const b12_13 = M.c12 * M.c13, b12_14 = M.c12 * M.c14, b12_15 = M.c12 * M.c15;
+    T const b13_14 = M.c13 * M.c14, b13_15 = M.c13 * M.c15, b14_15 = M.c14 * M.c15;
+
+    std::array<std::array<T, 10>, 10> k{};
+    k[0][0] = a0 - a1 - a2 + a5 - a6 - a7 + a14 + a15 +
+              T(2.0) * (-b0_5 + b1_6 + b2_7 - b14_15);
+    k[0][1] = T(2.0) * (b0_1 - b0_6 - b1_5 - b2_14 + b2_15 + b5_6 + b7_14 - b7_15);
+    k[0][2] = T(2.0) * (b0_2 - b0_7 + b1_14 - b1_15 - b2_5 + b5_7 - b6_14 + b6_15);
+    k[0][3] = T(2.0) * (-b0_11 + b1_12 + b2_13 - b3_14 + b3_15 + b5_11 - b6_12 - b7_13);
+    k[0][4] = T(2.0) * (-b0_12 - b1_11 + b2_3 - b3_7 + b5_12 + b6_11 + b13_14 - b13_15);
+    k[0][5] = T(2.0) * (-b0_13 - b1_3 - b2_11 + b3_6 + b5_13 + b7_11 - b12_14 + b12_15);
+    k[0][6] = T(2.0) * (a3 + a11 - a12 - a13);
+    k[0][7] = T(4.0) * (-b3_13 + b11_12);
+    k[0][8] = T(4.0) * (b3_12 + b11_13);
+    k[0][9] = T(2.0) * (-b0_3 + b1_13 - b2_12 + b3_5 - b6_13 + b7_12 + b11_14 - b11_15);
+    k[1][0] = T(2.0) * (b0_1 - b0_6 - b1_5 + b2_14 - b2_15 + b5_6 - b7_14 + b7_15);
+    k[1][1] = -a0 + a1 - a2 - a5 + a6 - a7 + a14 + a15 +
+              T(2.0) * (b0_5 - b1_6 + b2_7 - b14_15);
+    k[1][2] = T(2.0) * (-b0_14 + b0_15 + b1_2 - b1_7 - b2_6 + b5_14 - b5_15 + b6_7);
+    k[1][3] = T(2.0) * (-b0_12 - b1_11 - b2_3 + b3_7 + b5_12 + b6_11 - b13_14 + b13_15);
+    k[1][4] = T(2.0) * (b0_11 - b1_12 + b2_13 - b3_14 + b3_15 - b5_11 + b6_12 - b7_13);
+    k[1][5] = T(2.0) * (b0_3 - b1_13 - b2_12 - b3_5 + b6_13 + b7_12 + b11_14 - b11_15);
+    k[1][6] = T(4.0) * (b3_13 + b11_12);
+    k[1][7] = T(2.0) * (a3 - a11 + a12 - a13);
+    k[1][8] = T(4.0) * (-b3_11 + b12_13);
+    k[1][9] = T(2.0) * (-b0_13 - b1_3 + b2_11 + b3_6 + b5_13 - b7_11 + b12_14 - b12_15);
+    k[2][0] = T(2.0) * (b0_2 - b0_7 - b1_14 + b1_15 - b2_5 + b5_7 + b6_14 - b6_15);
+    k[2][1] = T(2.0) * (b0_14 - b0_15 + b1_2 - b1_7 - b2_6 - b5_14 + b5_15 + b6_7);
+    k[2][2] = -a0 - a1 + a2 - a5 - a6 + a7 + a14 + a15 +
+              T(2.0) * (b0_5 + b1_6 - b2_7 - b14_15);
+    k[2][3] = T(2.0) * (-b0_13 + b1_3 - b2_11 - b3_6 + b5_13 + b7_11 + b12_14 - b12_15);
+    k[2][4] = T(2.0) * (-b0_3 - b1_13 - b2_12 + b3_5 + b6_13 + b7_12 - b11_14 + b11_15);
+    k[2][5] = T(2.0) * (b0_11 + b1_12 - b2_13 - b3_14 + b3_15 - b5_11 - b6_12 + b7_13);
+    k[2][6] = T(4.0) * (-b3_12 + b11_13);
+    k[2][7] = T(4.0) * (b3_11 + b12_13);
+    k[2][8] = T(2.0) * (a3 - a11 - a12 + a13);
+    k[2][9] = T(2.0) * (b0_12 - b1_11 - b2_3 + b3_7 - b5_12 + b6_11 + b13_14 - b13_15);
+    k[3][0] = T(2.0) * (-b0_8 + b1_9 + b2_10 - b4_14 + b4_15 + b5_8 - b6_9 - b7_10);
+    k[3][1] = T(2.0) * (-b0_9 - b1_8 + b2_4 - b4_7 + b5_9 + b6_8 + b10_14 - b10_15);
+    k[3][2] = T(2.0) * (-b0_10 - b1_4 - b2_8 + b4_6 + b5_10 + b7_8 - b9_14 + b9_15);
+    k[3][3] = -a0 + a1 + a2 + a5 - a6 - a7 - a14 + a15 +
+              T(2.0) * (b3_4 + b8_11 - b9_12 - b10_13);
+    k[3][4] = T(2.0) * (-b0_1 + b2_14 - b3_10 - b4_13 + b5_6 - b7_15 + b8_12 + b9_11);
+    k[3][5] = T(2.0) * (-b0_2 - b1_14 + b3_9 + b4_12 + b5_7 + b6_15 + b8_13 + b10_11);
+    k[3][6] = T(2.0) * (b0_11 - b1_12 - b2_13 + b3_14 + b3_15 + b5_11 - b6_12 - b7_13);
+    k[3][7] = T(2.0) * (b0_12 + b1_11 - b2_3 - b3_7 + b5_12 + b6_11 - b13_14 - b13_15);
+    k[3][8] = T(2.0) * (b0_13 + b1_3 + b2_11 + b3_6 + b5_13 + b7_11 + b12_14 + b12_15);
+    k[3][9] = T(2.0) * (-b0_15 + b1_7 - b2_6 + b3_8 - b4_11 + b5_14 - b9_13 + b10_12);
+    k[4][0] = T(2.0) * (-b0_9 - b1_8 - b2_4 + b4_7 + b5_9 + b6_8 - b10_14 + b10_15);
+    k[4][1] = T(2.0) * (b0_8 - b1_9 + b2_10 - b4_14 + b4_15 - b5_8 + b6_9 - b7_10);
+    k[4][2] = T(2.0) * (b0_4 - b1_10 - b2_9 - b4_5 + b6_10 + b7_9 + b8_14 - b8_15);
+    k[4][3] = T(2.0) * (-b0_1 - b2_14 + b3_10 + b4_13 + b5_6 + b7_15 + b8_12 + b9_11);
+    k[4][4] = a0 - a1 + a2 - a5 + a6 - a7 - a14 + a15 +
+              T(2.0) * (b3_4 - b8_11 + b9_12 - b10_13);
+    k[4][5] = T(2.0) * (b0_14 - b1_2 - b3_8 - b4_11 - b5_15 + b6_7 + b9_13 + b10_12);
+    k[4][6] = T(2.0) * (b0_12 + b1_11 + b2_3 + b3_7 + b5_12 + b6_11 + b13_14 + b13_15);
+    k[4][7] = T(2.0) * (-b0_11 + b1_12 - b2_13 + b3_14 + b3_15 - b5_11 + b6_12 - b7_13);
+    k[4][8] = T(2.0) * (-b0_3 + b1_13 + b2_12 - b3_5 + b6_13 + b7_12 - b11_14 - b11_15);
+    k[4][9] = T(2.0) * (-b0_7 - b1_15 + b2_5 + b3_9 - b4_12 + b6_14 + b8_13 - b10_11);
+    k[5][0] = T(2.0) * (-b0_10 + b1_4 - b2_8 - b4_6 + b5_10 + b7_8 + b9_14 - b9_15);
+    k[5][1] = T(2.0) * (-b0_4 - b1_10 - b2_9 + b4_5 + b6_10 + b7_9 - b8_14 + b8_15);
+    k[5][2] = T(2.0) * (b0_8 + b1_9 - b2_10 - b4_14 + b4_15 - b5_8 - b6_9 + b7_10);
+    k[5][3] = T(2.0) * (-b0_2 + b1_14 - b3_9 - b4_12 + b5_7 - b6_15 + b8_13 + b10_11);
+    k[5][4] = T(2.0) * (-b0_14 - b1_2 + b3_8 + b4_11 + b5_15 + b6_7 + b9_13 + b10_12);
+    k[5][5] = a0 + a1 - a2 - a5 - a6 + a7 - a14 + a15 +
+              T(2.0) * (b3_4 - b8_11 - b9_12 + b10_13);
+    k[5][6] = T(2.0) * (b0_13 - b1_3 + b2_11 - b3_6 + b5_13 + b7_11 - b12_14 - b12_15);
+    k[5][7] = T(2.0) * (b0_3 + b1_13 + b2_12 + b3_5 + b6_13 + b7_12 + b11_14 + b11_15);
+    k[5][8] = T(2.0) * (-b0_11 - b1_12 + b2_13 + b3_14 + b3_15 - b5_11 - b6_12 + b7_13);
+    k[5][9] = T(2.0) * (b0_6 - b1_5 - b2_15 + b3_10 - b4_13 + b7_14 - b8_12 + b9_11);
+    k[6][0] = T(2.0) * (a4 + a8 - a9 - a10);
+    k[6][1] = T(4.0) * (-b4_10 + b8_9);
+    k[6][2] = T(4.0) * (b4_9 + b8_10);
+    k[6][3] = T(2.0) * (b0_8 - b1_9 - b2_10 + b4_14 + b4_15 + b5_8 - b6_9 - b7_10);
+    k[6][4] = T(2.0) * (b0_9 + b1_8 - b2_4 - b4_7 + b5_9 + b6_8 - b10_14 - b10_15);
+    k[6][5] = T(2.0) * (b0_10 + b1_4 + b2_8 + b4_6 + b5_10 + b7_8 + b9_14 + b9_15);
+    k[6][6] = a0 - a1 - a2 + a5 - a6 - a7 + a14 + a15 +
+              T(2.0) * (b0_5 - b1_6 - b2_7 + b14_15);
+    k[6][7] = T(2.0) * (b0_1 + b0_6 + b1_5 - b2_14 - b2_15 + b5_6 - b7_14 - b7_15);
+    k[6][8] = T(2.0) * (b0_2 + b0_7 + b1_14 + b1_15 + b2_5 + b5_7 + b6_14 + b6_15);
+    k[6][9] = T(2.0) * (-b0_4 + b1_10 - b2_9 - b4_5 + b6_10 - b7_9 + b8_14 + b8_15);
+    k[7][0] = T(4.0) * (b4_10 + b8_9);
+    k[7][1] = T(2.0) * (a4 - a8 + a9 - a10);
+    k[7][2] = T(4.0) * (-b4_8 + b9_10);
+    k[7][3] = T(2.0) * (b0_9 + b1_8 + b2_4 + b4_7 + b5_9 + b6_8 + b10_14 + b10_15);
+    k[7][4] = T(2.0) * (-b0_8 + b1_9 - b2_10 + b4_14 + b4_15 - b5_8 + b6_9 - b7_10);
+    k[7][5] = T(2.0) * (-b0_4 + b1_10 + b2_9 - b4_5 + b6_10 + b7_9 - b8_14 - b8_15);
+    k[7][6] = T(2.0) * (b0_1 + b0_6 + b1_5 + b2_14 + b2_15 + b5_6 + b7_14 + b7_15);
+    k[7][7] = -a0 + a1 - a2 - a5 + a6 - a7 + a14 + a15 +
+              T(2.0) * (-b0_5 + b1_6 - b2_7 + b14_15);
+    k[7][8] = T(2.0) * (-b0_14 - b0_15 + b1_2 + b1_7 + b2_6 - b5_14 - b5_15 + b6_7);
+    k[7][9] = T(2.0) * (-b0_10 - b1_4 + b2_8 - b4_6 - b5_10 + b7_8 + b9_14 + b9_15);
+    k[8][0] = T(4.0) * (-b4_9 + b8_10);
+    k[8][1] = T(4.0) * (b4_8 + b9_10);
+    k[8][2] = T(2.0) * (a4 - a8 - a9 + a10);
+    k[8][3] = T(2.0) * (b0_10 - b1_4 + b2_8 - b4_6 + b5_10 + b7_8 - b9_14 - b9_15);
+    k[8][4] = T(2.0) * (b0_4 + b1_10 + b2_9 + b4_5 + b6_10 + b7_9 + b8_14 + b8_15);
+    k[8][5] = T(2.0) * (-b0_8 - b1_9 + b2_10 + b4_14 + b4_15 - b5_8 - b6_9 + b7_10);
+    k[8][6] = T(2.0) * (b0_2 + b0_7 - b1_14 - b1_15 + b2_5 + b5_7 - b6_14 - b6_15);
+    k[8][7] = T(2.0) * (b0_14 + b0_15 + b1_2 + b1_7 + b2_6 + b5_14 + b5_15 + b6_7);
+    k[8][8] = -a0 - a1 + a2 - a5 - a6 + a7 + a14 + a15 +
+              T(2.0) * (-b0_5 - b1_6 + b2_7 + b14_15);
+    k[8][9] = T(2.0) * (b0_9 - b1_8 - b2_4 - b4_7 + b5_9 - b6_8 + b10_14 + b10_15);
+    k[9][0] = T(2.0) * (b0_4 + b1_10 - b2_9 - b4_5 - b6_10 + b7_9 - b8_14 + b8_15);
+    k[9][1] = T(2.0) * (-b0_10 + b1_4 + b2_8 - b4_6 + b5_10 - b7_8 - b9_14 + b9_15);
+    k[9][2] = T(2.0) * (b0_9 - b1_8 + b2_4 - b4_7 - b5_9 + b6_8 - b10_14 + b10_15);
+    k[9][3] = T(2.0) * (b0_15 + b1_7 - b2_6 + b3_8 - b4_11 - b5_14 + b9_13 - b10_12);
+    k[9][4] = T(2.0) * (-b0_7 + b1_15 + b2_5 + b3_9 - b4_12 - b6_14 - b8_13 + b10_11);
+    k[9][5] = T(2.0) * (b0_6 - b1_5 + b2_15 + b3_10 - b4_13 - b7_14 + b8_12 - b9_11);
+    k[9][6] = T(2.0) * (b0_3 + b1_13 - b2_12 + b3_5 + b6_13 - b7_12 - b11_14 - b11_15);
+    k[9][7] = T(2.0) * (-b0_13 + b1_3 + b2_11 + b3_6 - b5_13 + b7_11 - b12_14 - b12_15);
+    k[9][8] = T(2.0) * (b0_12 - b1_11 + b2_3 + b3_7 + b5_12 - b6_11 - b13_14 - b13_15);
+    k[9][9] = -a0 - a1 - a2 + a5 + a6 + a7 - a14 + a15 +
+              T(2.0) * (-b3_4 - b8_11 - b9_12 - b10_13);
+    return k;
+}
+
+// 10x10 matrix for the grade-3 (circle / line) sandwich; rows/cols ordered
+// (vx,vy,vz,mx,my,mz,px,py,pz,pw) =
+// (e415,e425,e435,e235,e315,e125,e423,e431,e412,e321). Uses all 136 distinct products.
+template <typename T>
+constexpr std::array<std::array<T, 10>, 10>
+cga3dc_motor_xf_mat_trivec(MVec3dc_U<T> const& M)
+{
+    T const a0 = M.c0 * M.c0, a1 = M.c1 * M.c1, a2 = M.c2 * M.c2, a3 = M.c3 * M.c3;
+    T const a4 = M.c4 * M.c4, a5 = M.c5 * M.c5, a6 = M.c6 * M.c6, a7 = M.c7 * M.c7;
+    T const a8 = M.c8 * M.c8, a9 = M.c9 * M.c9, a10 = M.c10 * M.c10, a11 = M.c11 * M.c11;
+    T const a12 = M.c12 * M.c12, a13 = M.c13 * M.c13, a14 = M.c14 * M.c14;
+    T const a15 = M.c15 * M.c15;
+
+    T const b0_1 = M.c0 * M.c1, b0_2 = M.c0 * M.c2, b0_3 = M.c0 * M.c3;
+    T const b0_4 = M.c0 * M.c4, b0_5 = M.c0 * M.c5, b0_6 = M.c0 * M.c6;
+    T const b0_7 = M.c0 * M.c7, b0_8 = M.c0 * M.c8, b0_9 = M.c0 * M.c9;
+    T const b0_10 = M.c0 * M.c10, b0_11 = M.c0 * M.c11, b0_12 = M.c0 * M.c12;
+    T const b0_13 = M.c0 * M.c13, b0_14 = M.c0 * M.c14, b0_15 = M.c0 * M.c15;
+    T const b1_2 = M.c1 * M.c2, b1_3 = M.c1 * M.c3, b1_4 = M.c1 * M.c4;
+    T const b1_5 = M.c1 * M.c5, b1_6 = M.c1 * M.c6, b1_7 = M.c1 * M.c7;
+    T const b1_8 = M.c1 * M.c8, b1_9 = M.c1 * M.c9, b1_10 = M.c1 * M.c10;
+    T const b1_11 = M.c1 * M.c11, b1_12 = M.c1 * M.c12, b1_13 = M.c1 * M.c13;
+    T const b1_14 = M.c1 * M.c14, b1_15 = M.c1 * M.c15, b2_3 = M.c2 * M.c3;
+    T const b2_4 = M.c2 * M.c4, b2_5 = M.c2 * M.c5, b2_6 = M.c2 * M.c6;
+    T const b2_7 = M.c2 * M.c7, b2_8 = M.c2 * M.c8, b2_9 = M.c2 * M.c9;
+    T const b2_10 = M.c2 * M.c10, b2_11 = M.c2 * M.c11, b2_12 = M.c2 * M.c12;
+    T const b2_13 = M.c2 * M.c13, b2_14 = M.c2 * M.c14, b2_15 = M.c2 * M.c15;
+    T const b3_4 = M.c3 * M.c4, b3_5 = M.c3 * M.c5, b3_6 = M.c3 * M.c6;
+    T const b3_7 = M.c3 * M.c7, b3_8 = M.c3 * M.c8, b3_9 = M.c3 * M.c9;
+    T const b3_10 = M.c3 * M.c10, b3_11 = M.c3 * M.c11, b3_12 = M.c3 * M.c12;
+    T const b3_13 = M.c3 * M.c13, b3_14 = M.c3 * M.c14, b3_15 = M.c3 * M.c15;
+    T const b4_5 = M.c4 * M.c5, b4_6 = M.c4 * M.c6, b4_7 = M.c4 * M.c7;
+    T const b4_8 = M.c4 * M.c8, b4_9 = M.c4 * M.c9, b4_10 = M.c4 * M.c10;
+    T const b4_11 = M.c4 * M.c11, b4_12 = M.c4 * M.c12, b4_13 = M.c4 * M.c13;
+    T const b4_14 = M.c4 * M.c14, b4_15 = M.c4 * M.c15, b5_6 = M.c5 * M.c6;
+    T const b5_7 = M.c5 * M.c7, b5_8 = M.c5 * M.c8, b5_9 = M.c5 * M.c9;
+    T const b5_10 = M.c5 * M.c10, b5_11 = M.c5 * M.c11, b5_12 = M.c5 * M.c12;
+    T const b5_13 = M.c5 * M.c13, b5_14 = M.c5 * M.c14, b5_15 = M.c5 * M.c15;
+    T const b6_7 = M.c6 * M.c7, b6_8 = M.c6 * M.c8, b6_9 = M.c6 * M.c9;
+    T const b6_10 = M.c6 * M.c10, b6_11 = M.c6 * M.c11, b6_12 = M.c6 * M.c12;
+    T const b6_13 = M.c6 * M.c13, b6_14 = M.c6 * M.c14, b6_15 = M.c6 * M.c15;
+    T const b7_8 = M.c7 * M.c8, b7_9 = M.c7 * M.c9, b7_10 = M.c7 * M.c10;
+    T const b7_11 = M.c7 * M.c11, b7_12 = M.c7 * M.c12, b7_13 = M.c7 * M.c13;
+    T const b7_14 = M.c7 * M.c14, b7_15 = M.c7 * M.c15, b8_9 = M.c8 * M.c9;
+    T const b8_10 = M.c8 * M.c10, b8_11 = M.c8 * M.c11, b8_12 = M.c8 * M.c12;
+    T const b8_13 = M.c8 * M.c13, b8_14 = M.c8 * M.c14, b8_15 = M.c8 * M.c15;
+    T const b9_10 = M.c9 * M.c10, b9_11 = M.c9 * M.c11, b9_12 = M.c9 * M.c12;
+    T const b9_13 = M.c9 * M.c13, b9_14 = M.c9 * M.c14, b9_15 = M.c9 * M.c15;
+    T const b10_11 = M.c10 * M.c11, b10_12 = M.c10 * M.c12, b10_13 = M.c10 * M.c13;
+    T const b10_14 = M.c10 * M.c14, b10_15 = M.c10 * M.c15, b11_12 = M.c11 * M.c12;
+    T const b11_13 = M.c11 * M.c13, b11_14 = M.c11 * M.c14, b11_15 = M.c11 * M.c15;
+    T const b12_13 = M.c12 * M.c13, b12_14 = M.c12 * M.c14, b12_15 = M.c12 * M.c15;
+    T const b13_14 = M.c13 * M.c14, b13_15 = M.c13 * M.c15, b14_15 = M.c14 * M.c15;
+
+    std::array<std::array<T, 10>, 10> k{};
+    k[0][0] = -a0 + a1 + a2 + a5 - a6 - a7 - a14 + a15 +
+              T(2.0) * (b3_4 + b8_11 - b9_12 - b10_13);
+    k[0][1] = T(2.0) * (-b0_1 + b2_14 - b3_10 - b4_13 + b5_6 - b7_15 + b8_12 + b9_11);
+    k[0][2] = T(2.0) * (-b0_2 - b1_14 + b3_9 + b4_12 + b5_7 + b6_15 + b8_13 + b10_11);
+    k[0][3] = T(2.0) * (b0_11 - b1_12 - b2_13 + b3_14 + b3_15 + b5_11 - b6_12 - b7_13);
+    k[0][4] = T(2.0) * (b0_12 + b1_11 - b2_3 - b3_7 + b5_12 + b6_11 - b13_14 - b13_15);
+    k[0][5] = T(2.0) * (b0_13 + b1_3 + b2_11 + b3_6 + b5_13 + b7_11 + b12_14 + b12_15);
+    k[0][6] = T(2.0) * (-b0_8 + b1_9 + b2_10 - b4_14 + b4_15 + b5_8 - b6_9 - b7_10);
+    k[0][7] = T(2.0) * (-b0_9 - b1_8 + b2_4 - b4_7 + b5_9 + b6_8 + b10_14 - b10_15);
+    k[0][8] = T(2.0) * (-b0_10 - b1_4 - b2_8 + b4_6 + b5_10 + b7_8 - b9_14 + b9_15);
+    k[0][9] = T(2.0) * (b0_15 - b1_7 + b2_6 - b3_8 + b4_11 - b5_14 + b9_13 - b10_12);
+    k[1][0] = T(2.0) * (-b0_1 - b2_14 + b3_10 + b4_13 + b5_6 + b7_15 + b8_12 + b9_11);
+    k[1][1] = a0 - a1 + a2 - a5 + a6 - a7 - a14 + a15 +
+              T(2.0) * (b3_4 - b8_11 + b9_12 - b10_13);
+    k[1][2] = T(2.0) * (b0_14 - b1_2 - b3_8 - b4_11 - b5_15 + b6_7 + b9_13 + b10_12);
+    k[1][3] = T(2.0) * (b0_12 + b1_11 + b2_3 + b3_7 + b5_12 + b6_11 + b13_14 + b13_15);
+    k[1][4] = T(2.0) * (-b0_11 + b1_12 - b2_13 + b3_14 + b3_15 - b5_11 + b6_12 - b7_13);
+    k[1][5] = T(2.0) * (-b0_3 + b1_13 + b2_12 - b3_5 + b6_13 + b7_12 - b11_14 - b11_15);
+    k[1][6] = T(2.0) * (-b0_9 - b1_8 - b2_4 + b4_7 + b5_9 + b6_8 - b10_14 + b10_15);
+    k[1][7] = T(2.0) * (b0_8 - b1_9 + b2_10 - b4_14 + b4_15 - b5_8 + b6_9 - b7_10);
+    k[1][8] = T(2.0) * (b0_4 - b1_10 - b2_9 - b4_5 + b6_10 + b7_9 + b8_14 - b8_15);
+    k[1][9] = T(2.0) * (b0_7 + b1_15 - b2_5 - b3_9 + b4_12 - b6_14 - b8_13 + b10_11);
+    k[2][0] = T(2.0) * (-b0_2 + b1_14 - b3_9 - b4_12 + b5_7 - b6_15 + b8_13 + b10_11);
+    k[2][1] = T(2.0) * (-b0_14 - b1_2 + b3_8 + b4_11 + b5_15 + b6_7 + b9_13 + b10_12);
+    k[2][2] = a0 + a1 - a2 - a5 - a6 + a7 - a14 + a15 +
+              T(2.0) * (b3_4 - b8_11 - b9_12 + b10_13);
+    k[2][3] = T(2.0) * (b0_13 - b1_3 + b2_11 - b3_6 + b5_13 + b7_11 - b12_14 - b12_15);
+    k[2][4] = T(2.0) * (b0_3 + b1_13 + b2_12 + b3_5 + b6_13 + b7_12 + b11_14 + b11_15);
+    k[2][5] = T(2.0) * (-b0_11 - b1_12 + b2_13 + b3_14 + b3_15 - b5_11 - b6_12 + b7_13);
+    k[2][6] = T(2.0) * (-b0_10 + b1_4 - b2_8 - b4_6 + b5_10 + b7_8 + b9_14 - b9_15);
+    k[2][7] = T(2.0) * (-b0_4 - b1_10 - b2_9 + b4_5 + b6_10 + b7_9 - b8_14 + b8_15);
+    k[2][8] = T(2.0) * (b0_8 + b1_9 - b2_10 - b4_14 + b4_15 - b5_8 - b6_9 + b7_10);
+    k[2][9] = T(2.0) * (-b0_6 + b1_5 + b2_15 - b3_10 + b4_13 - b7_14 + b8_12 - b9_11);
+    k[3][0] = T(2.0) * (b0_8 - b1_9 - b2_10 + b4_14 + b4_15 + b5_8 - b6_9 - b7_10);
+    k[3][1] = T(2.0) * (b0_9 + b1_8 - b2_4 - b4_7 + b5_9 + b6_8 - b10_14 - b10_15);
+    k[3][2] = T(2.0) * (b0_10 + b1_4 + b2_8 + b4_6 + b5_10 + b7_8 + b9_14 + b9_15);
+    k[3][3] = a0 - a1 - a2 + a5 - a6 - a7 + a14 + a15 +
+              T(2.0) * (b0_5 - b1_6 - b2_7 + b14_15);
+    k[3][4] = T(2.0) * (b0_1 + b0_6 + b1_5 - b2_14 - b2_15 + b5_6 - b7_14 - b7_15);
+    k[3][5] = T(2.0) * (b0_2 + b0_7 + b1_14 + b1_15 + b2_5 + b5_7 + b6_14 + b6_15);
+    k[3][6] = T(2.0) * (a4 + a8 - a9 - a10);
+    k[3][7] = T(4.0) * (-b4_10 + b8_9);
+    k[3][8] = T(4.0) * (b4_9 + b8_10);
+    k[3][9] = T(2.0) * (b0_4 - b1_10 + b2_9 + b4_5 - b6_10 + b7_9 - b8_14 - b8_15);
+    k[4][0] = T(2.0) * (b0_9 + b1_8 + b2_4 + b4_7 + b5_9 + b6_8 + b10_14 + b10_15);
+    k[4][1] = T(2.0) * (-b0_8 + b1_9 - b2_10 + b4_14 + b4_15 - b5_8 + b6_9 - b7_10);
+    k[4][2] = T(2.0) * (-b0_4 + b1_10 + b2_9 - b4_5 + b6_10 + b7_9 - b8_14 - b8_15);
+    k[4][3] = T(2.0) * (b0_1 + b0_6 + b1_5 + b2_14 + b2_15 + b5_6 + b7_14 + b7_15);
+    k[4][4] = -a0 + a1 - a2 - a5 + a6 - a7 + a14 + a15 +
+              T(2.0) * (-b0_5 + b1_6 - b2_7 + b14_15);
+    k[4][5] = T(2.0) * (-b0_14 - b0_15 + b1_2 + b1_7 + b2_6 - b5_14 - b5_15 + b6_7);
+    k[4][6] = T(4.0) * (b4_10 + b8_9);
+    k[4][7] = T(2.0) * (a4 - a8 + a9 - a10);
+    k[4][8] = T(4.0) * (-b4_8 + b9_10);
+    k[4][9] = T(2.0) * (b0_10 + b1_4 - b2_8 + b4_6 + b5_10 - b7_8 - b9_14 - b9_15);
+    k[5][0] = T(2.0) * (b0_10 - b1_4 + b2_8 - b4_6 + b5_10 + b7_8 - b9_14 - b9_15);
+    k[5][1] = T(2.0) * (b0_4 + b1_10 + b2_9 + b4_5 + b6_10 + b7_9 + b8_14 + b8_15);
+    k[5][2] = T(2.0) * (-b0_8 - b1_9 + b2_10 + b4_14 + b4_15 - b5_8 - b6_9 + b7_10);
+    k[5][3] = T(2.0) * (b0_2 + b0_7 - b1_14 - b1_15 + b2_5 + b5_7 - b6_14 - b6_15);
+    k[5][4] = T(2.0) * (b0_14 + b0_15 + b1_2 + b1_7 + b2_6 + b5_14 + b5_15 + b6_7);
+    k[5][5] = -a0 - a1 + a2 - a5 - a6 + a7 + a14 + a15 +
+              T(2.0) * (-b0_5 - b1_6 + b2_7 + b14_15);
+    k[5][6] = T(4.0) * (-b4_9 + b8_10);
+    k[5][7] = T(4.0) * (b4_8 + b9_10);
+    k[5][8] = T(2.0) * (a4 - a8 - a9 + a10);
+    k[5][9] = T(2.0) * (-b0_9 + b1_8 + b2_4 + b4_7 - b5_9 + b6_8 - b10_14 - b10_15);
+    k[6][0] = T(2.0) * (-b0_11 + b1_12 + b2_13 - b3_14 + b3_15 + b5_11 - b6_12 - b7_13);
+    k[6][1] = T(2.0) * (-b0_12 - b1_11 + b2_3 - b3_7 + b5_12 + b6_11 + b13_14 - b13_15);
+    k[6][2] = T(2.0) * (-b0_13 - b1_3 - b2_11 + b3_6 + b5_13 + b7_11 - b12_14 + b12_15);
+    k[6][3] = T(2.0) * (a3 + a11 - a12 - a13);
+    k[6][4] = T(4.0) * (-b3_13 + b11_12);
+    k[6][5] = T(4.0) * (b3_12 + b11_13);
+    k[6][6] = a0 - a1 - a2 + a5 - a6 - a7 + a14 + a15 +
+              T(2.0) * (-b0_5 + b1_6 + b2_7 - b14_15);
+    k[6][7] = T(2.0) * (b0_1 - b0_6 - b1_5 - b2_14 + b2_15 + b5_6 + b7_14 - b7_15);
+    k[6][8] = T(2.0) * (b0_2 - b0_7 + b1_14 - b1_15 - b2_5 + b5_7 - b6_14 + b6_15);
+    k[6][9] = T(2.0) * (b0_3 - b1_13 + b2_12 - b3_5 + b6_13 - b7_12 - b11_14 + b11_15);
+    k[7][0] = T(2.0) * (-b0_12 - b1_11 - b2_3 + b3_7 + b5_12 + b6_11 - b13_14 + b13_15);
+    k[7][1] = T(2.0) * (b0_11 - b1_12 + b2_13 - b3_14 + b3_15 - b5_11 + b6_12 - b7_13);
+    k[7][2] = T(2.0) * (b0_3 - b1_13 - b2_12 - b3_5 + b6_13 + b7_12 + b11_14 - b11_15);
+    k[7][3] = T(4.0) * (b3_13 + b11_12);
+    k[7][4] = T(2.0) * (a3 - a11 + a12 - a13);
+    k[7][5] = T(4.0) * (-b3_11 + b12_13);
+    k[7][6] = T(2.0) * (b0_1 - b0_6 - b1_5 + b2_14 - b2_15 + b5_6 - b7_14 + b7_15);
+    k[7][7] = -a0 + a1 - a2 - a5 + a6 - a7 + a14 + a15 +
+              T(2.0) * (b0_5 - b1_6 + b2_7 - b14_15);
+    k[7][8] = T(2.0) * (-b0_14 + b0_15 + b1_2 - b1_7 - b2_6 + b5_14 - b5_15 + b6_7);
+    k[7][9] = T(2.0) * (b0_13 + b1_3 - b2_11 - b3_6 - b5_13 + b7_11 - b12_14 + b12_15);
+    k[8][0] = T(2.0) * (-b0_13 + b1_3 - b2_11 - b3_6 + b5_13 + b7_11 + b12_14 - b12_15);
+    k[8][1] = T(2.0) * (-b0_3 - b1_13 - b2_12 + b3_5 + b6_13 + b7_12 - b11_14 + b11_15);
+    k[8][2] = T(2.0) * (b0_11 + b1_12 - b2_13 - b3_14 + b3_15 - b5_11 - b6_12 + b7_13);
+    k[8][3] = T(4.0) * (-b3_12 + b11_13);
+    k[8][4] = T(4.0) * (b3_11 + b12_13);
+    k[8][5] = T(2.0) * (a3 - a11 - a12 + a13);
+    k[8][6] = T(2.0) * (b0_2 - b0_7 - b1_14 + b1_15 - b2_5 + b5_7 + b6_14 - b6_15);
+    k[8][7] = T(2.0) * (b0_14 - b0_15 + b1_2 - b1_7 - b2_6 - b5_14 + b5_15 + b6_7);
+    k[8][8] = -a0 - a1 + a2 - a5 - a6 + a7 + a14 + a15 +
+              T(2.0) * (b0_5 + b1_6 - b2_7 - b14_15);
+    k[8][9] = T(2.0) * (-b0_12 + b1_11 + b2_3 - b3_7 + b5_12 - b6_11 - b13_14 + b13_15);
+    k[9][0] = T(2.0) * (-b0_15 - b1_7 + b2_6 - b3_8 + b4_11 + b5_14 - b9_13 + b10_12);
+    k[9][1] = T(2.0) * (b0_7 - b1_15 - b2_5 - b3_9 + b4_12 + b6_14 + b8_13 - b10_11);
+    k[9][2] = T(2.0) * (-b0_6 + b1_5 - b2_15 - b3_10 + b4_13 + b7_14 - b8_12 + b9_11);
+    k[9][3] = T(2.0) * (-b0_3 - b1_13 + b2_12 - b3_5 - b6_13 + b7_12 + b11_14 + b11_15);
+    k[9][4] = T(2.0) * (b0_13 - b1_3 - b2_11 - b3_6 + b5_13 - b7_11 + b12_14 + b12_15);
+    k[9][5] = T(2.0) * (-b0_12 + b1_11 - b2_3 - b3_7 - b5_12 + b6_11 + b13_14 + b13_15);
+    k[9][6] = T(2.0) * (-b0_4 - b1_10 + b2_9 + b4_5 + b6_10 - b7_9 + b8_14 - b8_15);
+    k[9][7] = T(2.0) * (b0_10 - b1_4 - b2_8 + b4_6 - b5_10 + b7_8 + b9_14 - b9_15);
+    k[9][8] = T(2.0) * (-b0_9 + b1_8 - b2_4 + b4_7 + b5_9 - b6_8 + b10_14 - b10_15);
+    k[9][9] = -a0 - a1 - a2 + a5 + a6 + a7 - a14 + a15 +
+              T(2.0) * (-b3_4 - b8_11 - b9_12 - b10_13);
+    return k;
+}
+
+// 5x5 matrix for the grade-4 (sphere / plane) sandwich; rows/cols ordered
+// (x,y,z,w,u) = (e4235,e4315,e4125,e3215,e1234). Uses 96 distinct products.
+template <typename T>
+constexpr std::array<std::array<T, 5>, 5>
+cga3dc_motor_xf_mat_quadvec(MVec3dc_U<T> const& M)
+{
+    T const a0 = M.c0 * M.c0, a1 = M.c1 * M.c1, a2 = M.c2 * M.c2, a3 = M.c3 * M.c3;
+    T const a4 = M.c4 * M.c4, a5 = M.c5 * M.c5, a6 = M.c6 * M.c6, a7 = M.c7 * M.c7;
+    T const a8 = M.c8 * M.c8, a9 = M.c9 * M.c9, a10 = M.c10 * M.c10, a11 = M.c11 * M.c11;
+    T const a12 = M.c12 * M.c12, a13 = M.c13 * M.c13, a14 = M.c14 * M.c14;
+    T const a15 = M.c15 * M.c15;
+
+    T const b0_1 = M.c0 * M.c1, b0_2 = M.c0 * M.c2, b0_3 = M.c0 * M.c3;
+    T const b0_4 = M.c0 * M.c4, b0_5 = M.c0 * M.c5, b0_9 = M.c0 * M.c9;
+    T const b0_10 = M.c0 * M.c10, b0_12 = M.c0 * M.c12, b0_13 = M.c0 * M.c13;
+    T const b0_14 = M.c0 * M.c14, b1_2 = M.c1 * M.c2, b1_3 = M.c1 * M.c3;
+    T const b1_4 = M.c1 * M.c4, b1_6 = M.c1 * M.c6, b1_8 = M.c1 * M.c8;
+    T const b1_10 = M.c1 * M.c10, b1_11 = M.c1 * M.c11, b1_13 = M.c1 * M.c13;
+    T const b1_14 = M.c1 * M.c14, b2_3 = M.c2 * M.c3, b2_4 = M.c2 * M.c4;
+    T const b2_7 = M.c2 * M.c7, b2_8 = M.c2 * M.c8, b2_9 = M.c2 * M.c9;
+    T const b2_11 = M.c2 * M.c11, b2_12 = M.c2 * M.c12, b2_14 = M.c2 * M.c14;
+    T const b3_4 = M.c3 * M.c4, b3_5 = M.c3 * M.c5, b3_6 = M.c3 * M.c6;
+    T const b3_7 = M.c3 * M.c7, b3_8 = M.c3 * M.c8, b3_9 = M.c3 * M.c9;
+    T const b3_10 = M.c3 * M.c10, b4_5 = M.c4 * M.c5, b4_6 = M.c4 * M.c6;
+    T const b4_7 = M.c4 * M.c7, b4_11 = M.c4 * M.c11, b4_12 = M.c4 * M.c12;
+    T const b4_13 = M.c4 * M.c13, b5_6 = M.c5 * M.c6, b5_7 = M.c5 * M.c7;
+    T const b5_9 = M.c5 * M.c9, b5_10 = M.c5 * M.c10, b5_12 = M.c5 * M.c12;
+    T const b5_13 = M.c5 * M.c13, b5_15 = M.c5 * M.c15, b6_7 = M.c6 * M.c7;
+    T const b6_8 = M.c6 * M.c8, b6_10 = M.c6 * M.c10, b6_11 = M.c6 * M.c11;
+    T const b6_13 = M.c6 * M.c13, b6_15 = M.c6 * M.c15, b7_8 = M.c7 * M.c8;
+    T const b7_9 = M.c7 * M.c9, b7_11 = M.c7 * M.c11, b7_12 = M.c7 * M.c12;
+    T const b7_15 = M.c7 * M.c15, b8_11 = M.c8 * M.c11, b8_12 = M.c8 * M.c12;
+    T const b8_13 = M.c8 * M.c13, b8_14 = M.c8 * M.c14, b8_15 = M.c8 * M.c15;
+    T const b9_11 = M.c9 * M.c11, b9_12 = M.c9 * M.c12, b9_13 = M.c9 * M.c13;
+    T const b9_14 = M.c9 * M.c14, b9_15 = M.c9 * M.c15, b10_11 = M.c10 * M.c11;
+    T const b10_12 = M.c10 * M.c12, b10_13 = M.c10 * M.c13, b10_14 = M.c10 * M.c14;
+    T const b10_15 = M.c10 * M.c15, b11_14 = M.c11 * M.c14, b11_15 = M.c11 * M.c15;
+    T const b12_14 = M.c12 * M.c14, b12_15 = M.c12 * M.c15, b13_14 = M.c13 * M.c14;
+    T const b13_15 = M.c13 * M.c15, b14_15 = M.c14 * M.c15;
+
+    std::array<std::array<T, 5>, 5> k{};
+    k[0][0] = -a0 + a1 + a2 + a5 - a6 - a7 - a14 + a15 +
+              T(2.0) * (-b3_4 - b8_11 + b9_12 + b10_13);
+    k[0][1] = T(2.0) * (-b0_1 + b2_14 + b3_10 + b4_13 + b5_6 - b7_15 - b8_12 - b9_11);
+    k[0][2] = T(2.0) * (-b0_2 - b1_14 - b3_9 - b4_12 + b5_7 + b6_15 - b8_13 - b10_11);
+    k[0][3] = T(2.0) * (-b0_3 + b1_13 - b2_12 - b3_5 + b6_13 - b7_12 + b11_14 + b11_15);
+    k[0][4] = T(2.0) * (-b0_4 + b1_10 - b2_9 + b4_5 - b6_10 + b7_9 + b8_14 - b8_15);
+    k[1][0] = T(2.0) * (-b0_1 - b2_14 - b3_10 - b4_13 + b5_6 + b7_15 - b8_12 - b9_11);
+    k[1][1] = a0 - a1 + a2 - a5 + a6 - a7 - a14 + a15 +
+              T(2.0) * (-b3_4 + b8_11 - b9_12 + b10_13);
+    k[1][2] = T(2.0) * (b0_14 - b1_2 + b3_8 + b4_11 - b5_15 + b6_7 - b9_13 - b10_12);
+    k[1][3] = T(2.0) * (-b0_13 - b1_3 + b2_11 - b3_6 - b5_13 + b7_11 + b12_14 + b12_15);
+    k[1][4] = T(2.0) * (-b0_10 - b1_4 + b2_8 + b4_6 + b5_10 - b7_8 + b9_14 - b9_15);
+    k[2][0] = T(2.0) * (-b0_2 + b1_14 + b3_9 + b4_12 + b5_7 - b6_15 - b8_13 - b10_11);
+    k[2][1] = T(2.0) * (-b0_14 - b1_2 - b3_8 - b4_11 + b5_15 + b6_7 - b9_13 - b10_12);
+    k[2][2] = a0 + a1 - a2 - a5 - a6 + a7 - a14 + a15 +
+              T(2.0) * (-b3_4 + b8_11 + b9_12 - b10_13);
+    k[2][3] = T(2.0) * (b0_12 - b1_11 - b2_3 - b3_7 + b5_12 - b6_11 + b13_14 + b13_15);
+    k[2][4] = T(2.0) * (b0_9 - b1_8 - b2_4 + b4_7 - b5_9 + b6_8 + b10_14 - b10_15);
+    k[3][0] = T(2.0) * (b0_4 + b1_10 - b2_9 + b4_5 + b6_10 - b7_9 - b8_14 - b8_15);
+    k[3][1] = T(2.0) * (-b0_10 + b1_4 + b2_8 + b4_6 - b5_10 + b7_8 - b9_14 - b9_15);
+    k[3][2] = T(2.0) * (b0_9 - b1_8 + b2_4 + b4_7 + b5_9 - b6_8 - b10_14 - b10_15);
+    k[3][3] = a0 + a1 + a2 + a5 + a6 + a7 + a14 + a15 +
+              T(2.0) * (b0_5 + b1_6 + b2_7 + b14_15);
+    k[3][4] = T(2.0) * (a4 + a8 + a9 + a10);
+    k[4][0] = T(2.0) * (b0_3 + b1_13 - b2_12 - b3_5 - b6_13 + b7_12 - b11_14 + b11_15);
+    k[4][1] = T(2.0) * (-b0_13 + b1_3 + b2_11 - b3_6 + b5_13 - b7_11 - b12_14 + b12_15);
+    k[4][2] = T(2.0) * (b0_12 - b1_11 + b2_3 - b3_7 - b5_12 + b6_11 - b13_14 + b13_15);
+    k[4][3] = T(2.0) * (a3 + a11 + a12 + a13);
+    k[4][4] = a0 + a1 + a2 + a5 + a6 + a7 + a14 + a15 +
+              T(2.0) * (-b0_5 - b1_6 - b2_7 - b14_15);
+    return k;
+}
+
+} // namespace hd::ga::detail
+
 namespace hd::ga::cga {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +529,11 @@ namespace hd::ga::cga {
 // - get_transversion()      -> special conformal transformation motor
 // - get_loxodromic()        -> two-fixed-point motor from a dipole
 // - transform()             -> apply motor: sandwich M (v) u (v) rrev(M)
+//                              (single object or std::span batch)
+// - transform_opt()         -> closed-form transform (single object or
+//                              std::vector batch), all grades
+// - transform_inplace()     -> apply motor to a std::span batch in place
+// - get_xform()             -> precomputed motor transform (Xform3dc)
 // - invert_on()             -> inversion in a sphere or plane (flector
 //                              sandwich)
 //
@@ -236,6 +745,232 @@ constexpr QuadVec3dc<std::common_type_t<T, U>> transform(QuadVec3dc<T> const& Q,
     return gr4(rgpr(rgpr(M, Q), rrev(M)));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// optimized closed-form transformation:  u' = M (v) u (v) rrev(M)
+//
+// The sandwich collapses to one matrix per grade acting on the components of u,
+// quadratic in the motor coefficients (built by the helpers in hd::ga::detail,
+// every distinct product M.ci*M.cj collected once). It replaces the two full
+// rgpr products of transform() by one matrix-vector product; the matrix depends
+// only on M, so the std::vector batch overloads below build it once and reuse it
+// for all elements (the bottleneck case: many spheres, circles or points moved by
+// one motor). The span overloads transform(in, M, out) and get_xform() use the
+// same matrices.
+//
+// validated against the direct transform() in the test suite.
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+constexpr Vec3dc<std::common_type_t<T, U>> transform_opt(Vec3dc<T> const& v,
+                                                         MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::matrix_apply(detail::cga3dc_motor_xf_mat_vec<ctype>(M),
+                                Vec3dc<ctype>(v));
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+constexpr BiVec3dc<std::common_type_t<T, U>> transform_opt(BiVec3dc<T> const& B,
+                                                           MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::matrix_apply(detail::cga3dc_motor_xf_mat_bivec<ctype>(M),
+                                BiVec3dc<ctype>(B));
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+constexpr TriVec3dc<std::common_type_t<T, U>> transform_opt(TriVec3dc<T> const& t,
+                                                            MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::matrix_apply(detail::cga3dc_motor_xf_mat_trivec<ctype>(M),
+                                TriVec3dc<ctype>(t));
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+constexpr QuadVec3dc<std::common_type_t<T, U>> transform_opt(QuadVec3dc<T> const& Q,
+                                                             MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::matrix_apply(detail::cga3dc_motor_xf_mat_quadvec<ctype>(M),
+                                QuadVec3dc<ctype>(Q));
+}
+
+// batch transformation of many objects by the SAME motor M: the matrix is built
+// once, then applied to every element (one matrix-vector product each).
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+std::vector<Vec3dc<std::common_type_t<T, U>>>
+transform_opt(std::vector<Vec3dc<T>> const& vecs, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::cga3dc_motor_xf_mat_vec<ctype>(M);
+    std::vector<Vec3dc<ctype>> res;
+    res.reserve(vecs.size());
+    for (auto const& v : vecs) {
+        res.emplace_back(detail::matrix_apply(k, Vec3dc<ctype>(v)));
+    }
+    return res;
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+std::vector<BiVec3dc<std::common_type_t<T, U>>>
+transform_opt(std::vector<BiVec3dc<T>> const& bvecs, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::cga3dc_motor_xf_mat_bivec<ctype>(M);
+    std::vector<BiVec3dc<ctype>> res;
+    res.reserve(bvecs.size());
+    for (auto const& B : bvecs) {
+        res.emplace_back(detail::matrix_apply(k, BiVec3dc<ctype>(B)));
+    }
+    return res;
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+std::vector<TriVec3dc<std::common_type_t<T, U>>>
+transform_opt(std::vector<TriVec3dc<T>> const& tvecs, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::cga3dc_motor_xf_mat_trivec<ctype>(M);
+    std::vector<TriVec3dc<ctype>> res;
+    res.reserve(tvecs.size());
+    for (auto const& t : tvecs) {
+        res.emplace_back(detail::matrix_apply(k, TriVec3dc<ctype>(t)));
+    }
+    return res;
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+std::vector<QuadVec3dc<std::common_type_t<T, U>>>
+transform_opt(std::vector<QuadVec3dc<T>> const& qvecs, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::cga3dc_motor_xf_mat_quadvec<ctype>(M);
+    std::vector<QuadVec3dc<ctype>> res;
+    res.reserve(qvecs.size());
+    for (auto const& Q : qvecs) {
+        res.emplace_back(detail::matrix_apply(k, QuadVec3dc<ctype>(Q)));
+    }
+    return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// batch transformation on caller-owned storage (std::span over a std::vector,
+// std::array, a reused stream buffer, ...): nothing is allocated
+//
+//   transform(in, M, out)    out[i] = transform(in[i], M); in and out must have
+//                            the same size (throws std::invalid_argument) and
+//                            must be disjoint or identical
+//   transform_inplace(v, M)  overwrites v
+//
+// The matrix of the map on the grade is built once in closed form (as for
+// transform_opt()); every element then costs one matrix-vector product instead of
+// two full rgpr products (detail::span_transform). T is deduced
+// from out; a std::vector<Vec3dc<T>> converts implicitly to in, out is passed as
+// std::span(vec). The matrix is rounded to T.
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform(std::type_identity_t<std::span<Vec3dc<T> const>> in, MVec3dc_U<U> const& M,
+               std::span<Vec3dc<T>> out)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_vec<ctype>(M));
+    detail::span_transform<Vec3dc<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<Vec3dc<T>> vec, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_vec<ctype>(M));
+    detail::span_transform<Vec3dc<T>>(k, vec, vec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform(std::type_identity_t<std::span<BiVec3dc<T> const>> in,
+               MVec3dc_U<U> const& M, std::span<BiVec3dc<T>> out)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_bivec<ctype>(M));
+    detail::span_transform<BiVec3dc<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<BiVec3dc<T>> bvec, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_bivec<ctype>(M));
+    detail::span_transform<BiVec3dc<T>>(k, bvec, bvec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform(std::type_identity_t<std::span<TriVec3dc<T> const>> in,
+               MVec3dc_U<U> const& M, std::span<TriVec3dc<T>> out)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_trivec<ctype>(M));
+    detail::span_transform<TriVec3dc<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<TriVec3dc<T>> tvec, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_trivec<ctype>(M));
+    detail::span_transform<TriVec3dc<T>>(k, tvec, tvec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform(std::type_identity_t<std::span<QuadVec3dc<T> const>> in,
+               MVec3dc_U<U> const& M, std::span<QuadVec3dc<T>> out)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_quadvec<ctype>(M));
+    detail::span_transform<QuadVec3dc<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<QuadVec3dc<T>> qvec, MVec3dc_U<U> const& M)
+{
+    using ctype = std::common_type_t<T, U>;
+    auto const k = detail::matrix_cast<T>(detail::cga3dc_motor_xf_mat_quadvec<ctype>(M));
+    detail::span_transform<QuadVec3dc<T>>(k, qvec, qvec);
+}
+
+// precomputed motor transform (Xform3dc, see ga_xform_t.hpp): the closed-form matrices
+// of M on all four blade grades (round points; dipoles / flat points; circles / lines;
+// spheres / planes; as for transform_opt()) are built once and kept. Apply
+// with xf(u), xf(in, out) or xf.apply_inplace(v); compose with operator*:
+// (xf2 * xf1)(x) == xf2(xf1(x)).
+template <typename T>
+    requires(numeric_type<T>)
+Xform3dc<T> get_xform(MVec3dc_U<T> const& M)
+{
+    return Xform3dc<T>(
+        GradeXform_t<Vec3dc<T>>(detail::cga3dc_motor_xf_mat_vec(M)),
+        GradeXform_t<BiVec3dc<T>>(detail::cga3dc_motor_xf_mat_bivec(M)),
+        GradeXform_t<TriVec3dc<T>>(detail::cga3dc_motor_xf_mat_trivec(M)),
+        GradeXform_t<QuadVec3dc<T>>(detail::cga3dc_motor_xf_mat_quadvec(M)));
+}
+
 template <typename T, typename U>
     requires(numeric_type<T> && numeric_type<U>)
 constexpr Vec3dc<std::common_type_t<T, U>> invert_on(Vec3dc<T> const& v,
@@ -0,0 +1,111 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+#include <concepts> // std::floating_point
+
+#include "ga_cga3dc_ops_products.hpp" // scalar reference products
+
+#include "detail/ga_simd.hpp" // simd_product, simd_basis_t, simd_sign_table
+
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// provides cga3dc SIMD versions of the full multivector products (MVec3dc):
+//
+// - gpr_simd()             -> same result as operator*() for MVec3dc x MVec3dc
+// - wdg_simd()             -> wdg() for MVec3dc x MVec3dc (scalar, see below)
+// - rwdg_simd()            -> rwdg() for MVec3dc x MVec3dc (scalar, see below)
+// - rgpr_simd()            -> same result as rgpr() for MVec3dc x MVec3dc
+//
+// See detail/ga_simd.hpp for the method. The scalar products remain the reference and
+// the constexpr variant; the results agree with them to rounding.
+//
+// gpr and rgpr (32 x 32 terms) gain about 3x - 4x in ga_bench_simd_products. wdg and
+// rwdg showed no consistent gain (rwdg was slower with AVX2 and AVX-512), so
+// wdg_simd() and rwdg_simd() forward to the scalar products.
+//
+// The change of basis below halves coefficients (factors 0.5), so these overloads
+// are restricted to floating-point value types: with an integral type the halves
+// would be truncated. Use the scalar products for integral multivectors.
+//
+// The sign tables are generated in the product basis with e4, e5 replaced by the
+// orthogonal pair ep = e4 - e5, em = e4 + e5 (ep^2 = 2, em^2 = -2), hence the metric
+// factors +-2, +-4 (gpr) and +-0.5 (rgpr) they contain.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace hd::ga::detail {
+
+// component c_n of MVec3dc: blade with bitmask mask[n] and orientation sign[n]
+inline constexpr simd_basis_t<32> cga3dc_simd_basis{
+    {0, 1, 2, 4, 8, 16, 9, 10, 12, 6, 5, 3, 17, 18, 20, 24, 25, 26, 28, 22, 21, 19, 14,
+     13, 11, 7, 30, 29, 27, 23, 15, 31},
+    {1, 1, 1, 1, 1, 1, -1, -1, -1, 1, -1, 1, 1, 1, 1, 1, -1, -1, -1, 1, -1, 1, 1, -1, 1,
+     -1, 1, -1, 1, -1, 1, 1},
+    true, 3};
+
+// scalar reference products the sign tables are generated from (simd_sign_table)
+struct cga3dc_simd_gpr {
+    using argument_type = MVec3dc<double>;
+    constexpr auto operator()(argument_type const& A, argument_type const& B) const
+    {
+        return cga::operator*(A, B);
+    }
+};
+struct cga3dc_simd_rgpr {
+    using argument_type = MVec3dc<double>;
+    constexpr auto operator()(argument_type const& A, argument_type const& B) const
+    {
+        return cga::rgpr(A, B);
+    }
+};
+
+} // namespace hd::ga::detail
+
+namespace hd::ga::cga {
+
+// cga3dc gpr :: gpr_simd(mv,mv) -> mv   (same result as operator*())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U> &&
+             std::floating_point<std::common_type_t<T, U>>)
+inline MVec3dc<std::common_type_t<T, U>> gpr_simd(MVec3dc<T> const& A,
+                                                  MVec3dc<U> const& B)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::simd_product<detail::cga3dc_simd_basis, detail::cga3dc_simd_gpr, 0>(
+        MVec3dc<ctype>(A), MVec3dc<ctype>(B));
+}
+
+// cga3dc wdg :: wdg_simd(mv,mv) -> mv   (forwards to wdg())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U> &&
+             std::floating_point<std::common_type_t<T, U>>)
+inline MVec3dc<std::common_type_t<T, U>> wdg_simd(MVec3dc<T> const& A,
+                                                  MVec3dc<U> const& B)
+{
+    return wdg(A, B);
+}
+
+// cga3dc rwdg :: rwdg_simd(mv,mv) -> mv   (forwards to rwdg())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U> &&
+             std::floating_point<std::common_type_t<T, U>>)
+inline MVec3dc<std::common_type_t<T, U>> rwdg_simd(MVec3dc<T> const& A,
+                                                   MVec3dc<U> const& B)
+{
+    return rwdg(A, B);
+}
+
+// cga3dc rgpr :: rgpr_simd(mv,mv) -> mv   (same result as rgpr())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U> &&
+             std::floating_point<std::common_type_t<T, U>>)
+inline MVec3dc<std::common_type_t<T, U>> rgpr_simd(MVec3dc<T> const& A,
+                                                   MVec3dc<U> const& B)
+{
+    using ctype = std::common_type_t<T, U>;
+    return detail::simd_product<detail::cga3dc_simd_basis, detail::cga3dc_simd_rgpr, 31>(
+        MVec3dc<ctype>(A), MVec3dc<ctype>(B));
+}
+
+} // namespace hd::ga::cga
@@ -19,6 +19,8 @@ namespace hd::ga::ega {
 // - sqrt(rotor) -> rotor           -> sqrt function (w.r.t. gpr) halves the rot. angle
 // - get_rotor()                    -> provide a rotor
 // - rotate(), rotate_opt()         -> rotate object with rotor (sandwich + optimized)
+// - rotate_inplace()               -> rotate a std::span of objects in place
+// - get_xform()                    -> precomputed rotor transform (Xform2d)
 // - project_onto(), reject_from()  -> projection and rejection
 // - reflect_on(), reflect_on_vec() -> reflections
 // - gs_orthogonal()                -> Gram-Schmidt-orthogonalization
@@ -250,6 +252,49 @@ rotate_opt(std::vector<Vec2d<T>> const& vec, MVec2d_E<U> const& R)
     return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// batch rotations on caller-owned storage (std::span over a std::vector,
+// std::array, a reused stream buffer, ...): nothing is allocated
+//
+//   rotate_opt(in, R, out)  out[i] = rotate_opt(in[i], R); in and out must have
+//                           the same size (throws std::invalid_argument) and
+//                           must be disjoint or identical
+//   rotate_inplace(v, R)    overwrites v
+//
+// The rotation matrix is built once per call and applied element by element
+// (detail::span_transform). T is deduced from out; a std::vector<Vec2d<T>>
+// converts implicitly to in, out is passed as std::span(vec).
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void rotate_opt(std::type_identity_t<std::span<Vec2d<T> const>> in, MVec2d_E<U> const& R,
+                std::span<Vec2d<T>> out)
+{
+    auto const k = detail::soa_matrix<Vec2d<T>>(
+        [&R](Vec2d<T> const& v) { return Vec2d<T>(rotate_opt(v, R)); });
+    detail::span_transform<Vec2d<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void rotate_inplace(std::span<Vec2d<T>> vec, MVec2d_E<U> const& R)
+{
+    auto const k = detail::soa_matrix<Vec2d<T>>(
+        [&R](Vec2d<T> const& v) { return Vec2d<T>(rotate_opt(v, R)); });
+    detail::span_transform<Vec2d<T>>(k, vec, vec);
+}
+
+// precomputed rotation (Xform2d, see ga_xform_t.hpp): the rotation matrix of R is built
+// once; apply with xf(v), xf(in, out) or xf.apply_inplace(v); compose with operator*
+template <typename T>
+    requires(numeric_type<T>)
+Xform2d<T> get_xform(MVec2d_E<T> const& R)
+{
+    return Xform2d<T>(GradeXform_t<Vec2d<T>>::from_map(
+        [&R](Vec2d<T> const& v) { return rotate_opt(v, R); }));
+}
+
 template <typename T, typename U>
     requires(numeric_type<T> && numeric_type<U>)
 constexpr MVec2d<std::common_type_t<T, U>> rotate(MVec2d<T> const& M,
@@ -20,6 +20,8 @@ namespace hd::ga::ega {
 // - sqrt(rotor) -> rotor           -> sqrt function (w.r.t. gpr) halves the rot. angle
 // - get_rotor()                    -> provide a rotor
 // - rotate(), rotate_opt()         -> rotate object with rotor (sandwich + optimized)
+// - rotate_inplace()               -> rotate a std::span of objects in place
+// - get_xform()                    -> precomputed rotor transform (Xform3d)
 // - project_onto(), reject_from()  -> projection and rejection
 // - reflect_on(), reflect_on_vec() -> reflections
 // - gs_orthogonal()                -> Gram-Schmidt-orthogonalization
@@ -479,6 +481,71 @@ rotate_opt(std::vector<BiVec3d<T>> const& bvec, MVec3d_E<U> const& R)
     return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// batch rotations on caller-owned storage (std::span over a std::vector,
+// std::array, a reused stream buffer, ...): nothing is allocated
+//
+//   rotate_opt(in, R, out)  out[i] = rotate_opt(in[i], R); in and out must have
+//                           the same size (throws std::invalid_argument) and
+//                           must be disjoint or identical
+//   rotate_inplace(v, R)    overwrites v
+//
+// The rotation matrix is built once per call and applied element by element
+// (detail::span_transform). T is deduced from out; a std::vector<Vec3d<T>>
+// converts implicitly to in, out is passed as std::span(vec).
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void rotate_opt(std::type_identity_t<std::span<Vec3d<T> const>> in, MVec3d_E<U> const& R,
+                std::span<Vec3d<T>> out)
+{
+    auto const k = detail::soa_matrix<Vec3d<T>>(
+        [&R](Vec3d<T> const& v) { return Vec3d<T>(rotate_opt(v, R)); });
+    detail::span_transform<Vec3d<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void rotate_inplace(std::span<Vec3d<T>> vec, MVec3d_E<U> const& R)
+{
+    auto const k = detail::soa_matrix<Vec3d<T>>(
+        [&R](Vec3d<T> const& v) { return Vec3d<T>(rotate_opt(v, R)); });
+    detail::span_transform<Vec3d<T>>(k, vec, vec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void rotate_opt(std::type_identity_t<std::span<BiVec3d<T> const>> in,
+                MVec3d_E<U> const& R, std::span<BiVec3d<T>> out)
+{
+    auto const k = detail::soa_matrix<BiVec3d<T>>(
+        [&R](BiVec3d<T> const& B) { return BiVec3d<T>(rotate_opt(B, R)); });
+    detail::span_transform<BiVec3d<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void rotate_inplace(std::span<BiVec3d<T>> bvec, MVec3d_E<U> const& R)
+{
+    auto const k = detail::soa_matrix<BiVec3d<T>>(
+        [&R](BiVec3d<T> const& B) { return BiVec3d<T>(rotate_opt(B, R)); });
+    detail::span_transform<BiVec3d<T>>(k, bvec, bvec);
+}
+
+// precomputed rotation (Xform3d, see ga_xform_t.hpp): the rotation matrices of R for
+// vectors and bivectors are built once; apply with xf(v), xf(in, out) or
+// xf.apply_inplace(v); compose with operator*: (xf2 * xf1)(x) == xf2(xf1(x))
+template <typename T>
+    requires(numeric_type<T>)
+Xform3d<T> get_xform(MVec3d_E<T> const& R)
+{
+    return Xform3d<T>(GradeXform_t<Vec3d<T>>::from_map(
+                          [&R](Vec3d<T> const& v) { return rotate_opt(v, R); }),
+                      GradeXform_t<BiVec3d<T>>::from_map(
+                          [&R](BiVec3d<T> const& B) { return rotate_opt(B, R); }));
+}
+
 
 template <typename T, typename U>
     requires(numeric_type<T> && numeric_type<U>)
@@ -35,6 +35,9 @@
 #include "ga_pga2dp_ops.hpp" // include all pga operations for 2dp
 #include "ga_pga3dp_ops.hpp" // include all pga operations for 3dp
 
+// SIMD backend for the full multivector products (scalar products remain the reference)
+#include "ga_pga3dp_ops_simd.hpp" // gpr_simd, wdg_simd, rwdg_simd, rgpr_simd for 3dp
+
 // PGA mechanics operations (inertia, rigid body dynamics)
 #include "ga_pga2dp_ops_mechanics.hpp" // mechanics operations for 2dp
 #include "ga_pga3dp_ops_mechanics.hpp" // mechanics operations for 3dp
@@ -45,6 +48,17 @@
 #include "ga_pga2dp_ops_constraints.hpp" // closed-loop operations for 2dp
 #include "ga_pga3dp_ops_constraints.hpp" // closed-loop operations for 3dp
 
+// PGA ensemble layer: many perturbed copies of one mechanism stepped in parallel
+#include "ga_pga3dp_ops_ensemble.hpp" // ensemble operations for 3dp
+
+// PGA fixed-topology layer: a dynamic system whose tree is a template parameter
+#include "ga_pga3dp_ops_fixed.hpp" // compile-time topology dynamics for 3dp
+
+// PGA penalty-contact layer: body-attached circles / spheres with a grid broadphase,
+// fed into the dynamics through the extra_wrenches() seam
+#include "ga_pga2dp_ops_contact.hpp" // penalty contact for 2dp
+#include "ga_pga3dp_ops_contact.hpp" // penalty contact for 3dp
+
 // mechanics convenience aliases (after the mechanics ops headers they depend on)
 #include "ga_usr_types_mechanics.hpp" // inertia2dp / inertia3dp (value_t-based)
 
@@ -20,6 +20,8 @@ namespace hd::ga::pga {
 // - get_motor_from_lines()              -> provide a motor from (from two lines moved
 //                                                                into each other)
 // - move2dp(), move2dp_opt()            -> move object with motor
+// - move2dp_inplace()                   -> move a SoA batch or a std::span in place
+// - get_xform()                         -> precomputed motor transform (Xform2dp)
 // - project_onto(), reject_from()       -> simple projection and rejection
 // - expand()                            -> expansion: new line through point
 //                                                     perpendicular to line
@@ -422,6 +424,121 @@ move2dp(std::vector<BiVec2dp<T>> const& bvec, MVec2dp_U<U> const& M)
     return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// precomputed motor transform (Xform2dp, see ga_xform_t.hpp)
+//
+// get_xform(M) evaluates the sandwich of M on points and lines ONCE and keeps the
+// two matrices; apply with xf(p), xf(in, out) or xf.apply_inplace(v). Composition
+// is the matrix product: (xf2 * xf1)(x) == xf2(xf1(x)).
+//
+// get_grade_xform<E>(M) builds the 3x3 matrix of a single grade E (Vec2dp<T> or
+// BiVec2dp<T>; columns = move2dp_opt() of the basis elements), rounded to T, the
+// scalar type of E.
+//
+// pre: motor M must be unitized to avoid surprises
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename E, typename U>
+    requires(numeric_type<U>)
+GradeXform_t<E> get_grade_xform(MVec2dp_U<U> const& M)
+{
+    return GradeXform_t<E>::from_map([&M](E const& e) { return E(move2dp_opt(e, M)); });
+}
+
+template <typename T>
+    requires(numeric_type<T>)
+Xform2dp<T> get_xform(MVec2dp_U<T> const& M)
+{
+    return Xform2dp<T>(get_grade_xform<Vec2dp<T>>(M), get_grade_xform<BiVec2dp<T>>(M));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// batch moves on structure-of-arrays containers (Vec2dp_SoA, BiVec2dp_SoA, see
+// ga_soa_t.hpp)
+//
+// The sandwich map of the motor on the grade is built once per batch
+// (get_grade_xform), then all elements run through one branch-free unit-stride
+// loop that the compiler vectorizes across the elements (detail::soa_transform).
+// Two forms per type:
+//
+//   move2dp(in, M, out)    out-parameter: out is resized to in.size(), its
+//                          storage is reused between calls (no allocation)
+//   move2dp_inplace(v, M)  overwrites v
+//
+// The matrix is rounded to T, the scalar type of the container.
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp(Vec2dp_SoA<T> const& in, MVec2dp_U<U> const& M, Vec2dp_SoA<T>& out)
+{
+    get_grade_xform<Vec2dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp_inplace(Vec2dp_SoA<T>& vec, MVec2dp_U<U> const& M)
+{
+    get_grade_xform<Vec2dp<T>>(M).apply_inplace(vec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp(BiVec2dp_SoA<T> const& in, MVec2dp_U<U> const& M, BiVec2dp_SoA<T>& out)
+{
+    get_grade_xform<BiVec2dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp_inplace(BiVec2dp_SoA<T>& bvec, MVec2dp_U<U> const& M)
+{
+    get_grade_xform<BiVec2dp<T>>(M).apply_inplace(bvec);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// batch moves on caller-owned AoS storage (std::span over a std::vector,
+// std::array, a reused stream buffer, ...): nothing is allocated
+//
+//   move2dp(in, M, out)    out[i] = move2dp_opt(in[i], M); in and out must have
+//                          the same size (throws std::invalid_argument) and must
+//                          be disjoint or identical
+//   move2dp_inplace(v, M)  overwrites v
+//
+// Same matrix as for the SoA batches above, applied element by element
+// (detail::span_transform). T is deduced from out; a std::vector<Vec2dp<T>>
+// converts implicitly to in, out is passed as std::span(vec).
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp(std::type_identity_t<std::span<Vec2dp<T> const>> in,
+             MVec2dp_U<U> const& M, std::span<Vec2dp<T>> out)
+{
+    get_grade_xform<Vec2dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp_inplace(std::span<Vec2dp<T>> vec, MVec2dp_U<U> const& M)
+{
+    get_grade_xform<Vec2dp<T>>(M).apply_inplace(vec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp(std::type_identity_t<std::span<BiVec2dp<T> const>> in,
+             MVec2dp_U<U> const& M, std::span<BiVec2dp<T>> out)
+{
+    get_grade_xform<BiVec2dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move2dp_inplace(std::span<BiVec2dp<T>> bvec, MVec2dp_U<U> const& M)
+{
+    get_grade_xform<BiVec2dp<T>>(M).apply_inplace(bvec);
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 // projections, rejections
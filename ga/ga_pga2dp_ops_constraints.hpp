@@ -42,6 +42,7 @@
 #include <mdspan>    // RK4 state views (step)
 #include <stdexcept> // std::runtime_error
 #include <string>
+#include <utility>   // std::move (chord warm start)
 #include <vector>
 
 
@@ -70,6 +71,29 @@ struct loop_constraint2dp {
 };
 
 
+// Position-projection method of step() (see set_projection_method):
+//   newton -- the full Newton iteration of assemble(): a fresh constraint Jacobian and
+//             least-squares solve in every iteration (default; the reference)
+//   chord  -- chord iteration: warm-started from the previous step's correction and
+//             reusing ONE factorization of the constraint Jacobian across iterations and
+//             steps (the velocity projection of the previous step refreshes it for free).
+//             A Jacobian that stops contracting the residual is refreshed; a chord that
+//             does not converge within max_iter finishes with the full Newton
+enum class projection_method2dp { newton, chord };
+
+// Report of the post-step position projection (see projection_stats()). The per-step
+// fields describe the LAST step; the totals accumulate until reset_projection_stats().
+struct projection_stats2dp {
+    size_t iterations{0};          // Newton / chord iterations of the last step
+    size_t jacobian_evals{0};      // constraint Jacobians built + factorized for them
+    bool warm_start{false};        // previous correction applied and accepted (chord)
+    std::vector<value_t> residual; // ‖g‖ at entry, after the warm start, per iteration
+    size_t steps{0};               // projected steps
+    size_t total_iterations{0};
+    size_t total_jacobian_evals{0};
+};
+
+
 // A closed-loop / parallel mechanism: an open-chain spanning tree (the reused
 // dynamic_system2dp) plus loop-closure constraints between tree frames. Build the tree
 // through the familiar forwarded API, then close loops with add_loop_constraint(...).
@@ -78,6 +102,12 @@ class closed_loop_system2dp {
     dynamic_system2dp tree_;                // the open-chain spanning tree (reused as-is)
     std::vector<loop_constraint2dp> loops_; // the extra closure edges
 
+    projection_method2dp proj_{projection_method2dp::newton}; // see step()
+    projection_stats2dp pstats_{};                 // report of the projections
+    hd::ga::lstsq_factorization<value_t> chord_{}; // reused Jacobian factorization
+    std::vector<size_t> chord_dep_;                // joint list chord_ belongs to
+    std::vector<value_t> dq_prev_;                 // previous step's position correction
+
   public:
 
     closed_loop_system2dp() = default;
@@ -149,6 +179,14 @@ class closed_loop_system2dp {
         return tree_.joint_omega(joint_frame);
     }
 
+    // select the post-step position projection of step() (see projection_method2dp)
+    void set_projection_method(projection_method2dp p) { proj_ = p; }
+    projection_method2dp get_projection_method() const { return proj_; }
+
+    // iteration counts and residual history of the post-step projections
+    projection_stats2dp const& projection_stats() const { return pstats_; }
+    void reset_projection_stats() { pstats_ = projection_stats2dp{}; }
+
     size_t loop_count() const { return loops_.size(); }
     loop_constraint2dp const& loop(size_t c) const { return loops_[c]; }
 
@@ -197,32 +235,7 @@ class closed_loop_system2dp {
     value_t assemble(std::vector<size_t> const& driven = {}, value_t tol = value_t(1e-12),
                      size_t max_iter = 50)
     {
-        std::vector<size_t> const dep = dependent_joints(driven);
-
-        for (size_t it = 0; it <= max_iter; ++it) {
-            std::vector<value_t> const g = residual();
-            value_t gnorm = 0.0;
-            for (value_t const gi : g)
-                gnorm = std::max(gnorm, std::abs(gi));
-            if (gnorm < tol) return gnorm;
-            if (it == max_iter) break;
-
-            // Newton step: solve G_dep * delta = -g for the dependent joint increments
-            std::vector<value_t> const G = constraint_jacobian(dep);
-            std::vector<value_t> b(g.size());
-            for (size_t i = 0; i < g.size(); ++i)
-                b[i] = -g[i];
-            std::vector<value_t> const delta = hd::ga::lstsq_solve(G, b, dep.size());
-            for (size_t k = 0; k < dep.size(); ++k) {
-                tree_.joint[dep[k]].phi += delta[k];
-                tree_.apply_joint_state(dep[k]);
-            }
-        }
-        throw std::runtime_error(
-            std::string(
-                "closed_loop_system2dp::assemble: Newton did not converge within ") +
-            std::to_string(max_iter) + std::string(" iterations (residual ") +
-            std::to_string(residual_norm()) + std::string(")"));
+        return assemble_dep(dependent_joints(driven), tol, max_iter, nullptr);
     }
 
     // --- velocity / acceleration distribution (kinematic closed loop)
@@ -375,12 +388,143 @@ class closed_loop_system2dp {
         apply_u();
 
         // stabilisation: project (q, q-dot) back onto the constraint manifold
-        assemble(/*driven*/ {}); // position: min-norm Newton -> g ~ 0
-        project_velocities(rj);  // velocity:  q-dot <- q-dot - G⁺(G q-dot)
+        // position: min-norm Newton (or chord) -> g ~ 0, with the report in pstats_
+        pstats_.iterations = 0;
+        pstats_.jacobian_evals = 0;
+        pstats_.warm_start = false;
+        pstats_.residual.clear();
+        if (proj_ == projection_method2dp::chord)
+            project_positions_chord(rj, value_t(1e-12), 50);
+        else
+            assemble_dep(rj, value_t(1e-12), 50, &pstats_);
+        ++pstats_.steps;
+        pstats_.total_iterations += pstats_.iterations;
+        pstats_.total_jacobian_evals += pstats_.jacobian_evals;
+        project_velocities(rj); // velocity: q-dot <- q-dot - G⁺(G q-dot)
     }
 
   private:
 
+    // assemble() on an explicit dependent-joint list; records the iterations and the
+    // residual history into `st` if non-null (the newton projection of step()).
+    value_t assemble_dep(std::vector<size_t> const& dep, value_t tol, size_t max_iter,
+                         projection_stats2dp* st)
+    {
+        for (size_t it = 0; it <= max_iter; ++it) {
+            std::vector<value_t> const g = residual();
+            value_t gnorm = 0.0;
+            for (value_t const gi : g)
+                gnorm = std::max(gnorm, std::abs(gi));
+            if (st) st->residual.push_back(gnorm);
+            if (gnorm < tol) return gnorm;
+            if (it == max_iter) break;
+
+            // Newton step: solve G_dep * delta = -g for the dependent joint increments
+            std::vector<value_t> const G = constraint_jacobian(dep);
+            if (st) {
+                ++st->iterations;
+                ++st->jacobian_evals;
+            }
+            std::vector<value_t> b(g.size());
+            for (size_t i = 0; i < g.size(); ++i)
+                b[i] = -g[i];
+            std::vector<value_t> const delta = hd::ga::lstsq_solve(G, b, dep.size());
+            for (size_t k = 0; k < dep.size(); ++k) {
+                tree_.joint[dep[k]].phi += delta[k];
+                tree_.apply_joint_state(dep[k]);
+            }
+        }
+        throw std::runtime_error(
+            std::string(
+                "closed_loop_system2dp::assemble: Newton did not converge within ") +
+            std::to_string(max_iter) + std::string(" iterations (residual ") +
+            std::to_string(residual_norm()) + std::string(")"));
+    }
+
+    // Chord variant of the post-step position projection (projection_method2dp::chord)
+    // on the dependent joints `dep`:
+    //
+    //   1. warm start: re-apply the previous step's total correction dq_prev_ (the
+    //      drift of consecutive steps is nearly the same) and keep it if it lowers ‖g‖;
+    //   2. chord iterations  q <- q + G0⁺(-g(q))  with ONE factorization G0⁺ (chord_),
+    //      normally the one left by the previous step's velocity projection, so a step
+    //      usually costs no Jacobian evaluation at all;
+    //   3. G0 is rebuilt only when an iteration contracts ‖g‖ by less than a factor of
+    //      20 (the configuration moved too far for the stale Jacobian), and the full
+    //      Newton (assemble_dep) takes over if max_iter chord iterations do not converge.
+    value_t project_positions_chord(std::vector<size_t> const& dep, value_t tol,
+                                    size_t max_iter)
+    {
+        auto& st = pstats_;
+        size_t const n = dep.size();
+        auto norm_inf = [](std::vector<value_t> const& v) {
+            value_t r = 0.0;
+            for (value_t const vi : v)
+                r = std::max(r, std::abs(vi));
+            return r;
+        };
+        auto shift = [&](std::vector<value_t> const& d, value_t sgn) {
+            for (size_t k = 0; k < n; ++k) {
+                tree_.joint[dep[k]].phi += sgn * d[k];
+                tree_.apply_joint_state(dep[k]);
+            }
+        };
+        if (chord_dep_ != dep) { // other joint list: nothing to reuse
+            chord_.valid = false;
+            dq_prev_.clear();
+            chord_dep_ = dep;
+        }
+
+        std::vector<value_t> g = residual();
+        value_t gnorm = norm_inf(g);
+        st.residual.push_back(gnorm);
+        std::vector<value_t> dq(n, 0.0); // total correction of this step
+
+        if (gnorm >= tol && dq_prev_.size() == n) {
+            shift(dq_prev_, 1.0);
+            std::vector<value_t> g1 = residual();
+            value_t const gnorm1 = norm_inf(g1);
+            if (gnorm1 < gnorm) {
+                g = std::move(g1);
+                gnorm = gnorm1;
+                dq = dq_prev_;
+                st.warm_start = true;
+                st.residual.push_back(gnorm);
+            }
+            else {
+                shift(dq_prev_, -1.0); // no better: undo
+            }
+        }
+
+        std::vector<value_t> b(g.size());
+        for (size_t it = 0; gnorm >= tol; ++it) {
+            if (it == max_iter) { // chord stalled: finish with the full Newton
+                dq_prev_.clear();
+                chord_.valid = false;
+                return assemble_dep(dep, tol, max_iter, &st);
+            }
+            if (!chord_.valid || chord_.m != g.size()) {
+                hd::ga::lstsq_factorize(chord_, constraint_jacobian(dep), g.size(), n);
+                ++st.jacobian_evals;
+            }
+            for (size_t i = 0; i < g.size(); ++i)
+                b[i] = -g[i];
+            std::vector<value_t> const delta = hd::ga::lstsq_apply(chord_, b);
+            shift(delta, 1.0);
+            for (size_t k = 0; k < n; ++k)
+                dq[k] += delta[k];
+            ++st.iterations;
+
+            g = residual();
+            value_t const gnorm_new = norm_inf(g);
+            st.residual.push_back(gnorm_new);
+            if (gnorm_new > 0.05 * gnorm) chord_.valid = false; // slow: refresh G0
+            gnorm = gnorm_new;
+        }
+        dq_prev_ = std::move(dq);
+        return gnorm;
+    }
+
     // world-coordinate, unitized (z = 1) position of an anchor point of a tree frame
     vec2dp anchor_world(size_t frame, vec2dp const& anchor)
     {
@@ -459,7 +603,16 @@ class closed_loop_system2dp {
             for (size_t k = 0; k < n; ++k)
                 Gv[i] += G[i * n + k] * qd[k];
 
-        std::vector<value_t> const dqd = hd::ga::lstsq_solve(G, Gv, n); // G⁺(G q-dot)
+        std::vector<value_t> dqd; // G⁺(G q-dot)
+        if (proj_ == projection_method2dp::chord) {
+            // keep the factorization: the next step's position chord starts from it
+            hd::ga::lstsq_factorize(chord_, G, m, n);
+            chord_dep_ = rj;
+            dqd = hd::ga::lstsq_apply(chord_, Gv);
+        }
+        else {
+            dqd = hd::ga::lstsq_solve(G, Gv, n);
+        }
         for (size_t k = 0; k < n; ++k) {
             tree_.joint[rj[k]].omega -= dqd[k];
             tree_.apply_joint_state(rj[k]);
@@ -0,0 +1,221 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+// Penalty-contact layer for PGA2DP: contact between body-attached circles, e.g. for
+// granular media of thousands of grains. The 2D twin of ga_pga3dp_ops_contact.hpp (see
+// there for the force law); it plugs into dynamic_system2dp through the
+// extra_wrenches() seam.
+//
+//   penalty_contact2dp  the force element: contact circles (one body frame each,
+//                       centre in the body frame, z = 1) and the normal force law
+//   contact_system2dp   a dynamic_system2dp that owns one and feeds its contact wrenches
+//                       into the dynamics
+//
+// BROADPHASE: the uniform grid of the 3D layer with 9 neighbour cells per probe.
+
+#include "ga_pga2dp_ops_mechanics.hpp" // dynamic_system2dp (extra_wrenches seam)
+#include "ga_value_t.hpp"              // value_t
+
+#include <algorithm> // std::sort, std::lower_bound, std::max, std::clamp
+#include <cmath>     // std::floor, std::sqrt, std::isfinite
+#include <cstddef>   // size_t
+#include <cstdint>   // uint64_t (grid cell key)
+#include <stdexcept> // std::invalid_argument
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+
+namespace hd::ga::pga {
+
+// A contact circle rigidly attached to a body frame.
+struct contact_circle2dp {
+    size_t frame{0};        // body frame (0: static, attached to the root)
+    vec2dp centre_b{O_2dp}; // centre in the body frame (z = 1)
+    value_t radius{0.0};
+};
+
+class penalty_contact2dp {
+
+    std::vector<contact_circle2dp> circ_;
+    value_t k_{0.0};    // normal stiffness [N/m]
+    value_t c_{0.0};    // normal damping [N s/m]
+    value_t h_{0.0};    // requested grid cell edge (0: automatic)
+    value_t rmax_{0.0}; // largest radius
+
+    // workspace of the last evaluation (reused, no allocation once sized)
+    std::vector<vec2dp> cw_;                        // world centres
+    std::vector<std::pair<uint64_t, size_t>> cell_; // (cell key, circle), sorted
+    std::vector<std::pair<size_t, size_t>> pairs_;  // overlapping pairs a < b, sorted
+
+  public:
+
+    penalty_contact2dp(value_t stiffness, value_t damping = 0.0) :
+        k_(stiffness), c_(damping)
+    {
+        if (!(stiffness > 0.0) || !(damping >= 0.0)) {
+            throw std::invalid_argument(
+                std::string("penalty_contact2dp: need stiffness > 0 and damping >= 0, "
+                            "got k = ") +
+                std::to_string(stiffness) + std::string(", c = ") +
+                std::to_string(damping));
+        }
+    }
+
+    // attach a circle (centre in the body frame, z = 1) to `frame`; returns its index
+    size_t add_circle(size_t frame, vec2dp const& centre_b, value_t radius)
+    {
+        if (!(radius > 0.0)) {
+            throw std::invalid_argument(
+                std::string("penalty_contact2dp: circle radius must be > 0, got ") +
+                std::to_string(radius));
+        }
+        circ_.push_back(contact_circle2dp{frame, centre_b, radius});
+        rmax_ = std::max(rmax_, radius);
+        return circ_.size() - 1;
+    }
+
+    size_t size() const { return circ_.size(); }
+    contact_circle2dp const& circle(size_t s) const { return circ_[s]; }
+
+    // Grid cell edge of the broadphase. It never drops below the largest diameter (the
+    // default, h = 0), which keeps the neighbour-cell search exact; a larger cell can
+    // pay off for strongly mixed radii.
+    void set_cell_size(value_t h)
+    {
+        if (!(h >= 0.0) || !std::isfinite(h)) {
+            throw std::invalid_argument(
+                std::string("penalty_contact2dp: cell size must be finite and >= 0, "
+                            "got ") +
+                std::to_string(h));
+        }
+        h_ = h;
+    }
+    value_t cell_size() const { return std::max(h_, 2.0 * rmax_); }
+
+    // overlapping circle pairs (a < b, sorted) found by the last wrenches() call
+    std::vector<std::pair<size_t, size_t>> const& contact_pairs() const { return pairs_; }
+
+    // Append the contact wrenches (world frame) for the current state of `sys` to
+    // `out`: one (frame, wrench) pair per loaded side of each contact.
+    void wrenches(kinematic_system2dp& sys, std::vector<std::pair<size_t, bivec2dp>>& out)
+    {
+        broadphase(sys);
+        for (auto const& [a, b] : pairs_) {
+            auto const& sa = circ_[a];
+            auto const& sb = circ_[b];
+            vec2dp const d = cw_[b] - cw_[a];
+            value_t const dist = std::sqrt(d.x * d.x + d.y * d.y);
+            if (!(dist > 0.0)) continue; // coincident centres: no normal
+            vec2dp const n = (1.0 / dist) * d;
+            value_t const delta = sa.radius + sb.radius - dist;
+            vec2dp const P = cw_[a] + (sa.radius - 0.5 * delta) * n;
+            vec2dp const vrel =
+                kinematic_system2dp::velocity_field(sys.twist_world(sb.frame), P) -
+                kinematic_system2dp::velocity_field(sys.twist_world(sa.frame), P);
+            value_t const vn = vrel.x * n.x + vrel.y * n.y;
+            value_t const Fn = k_ * delta - c_ * vn;
+            if (!(Fn > 0.0)) continue; // separating fast enough: no adhesion
+            bivec2dp const W = wdg(P, Fn * n);
+            if (sb.frame != 0) out.emplace_back(sb.frame, W);
+            if (sa.frame != 0) out.emplace_back(sa.frame, -W);
+        }
+    }
+
+  private:
+
+    // grid cells per half axis: 31-bit key field per axis
+    static constexpr int64_t cell_lim = int64_t(1) << 30;
+
+    // world centres + grid sort + neighbour-cell probe -> pairs_ (narrowphase included)
+    void broadphase(kinematic_system2dp& sys)
+    {
+        size_t const ns = circ_.size();
+        cw_.resize(ns);
+        cell_.resize(ns);
+        pairs_.clear();
+        if (ns < 2) return;
+
+        value_t const h = cell_size();
+        auto icell = [h](value_t x) -> int64_t {
+            // 31 bits per axis, clamped: far-out circles share the border cells
+            return std::clamp<int64_t>(int64_t(std::floor(x / h)), -cell_lim,
+                                       cell_lim - 1);
+        };
+        auto key = [](int64_t ix, int64_t iy) -> uint64_t {
+            return (uint64_t(ix + cell_lim) << 31) | uint64_t(iy + cell_lim);
+        };
+        auto in_grid = [](int64_t i) { return i >= -cell_lim && i < cell_lim; };
+
+        for (size_t s = 0; s < ns; ++s) {
+            cw_[s] =
+                unitize(move2dp(circ_[s].centre_b, sys.get_pos_trafo(circ_[s].frame, 0)));
+            cell_[s] = {key(icell(cw_[s].x), icell(cw_[s].y)), s};
+        }
+        std::sort(cell_.begin(), cell_.end());
+
+        for (size_t a = 0; a < ns; ++a) {
+            int64_t const ix = icell(cw_[a].x);
+            int64_t const iy = icell(cw_[a].y);
+            for (int64_t dx = -1; dx <= 1; ++dx) {
+                for (int64_t dy = -1; dy <= 1; ++dy) {
+                    // past the border cells: no circle there, and the key would
+                    // spill into the neighbouring bit field
+                    if (!in_grid(ix + dx) || !in_grid(iy + dy)) continue;
+                    probe(a, key(ix + dx, iy + dy));
+                }
+            }
+        }
+        std::sort(pairs_.begin(), pairs_.end());
+    }
+
+    // narrowphase of circle a against the circles b > a in grid cell kn
+    void probe(size_t a, uint64_t kn)
+    {
+        auto it = std::lower_bound(cell_.begin(), cell_.end(),
+                                   std::pair<uint64_t, size_t>{kn, 0});
+        for (; it != cell_.end() && it->first == kn; ++it) {
+            size_t const b = it->second;
+            if (b <= a || circ_[a].frame == circ_[b].frame) continue;
+            vec2dp const d = cw_[b] - cw_[a];
+            value_t const rs = circ_[a].radius + circ_[b].radius;
+            if (d.x * d.x + d.y * d.y < rs * rs) pairs_.emplace_back(a, b);
+        }
+    }
+};
+
+// A dynamic_system2dp with penalty contact between body-attached circles: the contact
+// wrenches enter through the extra_wrenches() seam. Build the mechanism as usual (free
+// bodies, joints), then attach circles with add_contact_circle().
+class contact_system2dp : public dynamic_system2dp {
+
+    penalty_contact2dp contact_;
+
+  public:
+
+    explicit contact_system2dp(value_t stiffness, value_t damping = 0.0) :
+        contact_(stiffness, damping)
+    {
+    }
+
+    // attach a contact circle (centre in the body frame, z = 1) to frame idx
+    size_t add_contact_circle(size_t idx, vec2dp const& centre_b, value_t radius)
+    {
+        return contact_.add_circle(idx, centre_b, radius);
+    }
+
+    penalty_contact2dp& contacts() { return contact_; }
+    penalty_contact2dp const& contacts() const { return contact_; }
+
+  protected:
+
+    // appends into the base's reused buffer: no allocation once the contacts settle
+    void append_extra_wrenches(std::vector<std::pair<size_t, bivec2dp>>& out) override
+    {
+        contact_.wrenches(*this, out);
+    }
+};
+
+} // namespace hd::ga::pga
@@ -3,17 +3,19 @@
 // Copyright 2024-2026, Daniel Hug. All rights reserved.
 // Licensed under the terms specified in LICENSE.txt file.
 
-#include "detail/ga_solver.hpp" // hd::ga::lu_decomp / lu_backsubs / det
+#include "detail/ga_solver.hpp" // hd::ga::lu_decomp / lu_backsubs / ldlt / det
 #include "ga_pga2dp_ops.hpp"
 #include "ga_usr_utilities.hpp" // hd::ga::rk4_step (shared RK4 integrator)
 #include "ga_value_t.hpp"       // for value_t used in convenience type alias
 
-#include <algorithm> // std::find, std::min, std::max
+#include <algorithm> // std::reverse, std::min, std::max, std::fill
 #include <array>
 #include <cmath>      // std::abs
 #include <functional> // std::function (time-varying applied wrench)
 #include <limits>     // std::numeric_limits
 #include <mdspan>
+#include <optional> // std::optional (integrator state)
+#include <span>     // std::span (subtree ranges)
 #include <stdexcept>
 #include <string>
 #include <unordered_map> // std::unordered_map (frame name -> index)
@@ -26,7 +28,7 @@ namespace hd::ga::pga {
 // Forward declaration of the (optional) closed-loop layer in
 // ga_pga2dp_ops_constraints.hpp. dynamic_system2dp grants it friendship so the
 // constrained KKT / assembly solver can reuse the tree's private assembly seam
-// (assemble_mass_bias, the joint screws, dof_joints/is_ancestor, apply_joint_state)
+// (assemble_mass_bias, the joint screws, dof_joints, apply_joint_state)
 // WITHOUT widening the open-loop public API. Open-loop users never include the
 // constraints header.
 class closed_loop_system2dp;
@@ -243,41 +245,35 @@ Inertia2dp<T> get_disc_inertia(T m, T r,
 
 // Get inverse of inertia matrix using LU decomposition
 // Solves I * I_inv = Identity by back-substitution for each column
-// Throws std::invalid_argument if inertia matrix is singular (det = 0)
+// Throws std::invalid_argument if inertia matrix is singular
+// (fixed-size 3x3 LU from detail/ga_solver.hpp: heap-free and constexpr-capable)
 template <typename T>
     requires(numeric_type<T>)
-Inertia2dp<T> get_inertia_inverse(Inertia2dp<T> const& I)
+constexpr Inertia2dp<T> get_inertia_inverse(Inertia2dp<T> const& I)
 {
-    // Check determinant before attempting inversion
-    T const d = hd::ga::det(I.view());
-    if (d == T{0}) {
-        throw std::invalid_argument(
-            "get_inertia_inverse: singular inertia matrix (determinant is zero)");
-    }
-
     // Copy data for LU decomposition (modifies in place)
-    std::array<double, 9> A_data;
+    std::array<double, 9> A_data{};
     for (size_t i = 0; i < 9; ++i) {
         A_data[i] = static_cast<double>(I.data[i]);
     }
-    std::array<int, 3> perm;
+    std::array<int, 3> perm{};
 
-    auto A = std::mdspan<double, std::dextents<size_t, 2>>{A_data.data(), 3, 3};
-    auto perm_view = std::mdspan<int, std::dextents<size_t, 1>>{perm.data(), 3};
-
-    hd::ga::lu_decomp(A, perm_view);
+    auto A = std::mdspan<double, std::extents<size_t, 3, 3>>{A_data.data()};
+    if (!hd::ga::detail::lu_decomp_fixed<3>(
+            A, std::mdspan<int, std::extents<size_t, 3>>{perm.data()})) {
+        throw std::invalid_argument(
+            "get_inertia_inverse: singular inertia matrix (determinant is zero)");
+    }
 
     // Solve for each column of identity matrix to get inverse
     Inertia2dp<T> I_inv;
-    auto A_const =
-        std::mdspan<double const, std::dextents<size_t, 2>>{A_data.data(), 3, 3};
-    auto perm_const = std::mdspan<int const, std::dextents<size_t, 1>>{perm.data(), 3};
+    auto perm_const = std::mdspan<int const, std::extents<size_t, 3>>{perm.data()};
 
     for (size_t col = 0; col < 3; ++col) {
         std::array<double, 3> e = {0.0, 0.0, 0.0};
         e[col] = 1.0;
-        auto e_view = std::mdspan<double, std::dextents<size_t, 1>>{e.data(), 3};
-        hd::ga::lu_backsubs(A_const, perm_const, e_view);
+        hd::ga::lu_backsubs(A, perm_const,
+                            std::mdspan<double, std::extents<size_t, 3>>{e.data()});
 
         // Store column in row-major format
         for (size_t row = 0; row < 3; ++row) {
@@ -287,6 +283,18 @@ Inertia2dp<T> get_inertia_inverse(Inertia2dp<T> const& I)
     return I_inv;
 }
 
+// Batched inverse: I_inv[k] = get_inertia_inverse(I[k]). Throws std::invalid_argument
+// on a size mismatch or a singular map.
+template <typename T>
+    requires(numeric_type<T>)
+void get_inertia_inverse(std::span<Inertia2dp<T> const> I, std::span<Inertia2dp<T>> I_inv)
+{
+    if (I.size() != I_inv.size())
+        throw std::invalid_argument("get_inertia_inverse: batch sizes differ");
+    for (size_t k = 0; k < I.size(); ++k)
+        I_inv[k] = get_inertia_inverse(I[k]);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // ODE right-hand side helpers for 2D rigid body dynamics
@@ -389,6 +397,25 @@ class static_system2dp {
     std::vector<size_t> parent_of;    // parent frame index per frame (root: itself)
     std::unordered_map<std::string, size_t> name_to_idx; // frame name -> index
 
+    // forward-kinematics cache: body -> world motor per frame, i.e. get_pos_trafo(i, 0).
+    // set_pose() only marks a frame stale (O(1)); the cache is refreshed lazily on the
+    // next world query by a single sweep in index order (parents precede children), so
+    // a frame is recomputed only if it or one of its ancestors changed.
+    std::vector<mvec2dp_u> fk_motor; // cached body -> world motor per frame
+    std::vector<char> fk_stale;      // frame pose (or an ancestor pose) changed
+    size_t fk_first_stale{0};        // lowest stale index (== size(): cache is valid)
+
+    // ancestor index: pre-order (Euler-tour) intervals, maintained by add_frame(). The
+    // subtree of frame i occupies the contiguous range tour[tour_in[i], tour_out[i]) of
+    // the pre-order sequence, so "a is an ancestor of i" reduces to two comparisons
+    //
+    //   tour_in[a] <= tour_in[i] < tour_out[a]
+    //
+    // instead of a walk along the parent pointers.
+    std::vector<size_t> tour;     // frame indices in pre-order (tour[tour_in[i]] == i)
+    std::vector<size_t> tour_in;  // pre-order position of frame i
+    std::vector<size_t> tour_out; // one past the last pre-order position in i's subtree
+
   public:
 
     static_system2dp() = default; // create an empty system
@@ -431,6 +458,10 @@ class static_system2dp {
         name_to_idx.emplace(rf.get_name(), new_idx);
         vfr.push_back(rf);
         parent_of.push_back(parent_idx);
+        fk_motor.push_back(I_2dp_mv_u);
+        fk_stale.push_back(1);
+        fk_first_stale = std::min(fk_first_stale, new_idx);
+        insert_into_tour(new_idx, parent_idx);
     }
 
     // Look up a frame index by its name (throws if no such frame exists). Lets callers
@@ -476,8 +507,10 @@ class static_system2dp {
         // identity transformation (M is the pseudoscalar, the neutral element of rgpr())
         if (from_idx == to_idx) return I_2dp_mv_u; // unit pseudoscalar = identity trafo
 
-        // ancestor chain of `to` (incl. to and the root); used to locate the LCA
-        auto const to_chain = ancestor_chain(to_idx); // [to, parent(to), ..., root]
+        // fast paths vs. the root: served from the forward-kinematics cache in O(1)
+        // (after an O(#stale subtree) refresh if poses changed since the last query)
+        if (to_idx == 0) return world_motor(from_idx);       // body -> world
+        if (from_idx == 0) return rrev(world_motor(to_idx)); // world -> body
 
         // M_up: from -> LCA. Each child -> parent step is rrev(step_pos_trafo(child)).
         // A step further up is applied AFTER the accumulated motor -> multiplied on the
@@ -485,18 +518,18 @@ class static_system2dp {
         // A))).
         mvec2dp_u M_up = I_2dp_mv_u;
         size_t node = from_idx;
-        while (std::find(to_chain.begin(), to_chain.end(), node) == to_chain.end()) {
+        while (!is_ancestor(node, to_idx)) { // O(1) interval test locates the LCA
             M_up = rgpr(rrev(step_pos_trafo(node)), M_up);
             node = parent_of[node];
         }
         size_t const lca = node;
 
-        // M_down: LCA -> to. Each parent -> child step is step_pos_trafo(child). Walk the
-        // prefix of to_chain above the LCA; the deepest child (to) is applied last and so
-        // ends up on the far LEFT (rgpr is associative, so left-folding preserves order).
+        // M_down: LCA -> to. Each parent -> child step is step_pos_trafo(child). Walk up
+        // from `to` to the LCA; the deepest child (to) is applied last and so ends up on
+        // the far LEFT (rgpr is associative, so left-folding preserves order).
         mvec2dp_u M_down = I_2dp_mv_u;
-        for (size_t j = 0; to_chain[j] != lca; ++j) {
-            M_down = rgpr(M_down, step_pos_trafo(to_chain[j]));
+        for (size_t n = to_idx; n != lca; n = parent_of[n]) {
+            M_down = rgpr(M_down, step_pos_trafo(n));
         }
 
         // apply the up-segment first, then the down-segment
@@ -542,26 +575,97 @@ class static_system2dp {
     static_frame2dp const& frame(size_t idx) const { return vfr[idx]; }
     size_t parent(size_t idx) const { return parent_of[idx]; }
 
+    // Is frame `anc` on the path from frame `idx` up to the root (inclusive, i.e. every
+    // frame is its own ancestor)? O(1) via the pre-order interval index.
+    bool is_ancestor(size_t anc, size_t idx) const
+    {
+        return tour_in[anc] <= tour_in[idx] && tour_in[idx] < tour_out[anc];
+    }
+
+    // The subtree rooted at frame idx (idx first, then its descendants in pre-order) as a
+    // contiguous read-only range, e.g. "for (size_t i : subtree(idx)) ...".
+    std::span<size_t const> subtree(size_t idx) const
+    {
+        return std::span<size_t const>(tour).subspan(tour_in[idx],
+                                                     tour_out[idx] - tour_in[idx]);
+    }
+
+    // number of frames in the subtree rooted at idx (incl. idx itself)
+    size_t subtree_size(size_t idx) const { return tour_out[idx] - tour_in[idx]; }
+
     // reposition frame idx relative to its parent (origin expected unitized, z = 1)
     void set_pose(size_t idx, vec2dp const& origin, value_t phi)
     {
         vfr[idx].set_pose(origin, phi);
+        mark_stale(idx);
     }
 
     // reposition frame idx from a pose2dp (parallel to the 3D set_pose(idx, pose3dp))
-    void set_pose(size_t idx, pose2dp const& p) { vfr[idx].set_pose(p.origin, p.phi); }
+    void set_pose(size_t idx, pose2dp const& p)
+    {
+        vfr[idx].set_pose(p.origin, p.phi);
+        mark_stale(idx);
+    }
 
   private:
 
-    // chain of ancestors from idx up to the root: [idx, parent(idx), ..., root]
-    std::vector<size_t> ancestor_chain(size_t idx) const
+    // invalidate the cached world motor of frame idx (its subtree follows on refresh)
+    void mark_stale(size_t idx)
     {
-        std::vector<size_t> chain{idx};
-        while (parent_of[idx] != idx) { // root is its own parent
-            idx = parent_of[idx];
-            chain.push_back(idx);
+        fk_stale[idx] = 1;
+        fk_first_stale = std::min(fk_first_stale, idx);
+    }
+
+    // cached body -> world motor of frame idx (== the former LCA walk for to_idx == 0)
+    mvec2dp_u const& world_motor(size_t idx)
+    {
+        if (fk_first_stale < vfr.size()) refresh_world_motors();
+        return fk_motor[idx];
+    }
+
+    // Single sweep over [fk_first_stale, size()): staleness propagates from parent to
+    // child (parent index < child index), and only stale frames are recomposed from
+    // their parent's (already valid) world motor: world(j) = world(parent(j)) * (j ->
+    // parent(j)). The root IS the world frame: its motor stays the identity.
+    void refresh_world_motors()
+    {
+        for (size_t j = fk_first_stale; j < vfr.size(); ++j) {
+            size_t const par = parent_of[j];
+            if (par != j && fk_stale[par]) fk_stale[j] = 1;
+            if (!fk_stale[j]) continue;
+            fk_motor[j] =
+                (par == j) ? I_2dp_mv_u : rgpr(fk_motor[par], rrev(step_pos_trafo(j)));
+        }
+        std::fill(fk_stale.begin() + fk_first_stale, fk_stale.end(), 0);
+        fk_first_stale = vfr.size();
+    }
+
+    // Insert the new leaf `idx` as the last child of `par` into the pre-order index: it
+    // takes the position just past par's subtree, every frame at or behind that position
+    // shifts back by one and the subtrees of par and its ancestors grow by one. O(size())
+    // per added frame (construction time only); all queries stay O(1).
+    void insert_into_tour(size_t idx, size_t par)
+    {
+        if (idx == par) { // root
+            tour.assign(1, idx);
+            tour_in.assign(1, 0);
+            tour_out.assign(1, 1);
+            return;
+        }
+        size_t const pos = tour_out[par];
+        size_t const par_in = tour_in[par];
+        for (size_t i = 0; i < idx; ++i) {
+            if (tour_in[i] >= pos) { // behind the insertion point: shift
+                ++tour_in[i];
+                ++tour_out[i];
+            }
+            else if (tour_in[i] <= par_in && par_in < tour_out[i]) { // ancestor of idx
+                ++tour_out[i];
+            }
         }
-        return chain;
+        tour.insert(tour.begin() + static_cast<std::ptrdiff_t>(pos), idx);
+        tour_in.push_back(pos);
+        tour_out.push_back(pos + 1);
     }
 };
 
@@ -586,6 +690,12 @@ class static_system2dp {
 // signature and adds no overloads (its type IS vec2dp).
 using twist2dp = vec2dp;
 
+// SoA block of n points or free vectors for the batch point_velocity/point_acceleration
+// queries: row k holds component k (x, y, z), column i is point i -- an extent (3, n)
+// layout_right view with contiguous component rows. Results are free vectors (z = 0).
+using vec_block2dp = std::mdspan<value_t, std::dextents<size_t, 2>>;
+using vec_cblock2dp = std::mdspan<value_t const, std::dextents<size_t, 2>>;
+
 
 // Momentary kinematic state of a frame RELATIVE to its parent (physical inputs).
 //
@@ -728,6 +838,88 @@ class kinematic_system2dp : public static_system2dp {
         return rcmt(A, X) + rcmt(V, rcmt(V, X));
     }
 
+    // Block forms of velocity_field / accel_field: one twist (pair), n points, with
+    // rcmt(vec, vec) written out component-wise and ONE loop per output row, so every
+    // loop streams over contiguous rows with few X/out alias checks and vectorizes.
+    // The row-wise loops rule out in-place use: throws std::invalid_argument unless X
+    // and out are both (3, n) blocks that do not overlap.
+    static void velocity_field(twist2dp const& V, vec_cblock2dp X, vec_block2dp out)
+    {
+        check_blocks("velocity_field", X, out);
+        size_t const n = X.extent(1);
+        if (n == 0) return;
+        value_t const a = V.x, b = V.y, w = V.z;
+        value_t const *x = &X[0, 0], *y = &X[1, 0], *z = &X[2, 0];
+        value_t *o0 = &out[0, 0], *o1 = &out[1, 0], *o2 = &out[2, 0];
+        for (size_t i = 0; i < n; ++i)
+            o0[i] = b * z[i] - w * y[i];
+        for (size_t i = 0; i < n; ++i)
+            o1[i] = -a * z[i] + w * x[i];
+        std::fill(o2, o2 + n, value_t(0.0)); // free vectors
+    }
+
+    static void accel_field(twist2dp const& V, twist2dp const& A, vec_cblock2dp X,
+                            vec_block2dp out)
+    {
+        check_blocks("accel_field", X, out);
+        size_t const n = X.extent(1);
+        if (n == 0) return;
+        value_t const a = V.x, b = V.y, w = V.z;
+        value_t const c = A.x, d = A.y, al = A.z;
+        value_t const *x = &X[0, 0], *y = &X[1, 0], *z = &X[2, 0];
+        value_t *o0 = &out[0, 0], *o1 = &out[1, 0], *o2 = &out[2, 0];
+        // a = rcmt(A, X) + rcmt(V, v) with v = rcmt(V, X) (a free vector, z = 0)
+        for (size_t i = 0; i < n; ++i) {
+            value_t const vy = -a * z[i] + w * x[i];
+            o0[i] = d * z[i] - al * y[i] - w * vy;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            value_t const vx = b * z[i] - w * y[i];
+            o1[i] = -c * z[i] + al * x[i] + w * vx;
+        }
+        std::fill(o2, o2 + n, value_t(0.0)); // free vectors
+    }
+
+    // World velocity & acceleration twist pair of a frame (see world_VA_all below).
+    struct world_va2dp {
+        twist2dp V; // velocity twist
+        twist2dp A; // acceleration twist
+    };
+
+    // World velocity & acceleration twists of ALL frames in ONE topological sweep,
+    // written into the caller-provided buffer va (va[i] <-> frame i; needs
+    // va.size() >= size()).
+    //
+    // A parent is always added before its children, so ascending index order IS a
+    // root -> leaf order and every frame reuses the finished entry of its parent:
+    //
+    //   va[i].V = va[parent].V + Ad(xi_i)
+    //   va[i].A = va[parent].A + Ad(xidot_i) + [va[i].V, Ad(xi_i)]
+    //
+    // One world motor per frame instead of a root -> idx path walk per frame. The buffer
+    // is a snapshot -- refill it after any change of poses or twists.
+    void world_VA_all(std::span<world_va2dp> va)
+    {
+        if (va.size() < size()) {
+            throw std::runtime_error(std::string("world_VA_all: buffer holds ") +
+                                     std::to_string(va.size()) +
+                                     std::string(" entries, system has ") +
+                                     std::to_string(size()) + std::string(" frames"));
+        }
+        for (size_t i = 0; i < size(); ++i) {
+            auto const par = parent(i);
+            if (par == i) { // root contributes nothing
+                va[i] = {twist2dp{0.0, 0.0, 0.0}, twist2dp{0.0, 0.0, 0.0}};
+                continue;
+            }
+            auto const M = get_pos_trafo(i, 0);
+            auto const zeta = move2dp(rel_vtwist[i], M);    // Ad(xi_i)     world rel. vel
+            auto const zetadot = move2dp(rel_atwist[i], M); // Ad(xidot_i)  world rel. acc
+            auto const V = va[par].V + zeta;
+            va[i] = {V, va[par].A + zetadot + rcmt(V, zeta)};
+        }
+    }
+
     // Velocity of a world-space point X rigidly attached to frame idx. (The
     // dimension-neutral rcmt form is a later refinement; this explicit field is exact.)
     vec2dp point_velocity(vec2dp const& X_world, size_t idx)
@@ -735,6 +927,21 @@ class kinematic_system2dp : public static_system2dp {
         return velocity_field(twist_world(idx), X_world);
     }
 
+    // same, read from a buffer filled by world_VA_all (no propagation per query)
+    static vec2dp point_velocity(vec2dp const& X_world, size_t idx,
+                                 std::span<world_va2dp const> va)
+    {
+        return velocity_field(va[idx].V, X_world);
+    }
+
+    // Batch form: velocities of the n world-space points X (a (3, n) SoA block) all
+    // rigidly attached to frame idx, written into out. The frame's world twist is
+    // derived ONCE for the whole block.
+    void point_velocity(vec_cblock2dp X_world, size_t idx, vec_block2dp out)
+    {
+        velocity_field(twist_world(idx), X_world, out);
+    }
+
     vec2dp point_velocity(vec2dp const& X_world, std::string const& frame_name)
     {
         return point_velocity(X_world, index_of(frame_name));
@@ -786,6 +993,20 @@ class kinematic_system2dp : public static_system2dp {
         return accel_field(va.V, va.A, X_world);
     }
 
+    // same, read from a buffer filled by world_VA_all (no propagation per query)
+    static vec2dp point_acceleration(vec2dp const& X_world, size_t idx,
+                                     std::span<world_va2dp const> va)
+    {
+        return accel_field(va[idx].V, va[idx].A, X_world);
+    }
+
+    // Batch form (see the batch point_velocity): one world_VA(idx) for the whole block.
+    void point_acceleration(vec_cblock2dp X_world, size_t idx, vec_block2dp out)
+    {
+        auto const va = world_VA(idx);
+        accel_field(va.V, va.A, X_world, out);
+    }
+
     vec2dp point_acceleration(vec2dp const& X_world, std::string const& frame_name)
     {
         return point_acceleration(X_world, index_of(frame_name));
@@ -870,6 +1091,27 @@ class kinematic_system2dp : public static_system2dp {
 
   private:
 
+    // shape and overlap check shared by the block field kernels: they write one output
+    // row per loop and read all input rows in each loop, so out must not share storage
+    // with X (in place, a later loop would read the rows an earlier one overwrote)
+    static void check_blocks(char const* fn, vec_cblock2dp X, vec_block2dp out)
+    {
+        if (X.extent(0) != 3 || out.extent(0) != 3 || X.extent(1) != out.extent(1)) {
+            throw std::invalid_argument(
+                std::string(fn) +
+                std::string(": expected two (3, n) point blocks of equal n"));
+        }
+        value_t const* xb = X.data_handle();
+        value_t const* xe = xb + X.extent(0) * X.extent(1);
+        value_t const* ob = out.data_handle();
+        value_t const* oe = ob + out.extent(0) * out.extent(1);
+        if (std::less<>{}(ob, xe) && std::less<>{}(xb, oe)) {
+            throw std::invalid_argument(
+                std::string(fn) +
+                std::string(": point blocks X and out must not overlap"));
+        }
+    }
+
     // World velocity & acceleration twists of frame idx, propagated root -> idx by the
     // recursive Newton-Euler relations (twists transported to world by the adjoint):
     //
@@ -877,11 +1119,6 @@ class kinematic_system2dp : public static_system2dp {
     //   (Coriolis / centrifugal coupling)
     //
     //  The se(2) twist Lie bracket [.,.] is the regressive commutator rcmt(.,.) on twists
-    struct world_va2dp {
-        twist2dp V; // velocity twist
-        twist2dp A; // acceleration twist
-    };
-
     world_va2dp world_VA(size_t idx)
     {
         // build the path root -> idx
@@ -1006,12 +1243,26 @@ struct grounded_spring2dp {
     value_t c{0.0};          // linear (isotropic) damping on the point velocity
 };
 
+// Tabulated applied wrench (world frame) over time: samples of a bivec2dp interpolated
+// linearly or by a natural cubic spline (see tabulated_profile in ga_usr_utilities.hpp).
+// The built-in, callback-free form of dynamic_system2dp::set_applied_wrench.
+using wrench_profile2dp = tabulated_profile<bivec2dp>;
+
+// Forward-dynamics algorithm selectable on dynamic_system2dp (see set_forward_dynamics):
+//   dense -- assemble the joint-space mass matrix M(q) (composite-rigid-body algorithm)
+//            + RHS (assemble_mass_bias) and solve by the tree-sparse LTDL factorization:
+//            O(n d^2) for tree depth d, i.e. O(n^3) for a serial chain (default)
+//   aba   -- Featherstone's articulated-body algorithm: three sweeps over the frame tree,
+//            O(n) per rhs evaluation, the same joint accelerations as the dense path
+// (2D twin of fd_method3dp.)
+enum class fd_method2dp { dense, aba };
+
 
 class dynamic_system2dp : public kinematic_system2dp {
 
     // The optional closed-loop layer (ga_pga2dp_ops_constraints.hpp) composes a
     // dynamic_system2dp as its spanning tree and reuses this class's private assembly
-    // seam (assemble_mass_bias, the joint screws, dof_joints/is_ancestor,
+    // seam (assemble_mass_bias, the joint screws, dof_joints,
     // apply_joint_state) to build the loop-closure constraint Jacobian and the
     // constrained dynamics on top -- without those internals becoming public API.
     friend class closed_loop_system2dp;
@@ -1021,17 +1272,27 @@ class dynamic_system2dp : public kinematic_system2dp {
     vec2dp grav{0.0, -9.81, 0.0}; // uniform gravity field [world frame, z = 0 direction]
 
     // Optional time-varying applied wrench per frame (world frame), folded into tau as an
-    // external generalised force. Sparse map (frame index -> wrench function of time); a
-    // frame without an entry has no applied wrench. The simulation clock `time_` is the
-    // argument passed at each RK4 sub-step (set transiently by coupled_step). Only the
-    // jointed (assemble_mass_bias) path consumes it; free bodies see gravity only.
+    // external generalised force. Flat registry sorted by frame (frame index -> wrench of
+    // time); a frame without an entry has no applied wrench. The simulation clock `time_`
+    // is the argument passed at each RK4 sub-step (set transiently by coupled_step). Only
+    // the jointed (assemble_mass_bias) path consumes it; free bodies see gravity only.
+    //
+    // The wrench is either a built-in tabulated profile (wrench_profile2dp, evaluated
+    // in place) or -- opt-in, for anything a table can't express -- a type-erased
+    // callback. The registry is walked once per integrator stage, so with hundreds of
+    // loaded frames the contiguous entries and the direct profile call matter.
     using wrench_fn = std::function<bivec2dp(value_t)>;
-    std::unordered_map<size_t, wrench_fn> wrench_;
+    struct applied_wrench {
+        wrench_profile2dp profile; // used unless fn is set
+        wrench_fn fn;
+        bivec2dp operator()(value_t t) const { return fn ? fn(t) : profile(t); }
+    };
+    frame_registry<applied_wrench> wrench_;
     value_t time_{0.0}; // simulation clock [s], advanced by step()
 
     // Optional KINEMATICALLY DRIVEN joints: a 1-DOF joint whose coordinate is PRESCRIBED
     // q(t) = q0 + rate*t (constant rate) rather than integrated from the dynamics -- a
-    // motor-driven spin or a steady feed. A joint is "driven" iff it appears in this map
+    // motor-driven spin or a steady feed. A joint is "driven" iff it has an entry here
     // (it keeps its revolute/prismatic screw machinery, but is excluded from dof_joints
     // and instead re-evaluated from q(t) at each sub-step). The driven motion is a moving
     // base for the dynamic sub-chain below it: its velocity (omega*screw) propagates into
@@ -1042,18 +1303,82 @@ class dynamic_system2dp : public kinematic_system2dp {
         value_t rate{0.0}; // prescribed q-dot
         value_t q0{0.0};   // q at t = 0
     };
-    std::unordered_map<size_t, driven_spec> driven_;
+    frame_registry<driven_spec> driven_;
 
     // Optional GROUNDED spatial springs/dampers per frame (a frame may carry several).
     // Configuration-dependent: their restoring wrench is recomputed from the live
     // pose/velocity at each RK4 sub-step, so it is folded into assemble_mass_bias like an
     // applied wrench, NOT prescribed as a function of time. See grounded_spring2dp.
-    std::unordered_map<size_t, std::vector<grounded_spring2dp>> springs_;
+    // One flat registry entry per spring, sorted by frame.
+    frame_registry<grounded_spring2dp> springs_;
+
+    // Selectable forward-dynamics algorithm (dense LU or articulated-body, see
+    // fd_method2dp). Only forward_dynamics() dispatches on it; the dense assembly seam
+    // used by mass_matrix() and the closed-loop layer is unaffected.
+    fd_method2dp fd_{fd_method2dp::dense};
+
+    // Selectable time integrator for the coupled joint chain (coupled_step), shared with
+    // dynamic_system3dp (integrator_kind, ga_usr_utilities.hpp): RK4 (default), ABM2
+    // (multistep -- its history persists across step() calls in `abm_`), DP54
+    // (error-controlled sub-steps across each step(dt); its step-size suggestion dp_dt_
+    // carries over) or the implicit SDIRK3 for stiff springs (its Jacobian + LU carry
+    // over in `sd_`). All share the same forward-dynamics rhs.
+    integrator_kind integ_{integrator_kind::rk4};
+    std::optional<rk4_integrator> rk4_;
+    std::optional<abm2_integrator> abm_;
+    std::optional<dp54_integrator> dp_;
+    std::optional<sdirk3_integrator> sd_;
+    value_t atol_{1.0e-9}, rtol_{1.0e-7}; // DP54 error / SDIRK3 Newton tolerances
+    value_t dp_dt_{0.0};                        // DP54 suggested sub-step (0: none yet)
+
+    // extra wrench per free body for the current step (parent frame), or empty; see
+    // gather_free_body_wrenches
+    std::vector<bivec2dp> fw_;
+    std::vector<std::pair<size_t, bivec2dp>> xw_; // append_extra_wrenches() buffer
+
+    // the pairs of the append_extra_wrenches() seam for the current state, gathered
+    // into xw_ (valid until the next call)
+    std::vector<std::pair<size_t, bivec2dp>> const& collect_extra_wrenches()
+    {
+        xw_.clear();
+        append_extra_wrenches(xw_);
+        return xw_;
+    }
 
   public:
 
     dynamic_system2dp() = default;
 
+    // Virtual so an application subclass (e.g. a contact/penalty force model)
+    // can be owned and deleted polymorphically.
+    virtual ~dynamic_system2dp() = default;
+
+  protected:
+
+    // Extension point for a subclass: inject configuration-dependent world
+    // wrenches into the force assembly, evaluated at each RK4 sub-step. Each
+    // returned (frame_idx, wrench) pair is folded onto that frame's supporting
+    // joints exactly like an applied wrench (same spatial_dot(S_j, W) pairing).
+    // A pair on a FREE body's frame acts on that body directly (evaluated once per
+    // step, see gather_free_body_wrenches). Several pairs may name the same frame.
+    // The generic base contributes none; a subclass overrides this to add its
+    // own force elements without the base knowing anything about them (e.g.
+    // contact_system2dp in ga_pga2dp_ops_contact.hpp). 2D twin of
+    // dynamic_system3dp::extra_wrenches.
+    virtual std::vector<std::pair<size_t, bivec2dp>> extra_wrenches() { return {}; }
+
+    // Allocation-free form of the same seam, the one the base calls: append the pairs
+    // to out (cleared by the caller, a reused buffer). The default forwards to the
+    // returning extra_wrenches() above. 2D twin of
+    // dynamic_system3dp::append_extra_wrenches.
+    virtual void append_extra_wrenches(std::vector<std::pair<size_t, bivec2dp>>& out)
+    {
+        auto const w = extra_wrenches();
+        out.insert(out.end(), w.begin(), w.end());
+    }
+
+  public:
+
     // add a frame WITHOUT inertia (e.g. the inertial root); keeps body[]/joint[] in sync
     // with the base frame list. Mirrors the two base add_frame overloads.
     void add_frame(static_frame2dp const& f, kin_state2dp const& k,
@@ -1112,12 +1437,25 @@ class dynamic_system2dp : public kinematic_system2dp {
     // as an external generalised force projected onto each supporting joint screw. The
     // wrench is a bivec2dp (force/moment); for a pure force F through a point P use
     // wdg(P, F). Evaluated at each RK4 sub-step time. Pass an empty function to clear.
+    // Replaces any wrench (callback or profile) already attached to the frame.
     void set_applied_wrench(size_t idx, wrench_fn fn)
     {
-        if (fn) wrench_[idx] = std::move(fn);
+        if (fn) wrench_.assign(idx, applied_wrench{{}, std::move(fn)});
         else wrench_.erase(idx);
     }
 
+    // Attach a tabulated applied wrench (world frame): samples interpolated linearly or
+    // by a natural cubic spline, held constant outside the table. The built-in,
+    // allocation- and callback-free form of the above, e.g.
+    //
+    //     sys.set_applied_wrench(i, wrench_profile2dp(t, W, profile_interp::cubic));
+    void set_applied_wrench(size_t idx, wrench_profile2dp profile)
+    {
+        wrench_.assign(idx, applied_wrench{std::move(profile), {}});
+    }
+
+    void clear_applied_wrench(size_t idx) { wrench_.erase(idx); }
+
     value_t time() const { return time_; }  // simulation clock [s]
     void set_time(value_t t) { time_ = t; } // reset / seed the clock
 
@@ -1127,12 +1465,12 @@ class dynamic_system2dp : public kinematic_system2dp {
     // for the dynamic sub-chain below it. Use for a motor-driven spin or a steady feed.
     void set_driven_rate(size_t idx, value_t rate, value_t q0 = 0.0)
     {
-        driven_[idx] = driven_spec{rate, q0};
+        driven_.assign(idx, driven_spec{rate, q0});
         apply_driven_joints(); // seed the joint state at the current clock
     }
 
     void clear_driven_joint(size_t idx) { driven_.erase(idx); }
-    bool is_driven(size_t idx) const { return driven_.count(idx) != 0; }
+    bool is_driven(size_t idx) const { return driven_.contains(idx); }
 
     value_t joint_phi(size_t idx) const { return joint[idx].phi; }     // revolute angle
     value_t joint_omega(size_t idx) const { return joint[idx].omega; } // revolute rate
@@ -1157,17 +1495,46 @@ class dynamic_system2dp : public kinematic_system2dp {
                              value_t c = 0.0)
     {
         vec2dp const p0 = unitize(move2dp(anchor_b, get_pos_trafo(idx, 0)));
-        springs_[idx].push_back(grounded_spring2dp{anchor_b, p0, k, c});
+        springs_.append(idx, grounded_spring2dp{anchor_b, p0, k, c});
     }
 
     void add_grounded_spring(size_t idx, vec2dp const& anchor_b, vec2dp const& p0_world,
                              vec2dp const& k, value_t c)
     {
-        springs_[idx].push_back(grounded_spring2dp{anchor_b, p0_world, k, c});
+        springs_.append(idx, grounded_spring2dp{anchor_b, p0_world, k, c});
     }
 
     void clear_grounded_springs(size_t idx) { springs_.erase(idx); }
 
+    // Select the forward-dynamics algorithm for the coupled joint chain: the dense
+    // mass-matrix path (default, O(n^3)) or the O(n) articulated-body algorithm. A pure
+    // performance switch -- both yield the same joint accelerations (to rounding).
+    void set_forward_dynamics(fd_method2dp m) { fd_ = m; }
+    fd_method2dp get_forward_dynamics() const { return fd_; }
+
+    // Select the time integrator for the coupled joint chain: RK4 (default), ABM2, DP54
+    // or SDIRK3 (see integrator_kind). Switching resets the ABM2 history and the DP54
+    // step-size suggestion so the next step() self-starts cleanly.
+    void set_integrator(integrator_kind k)
+    {
+        integ_ = k;
+        abm_.reset(); // restart the multistep history on any switch
+        dp_dt_ = 0.0;
+    }
+    integrator_kind get_integrator() const { return integ_; }
+
+    // Absolute / relative per-component tolerances on the joint state [phi, omega]: the
+    // DP54 error control (step(dt) advances the full dt in as many sub-steps as these
+    // need) and the SDIRK3 Newton convergence test.
+    void set_tolerances(value_t atol, value_t rtol)
+    {
+        if (!(atol >= 0.0 && rtol >= 0.0 && atol + rtol > 0.0))
+            throw std::invalid_argument(
+                "set_tolerances: need atol, rtol >= 0, not both 0");
+        atol_ = atol;
+        rtol_ = rtol;
+    }
+
     // Current angular acceleration of revolute joint `idx`, from the COUPLED joint-space
     // forward dynamics at the present state (no integration).
     value_t joint_accel(size_t idx)
@@ -1194,15 +1561,16 @@ class dynamic_system2dp : public kinematic_system2dp {
 
     // Advance the system by dt. The dof joints form a COUPLED chain integrated together
     // in their reduced (joint-coordinate) state via the joint-space forward dynamics;
-    // free bodies are integrated independently. RK4 throughout.
+    // free bodies are integrated independently. The chain uses the selected integrator
+    // (see set_integrator); free bodies always use RK4.
     void step(value_t dt)
     {
+        gather_free_body_wrenches(); // at the state of time t, before the joints move
         auto const rj = dof_joints();
         if (!rj.empty())
             coupled_step(rj, dt); // uses time_ for sub-step wrench/drive eval
         for (size_t i = 1; i < size(); ++i)
-            if (joint[i].type == joint2dp::free && body[i].mass > 0.0)
-                step_free_body(i, dt);
+            if (is_free_body(i)) step_free_body(i, dt);
         time_ += dt;           // advance the clock (coupled_step restores it to t0)
         apply_driven_joints(); // prescribe the driven joints at t + dt (final state)
     }
@@ -1236,13 +1604,10 @@ class dynamic_system2dp : public kinematic_system2dp {
             pe += 0.5 * joint[i].stiffness * dq * dq;
         }
         // grounded-spring potential 1/2 (k.x dx^2 + k.y dy^2)
-        for (auto const& [fi, sps] : springs_) {
-            auto const M = get_pos_trafo(fi, 0);
-            for (auto const& sp : sps) {
-                vec2dp const P = unitize(move2dp(sp.anchor_b, M));
-                vec2dp const d = P - sp.p0_world;
-                pe += 0.5 * (sp.k.x * d.x * d.x + sp.k.y * d.y * d.y);
-            }
+        for (auto const& [fi, sp] : springs_) {
+            vec2dp const P = unitize(move2dp(sp.anchor_b, get_pos_trafo(fi, 0)));
+            vec2dp const d = P - sp.p0_world;
+            pe += 0.5 * (sp.k.x * d.x * d.x + sp.k.y * d.y * d.y);
         }
         return pe;
     }
@@ -1252,35 +1617,8 @@ class dynamic_system2dp : public kinematic_system2dp {
     // Joint-space mass matrix M(q) (n*n row-major, n = number of revolute joints) at the
     // current configuration. A diagnostic / showcase quantity: the reduced inertia of the
     // articulated system, with the identity  1/2 * qdot^T M(q) qdot == kinetic_energy().
-    std::vector<value_t> mass_matrix()
-    {
-        auto const rj = dof_joints();
-        size_t const n = rj.size();
-        std::vector<twist2dp> S(n); // world joint screws (unit rate)
-        std::vector<mvec2dp_u> Minv(
-            n); // world -> body i motor (pulls a twist into body i)
-        for (size_t i = 0; i < n; ++i) {
-            auto const M = get_pos_trafo(rj[i], 0); // body i -> world
-            S[i] = move2dp(joint[rj[i]].screw_b, M);
-            Minv[i] = rrev(M);
-        }
-        std::vector<value_t> Mmat(n * n, 0.0);
-        for (size_t i = 0; i < n; ++i) {
-            auto const& I = body[rj[i]].I; // inertia map about body i's cm (body frame)
-            for (size_t j = 0; j < n; ++j) {
-                if (!is_ancestor(rj[j], rj[i])) continue;
-                twist2dp const xj = move2dp(S[j], Minv[i]); // joint-j screw in body i
-                for (size_t k = 0; k < n; ++k) {
-                    if (!is_ancestor(rj[k], rj[i])) continue;
-                    twist2dp const xk = move2dp(S[k], Minv[i]);
-                    // inertia-map quadratic form: carries mass + angular term uniformly
-                    // (no S.z split), and is the form that lifts unchanged to 3D.
-                    Mmat[j * n + k] += spatial_dot(xj, I(xk));
-                }
-            }
-        }
-        return Mmat;
-    }
+    // Built by the composite-rigid-body algorithm (see crba_mass_matrix).
+    std::vector<value_t> mass_matrix() { return crba_mass_matrix(dof_joints(), false); }
 
   private:
 
@@ -1298,6 +1636,35 @@ class dynamic_system2dp : public kinematic_system2dp {
         return -value_t(rwdg(xi, mom));
     }
 
+    // Extra wrenches (extra_wrenches()) acting on FREE bodies. The jointed path folds
+    // them in at every RK4 sub-step; a free body is integrated on its own, so its share
+    // is evaluated once at the start of the step and held over it (first-order
+    // splitting, the usual treatment of penalty contact in a per-body integrator).
+    // Stored per frame in fw_, pulled into the parent frame the free body's pose lives
+    // in; fw_ stays empty if there is none (and extra_wrenches() is not even called
+    // without free bodies). 2D twin of dynamic_system3dp::gather_free_body_wrenches.
+    void gather_free_body_wrenches()
+    {
+        fw_.clear();
+        bool any_free = false;
+        for (size_t i = 1; i < size() && !any_free; ++i)
+            any_free = is_free_body(i);
+        if (!any_free) return;
+        for (auto const& [fi, W] : collect_extra_wrenches()) {
+            if (!is_free_body(fi)) continue;
+            if (fw_.empty()) fw_.assign(size(), bivec2dp{});
+            fw_[fi] = fw_[fi] + move2dp(W, rrev(get_pos_trafo(parent(fi), 0)));
+        }
+    }
+
+    // a free joint carrying mass: integrated on its own (step_free_body), outside the
+    // joint-space dynamics; its wrenches never reach the jointed ancestors. 2D twin of
+    // dynamic_system3dp::is_free_body.
+    bool is_free_body(size_t idx) const
+    {
+        return joint[idx].type == joint2dp::free && body[idx].mass > 0.0;
+    }
+
     // RK4-integrate one free rigid body (frame idx) over dt under gravity. The
     // integration state is the Lie-algebra pair (B, Omega): B is the relative generator
     // accumulated from the current relative pose M0 (so M(t) = M0 (x) rexp(1/2 B)), Omega
@@ -1310,10 +1677,12 @@ class dynamic_system2dp : public kinematic_system2dp {
         value_t const m = body[idx].mass;
 
         // body-frame twist rate from the gravity wrench acting at the cm (= body origin)
+        // plus the extra wrench held over the step (see gather_free_body_wrenches)
+        bivec2dp const W_ext = fw_.empty() ? bivec2dp{} : fw_[idx];
         auto omega_dot = [&](vec2dp const& B, twist2dp const& Om) -> twist2dp {
             auto const M = rgpr(M0, rexp(0.5 * B));            // pose at this stage
             auto const W_w = wdg(move2dp(O_2dp, M), m * grav); // gravity wrench (world)
-            auto const W_b = move2dp(W_w, rrev(M)); // pulled into the body frame
+            auto const W_b = move2dp(W_w + W_ext, rrev(M));    // into the body frame
             return compute_omega_dot(I_inv, W_b, Om, I);
         };
 
@@ -1398,25 +1767,17 @@ class dynamic_system2dp : public kinematic_system2dp {
         for (size_t i = 1; i < size(); ++i)
             if ((joint[i].type == joint2dp::revolute ||
                  joint[i].type == joint2dp::prismatic) &&
-                driven_.count(i) == 0)
+                !driven_.contains(i))
                 rj.push_back(i);
         return rj;
     }
 
-    // Is joint frame `jf` on the path from body `bf` up to the root (inclusive)?
-    bool is_ancestor(size_t jf, size_t bf) const
-    {
-        for (size_t n = bf;; n = parent(n)) {
-            if (n == jf) return true;
-            if (parent(n) == n) return false; // reached the root
-        }
-    }
-
     // Assemble the joint-space mass matrix M(q) and the generalised-force RHS for the
     // 1-DOF joint chain `rj`, by virtual work over the bodies (all quantities GA-native):
     //
     //   M[j][k] = sum_i  spatial_dot( S_j^body_i , I_i( S_k^body_i ) )  over bodies i
-    //             having BOTH joints j,k as ancestors  (the spatial inertia-map form);
+    //             having BOTH joints j,k as ancestors  (the spatial inertia-map form;
+    //             evaluated by crba_mass_matrix as <S_j, Ic_k(S_k)>, the same sum);
     //   RHS[j]  = sum_i m_i ( vcm_i(S_j) . g  -  vcm_i(S_j) . b_cm_i )  over bodies i
     //   having
     //             joint j as ancestor  (gravity generalised force minus Coriolis bias).
@@ -1475,22 +1836,16 @@ class dynamic_system2dp : public kinematic_system2dp {
             mass[i] = body[fb].mass;
         }
 
-        std::vector<value_t> Mmat(n * n, 0.0), RHS(n, 0.0);
+        // M(q) by the composite-rigid-body algorithm (incl. the driven bodies' inertia)
+        std::vector<value_t> Mmat = crba_mass_matrix(rj, true);
+
+        std::vector<value_t> RHS(n, 0.0);
         for (size_t j = 0; j < n; ++j) {
             for (size_t i = 0; i < nb; ++i) { // contribution of body i to coordinate j
                 if (!is_ancestor(rj[j], bl[i])) continue;
                 vec2dp const vj = velocity_field(S[j], cm[i]); // rcmt(S_j, cm_i)
                 RHS[j] += mass[i] * (vj.x * grav.x + vj.y * grav.y) -
                           mass[i] * (vj.x * bcm[i].x + vj.y * bcm[i].y);
-                auto const& I = body[bl[i]].I; // inertia about body i's cm (body frame)
-                twist2dp const xj = move2dp(S[j], Minv[i]); // joint-j screw in body i
-                for (size_t k = 0; k < n; ++k) {
-                    if (!is_ancestor(rj[k], bl[i])) continue;
-                    twist2dp const xk = move2dp(S[k], Minv[i]);
-                    // inertia-map quadratic form: carries mass + angular term uniformly
-                    // (no S.z split), and is the form that lifts unchanged to 3D.
-                    Mmat[j * n + k] += spatial_dot(xj, I(xk));
-                }
             }
         }
 
@@ -1507,9 +1862,8 @@ class dynamic_system2dp : public kinematic_system2dp {
         // spatial_dot(S_j, W) to every joint j that supports fi (j ancestor of fi). The
         // reciprocal pairing is the rate of work of W under unit joint rate -- the same
         // pairing that yields the gravity term. Zero unless a wrench was attached.
-        for (auto const& [fi, fn] : wrench_) {
-            if (!fn) continue;
-            bivec2dp const W = fn(time_);
+        for (auto const& [fi, aw] : wrench_) {
+            bivec2dp const W = aw(time_);
             for (size_t j = 0; j < n; ++j)
                 if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
         }
@@ -1519,75 +1873,317 @@ class dynamic_system2dp : public kinematic_system2dp {
         // anisotropic stiffness + isotropic damping); the force line wdg(P, F) is the
         // wrench, projected onto every supporting joint screw. Recomputed from state here
         // (not a function of time) -- the configuration-dependent path.
-        for (auto const& [fi, sps] : springs_) {
-            auto const M = get_pos_trafo(fi, 0);
-            twist2dp const Vw = twist_world(fi); // world velocity twist of frame fi
-            for (auto const& sp : sps) {
-                vec2dp const P = unitize(move2dp(sp.anchor_b, M)); // world point (z = 1)
-                vec2dp const v = velocity_field(Vw, P);            // world point velocity
-                vec2dp const F{-sp.k.x * (P.x - sp.p0_world.x) - sp.c * v.x,
-                               -sp.k.y * (P.y - sp.p0_world.y) - sp.c * v.y, 0.0};
-                bivec2dp const W = wdg(P, F);
-                for (size_t j = 0; j < n; ++j)
-                    if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
+        size_t fcur = size(); // frame of M / Vw below (none yet)
+        mvec2dp_u M{};
+        twist2dp Vw{};
+        for (auto const& [fi, sp] : springs_) {
+            if (fi != fcur) { // the registry is sorted: one fetch per loaded frame
+                M = get_pos_trafo(fi, 0);
+                Vw = twist_world(fi); // world velocity twist of frame fi
+                fcur = fi;
             }
+            vec2dp const P = unitize(move2dp(sp.anchor_b, M)); // world point (z = 1)
+            vec2dp const v = velocity_field(Vw, P);            // world point velocity
+            vec2dp const F{-sp.k.x * (P.x - sp.p0_world.x) - sp.c * v.x,
+                           -sp.k.y * (P.y - sp.p0_world.y) - sp.c * v.y, 0.0};
+            bivec2dp const W = wdg(P, F);
+            for (size_t j = 0; j < n; ++j)
+                if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
+        }
+
+        // application-specific external wrenches contributed by a subclass (e.g. a
+        // contact/penalty force model): each (frame, world-wrench) pair is projected onto
+        // its frame's supporting joints exactly like the grounded-spring path above.
+        // Empty in the generic base (extra_wrenches() returns nothing). Pairs on a free
+        // body act on that body alone (gather_free_body_wrenches).
+        for (auto const& [fi, W] : collect_extra_wrenches()) {
+            if (is_free_body(fi)) continue;
+            for (size_t j = 0; j < n; ++j)
+                if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
         }
         return {std::move(Mmat), std::move(RHS)};
     }
 
     // Joint-space forward dynamics for the chain `rj`: returns the joint accelerations
     // q-ddot solving  M(q) q-ddot = RHS(q, q-dot). Thin wrapper over assemble_mass_bias()
-    // (see there for the assembly and its bias-pass side effect) plus the shared LU
-    // solve.
+    // (see there for the assembly and its bias-pass side effect) plus the tree-sparse
+    // LTDL solve: M is SPD with the sparsity of the dof tree, so no pivoting is needed
+    // and entries between different branches are never touched.
     std::vector<value_t> forward_dynamics(std::vector<size_t> const& rj)
     {
-        auto const [Mmat, RHS] = assemble_mass_bias(rj);
-        return hd::ga::lu_solve(Mmat, RHS, rj.size()); // shared LU (detail/ga_solver.hpp)
+        if (fd_ == fd_method2dp::aba) return forward_dynamics_aba(rj);
+        auto [Mmat, RHS] = assemble_mass_bias(rj);
+        auto const lambda = dof_parents(rj);
+        hd::ga::ltdl_decomp(Mmat, lambda); // shared solver (detail/ga_solver.hpp)
+        hd::ga::ltdl_backsubs(Mmat, lambda, RHS);
+        return RHS;
     }
 
-    // RK4-integrate the coupled 1-DOF joint chain `rj` over dt in its joint coordinates
-    // via the shared rk4_step. The state is u = [phi_0..phi_{n-1}, omega_0..omega_{n-1}];
-    // the derivative (dphi, domega) = (omega, q-ddot) is recomputed each sub-step by
-    // writing u into the joint state, refreshing the kinematic poses + twists, and
-    // solving the coupled forward dynamics.
+    // sentinel: frame carries no dof coordinate (driven joint, plain frame, root)
+    static size_t constexpr no_dof = std::numeric_limits<size_t>::max();
+
+    // Parent structure of the dof tree for the tree-sparse LTDL factorization: for each
+    // coordinate k the slot of the nearest dof joint above rj[k] (driven joints and plain
+    // frames are skipped), or k itself if there is none. rj is in ascending frame order
+    // (dof_joints), so a parent slot is always smaller than its child's.
+    std::vector<size_t> dof_parents(std::vector<size_t> const& rj) const
+    {
+        size_t const nf = size();
+        std::vector<size_t> nearest(nf, no_dof); // nearest dof slot at or above a frame
+        for (size_t k = 0; k < rj.size(); ++k)
+            nearest[rj[k]] = k;
+        for (size_t i = 1; i < nf; ++i)
+            if (nearest[i] == no_dof) nearest[i] = nearest[parent(i)];
+        std::vector<size_t> lambda(rj.size());
+        for (size_t k = 0; k < rj.size(); ++k) {
+            size_t const up = nearest[parent(rj[k])];
+            lambda[k] = (up == no_dof) ? k : up;
+        }
+        return lambda;
+    }
+
+    // Joint-space mass matrix of the chain `rj` by the composite-rigid-body algorithm
+    // (CRBA), in the world frame -- the 2D twin of dynamic_system3dp::crba_mass_matrix:
+    // composite inertias Ic_i accumulated leaves -> root, then
+    //
+    //   M[k][j] = M[j][k] = <S_j, Ic_k(S_k)>   for j == k or j a dof ancestor of k
+    //
+    // (zero across branches). O(n d) instead of the O(n^2 nb) triple loop. Driven
+    // joints' bodies are included if with_driven (as in assemble_mass_bias).
+    std::vector<value_t> crba_mass_matrix(std::vector<size_t> const& rj, bool with_driven)
+    {
+        size_t const n = rj.size();
+        size_t const nf = size();
+        std::vector<char> loaded(nf, 0);
+        for (size_t k = 0; k < n; ++k)
+            loaded[rj[k]] = 1;
+        if (with_driven) {
+            for (auto const& [idx, d] : driven_)
+                loaded[idx] = 1;
+        }
+
+        // composite inertias, leaves -> root (parent index < child index)
+        std::vector<Inertia2dp<value_t>> Ic(nf);
+        for (size_t i = nf; i-- > 1;) {
+            if (loaded[i]) Ic[i] += world_inertia(body[i].I, get_pos_trafo(i, 0));
+            Ic[parent(i)] += Ic[i];
+        }
+
+        std::vector<twist2dp> S(n); // world joint screws
+        for (size_t k = 0; k < n; ++k)
+            S[k] = move2dp(joint[rj[k]].screw_b, get_pos_trafo(rj[k], 0));
+
+        auto const lambda = dof_parents(rj);
+        std::vector<value_t> Mmat(n * n, 0.0);
+        for (size_t k = 0; k < n; ++k) {
+            bivec2dp const F = Ic[rj[k]](S[k]); // composite momentum of unit rate k
+            Mmat[k * n + k] = spatial_dot(S[k], F);
+            for (size_t j = k; lambda[j] != j;) {
+                j = lambda[j];
+                Mmat[k * n + j] = Mmat[j * n + k] = spatial_dot(S[j], F);
+            }
+        }
+        return Mmat;
+    }
+
+    // World-frame inertia map of a body: X -> move2dp(I_b(move2dp(X, rrev(M))), M), as
+    // an Inertia2dp whose column k is the image of the k-th basis twist (e1, e2, e3
+    // components of the vec2dp twist), so articulated inertias accumulate with +=.
+    static Inertia2dp<value_t> world_inertia(Inertia2dp<value_t> const& I_b,
+                                             mvec2dp_u const& M)
+    {
+        auto const Minv = rrev(M);
+        std::array<twist2dp, 3> const e{twist2dp{1.0, 0.0, 0.0}, twist2dp{0.0, 1.0, 0.0},
+                                        twist2dp{0.0, 0.0, 1.0}};
+        Inertia2dp<value_t> Iw;
+        auto v = Iw.view();
+        for (size_t k = 0; k < 3; ++k) {
+            bivec2dp const col = move2dp(I_b(move2dp(e[k], Minv)), M);
+            v[0, k] = col.x;
+            v[1, k] = col.y;
+            v[2, k] = col.z;
+        }
+        return Iw;
+    }
+
+    // Joint-space forward dynamics for the chain `rj` by Featherstone's articulated-body
+    // algorithm, in the WORLD frame -- the 2D twin of dynamic_system3dp's
+    // forward_dynamics_aba (see there for the three sweeps). The body bias wrench is the
+    // spatial form gyro - W_ext with gyro = Ad(rcmt(V_body, I(V_body))); it is equivalent
+    // to the cm-acceleration form of assemble_mass_bias. Same bias-pass side effect.
+    std::vector<value_t> forward_dynamics_aba(std::vector<size_t> const& rj)
+    {
+        size_t const n = rj.size();
+        size_t const nf = size();
+
+        // velocity-product (bias) pass: zero the relative accel twists of the unknowns
+        for (size_t k = 0; k < n; ++k)
+            set_accel_twist(rj[k], twist2dp{0.0, 0.0, 0.0});
+
+        // per frame: slot of its coordinate in rj (or no_dof) and whether it carries
+        // inertia in the articulated chain (dof joints + driven joints, as dense path)
+        std::vector<size_t> slot(nf, no_dof);
+        std::vector<char> loaded(nf, 0);
+        for (size_t k = 0; k < n; ++k) {
+            slot[rj[k]] = k;
+            loaded[rj[k]] = 1;
+        }
+        for (auto const& [idx, d] : driven_)
+            loaded[idx] = 1;
+
+        std::vector<twist2dp> V(nf, twist2dp{0.0, 0.0, 0.0}), c(nf), S(nf);
+        std::vector<Inertia2dp<value_t>> IA(nf);
+        std::vector<bivec2dp> pA(nf, bivec2dp{0.0, 0.0, 0.0});
+
+        // 1. outward sweep: velocities, bias accelerations, body inertias + bias wrenches
+        for (size_t i = 1; i < nf; ++i) {
+            auto const M = get_pos_trafo(i, 0); // cached world motor
+            twist2dp const zeta = move2dp(relative_twist(i), M);
+            V[i] = V[parent(i)] + zeta;
+            c[i] = move2dp(relative_accel_twist(i), M) + rcmt(V[i], zeta);
+            if (slot[i] != no_dof) S[i] = move2dp(joint[i].screw_b, M);
+            if (loaded[i]) {
+                auto const& I = body[i].I;
+                IA[i] = world_inertia(I, M);
+                twist2dp const Vb = move2dp(V[i], rrev(M));
+                pA[i] = move2dp(rcmt(Vb, I(Vb)), M) -
+                        wdg(move2dp(O_2dp, M), body[i].mass * grav);
+            }
+        }
+
+        // external wrenches act on their frame's bias wrench (world frame)
+        for (auto const& [fi, aw] : wrench_)
+            pA[fi] = pA[fi] - aw(time_);
+        for (auto const& [fi, sp] : springs_) {
+            vec2dp const P = unitize(move2dp(sp.anchor_b, get_pos_trafo(fi, 0)));
+            vec2dp const v = velocity_field(V[fi], P);
+            vec2dp const F{-sp.k.x * (P.x - sp.p0_world.x) - sp.c * v.x,
+                           -sp.k.y * (P.y - sp.p0_world.y) - sp.c * v.y, 0.0};
+            pA[fi] = pA[fi] - wdg(P, F);
+        }
+        for (auto const& [fi, W] : collect_extra_wrenches())
+            if (!is_free_body(fi)) pA[fi] = pA[fi] - W; // free: its own integrator
+
+        // 2. inward sweep: articulated inertias + bias wrenches, folded into the parent
+        std::vector<bivec2dp> U(nf, bivec2dp{0.0, 0.0, 0.0});
+        std::vector<value_t> D(nf, 0.0), u(nf, 0.0);
+        for (size_t i = nf; i-- > 1;) {
+            Inertia2dp<value_t> Ia = IA[i];
+            bivec2dp pa = pA[i];
+            if (slot[i] != no_dof) {
+                auto const& js = joint[i];
+                U[i] = IA[i](S[i]);
+                D[i] = spatial_dot(S[i], U[i]);
+                if (std::abs(D[i]) < eps) {
+                    throw Solver_error(
+                        std::string("dynamic_system2dp: articulated-body inertia of "
+                                    "joint frame ") +
+                        std::to_string(i) + std::string(" is singular."));
+                }
+                value_t const tau =
+                    -js.stiffness * (js.phi - js.q_rest) - js.damping * js.omega;
+                u[i] = tau - spatial_dot(S[i], pA[i]);
+                // Ia = IA - U <., U> / D  (column k: the image of basis twist e_k)
+                auto v = Ia.view();
+                value_t const w0 = spatial_dot(twist2dp{1.0, 0.0, 0.0}, U[i]) / D[i];
+                value_t const w1 = spatial_dot(twist2dp{0.0, 1.0, 0.0}, U[i]) / D[i];
+                value_t const w2 = spatial_dot(twist2dp{0.0, 0.0, 1.0}, U[i]) / D[i];
+                std::array<value_t, 3> const Uc{U[i].x, U[i].y, U[i].z};
+                for (size_t r = 0; r < 3; ++r) {
+                    v[r, 0] -= Uc[r] * w0;
+                    v[r, 1] -= Uc[r] * w1;
+                    v[r, 2] -= Uc[r] * w2;
+                }
+                pa = pa + Ia(c[i]) + (u[i] / D[i]) * U[i];
+            }
+            else {
+                pa = pa + Ia(c[i]);
+            }
+            IA[parent(i)] += Ia;
+            pA[parent(i)] = pA[parent(i)] + pa;
+        }
+
+        // 3. outward sweep: accelerations and the joint accelerations (root fixed)
+        std::vector<twist2dp> A(nf, twist2dp{0.0, 0.0, 0.0});
+        std::vector<value_t> qdd(n, 0.0);
+        for (size_t i = 1; i < nf; ++i) {
+            twist2dp a = A[parent(i)] + c[i];
+            if (slot[i] != no_dof) {
+                value_t const qdd_i = (u[i] - spatial_dot(a, U[i])) / D[i];
+                qdd[slot[i]] = qdd_i;
+                a = a + qdd_i * S[i];
+            }
+            A[i] = a;
+        }
+        return qdd;
+    }
+
+    // Integrate the coupled 1-DOF joint chain `rj` over dt in its joint coordinates with
+    // the selected integrator (RK4 via the shared rk4_step, ABM2, DP54 sub-stepping
+    // adaptively across [t, t + dt], or the implicit SDIRK3). The state is
+    // u = [phi_0..phi_{n-1}, omega_0..omega_{n-1}]; the derivative (dphi, domega) =
+    // (omega, q-ddot) is recomputed at each stage by writing u into the joint state,
+    // refreshing the kinematic poses + twists, and solving the coupled forward dynamics.
     void coupled_step(std::vector<size_t> const& rj, value_t dt)
     {
         size_t const n = rj.size();
-        std::vector<value_t> u_mem(2 * n), uh_mem(2 * 2 * n), rhs_mem(2 * n);
+        size_t const dim = 2 * n;
+        std::vector<value_t> u_mem(dim);
         for (size_t k = 0; k < n; ++k) {
             u_mem[k] = joint[rj[k]].phi;
             u_mem[n + k] = joint[rj[k]].omega;
         }
-        auto u = std::mdspan<value_t, std::dextents<size_t, 1>>(u_mem.data(), 2 * n);
-        auto uh = std::mdspan<value_t, std::dextents<size_t, 2>>(uh_mem.data(), 2, 2 * n);
-        auto const rhs =
-            std::mdspan<value_t const, std::dextents<size_t, 1>>(rhs_mem.data(), 2 * n);
 
-        // apply the current u to the joint state, then solve forward dynamics -> rhs
-        auto apply_u = [&] {
+        // write u into the joint state (+ refresh the kinematic poses/twists)
+        auto write_u = [&](std::vector<value_t> const& u) {
             for (size_t k = 0; k < n; ++k) {
                 joint[rj[k]].phi = u[k];
                 joint[rj[k]].omega = u[n + k];
                 apply_joint_state(rj[k]);
             }
         };
-        // thread the RK4 sub-step time into time_ so a time-varying applied wrench is
-        // sampled at the correct stage time; restore the clock on exit (step() advances
-        // it by dt). t_i + {0, dt/2, dt/2, dt} for the four stages.
-        value_t const t0 = time_;
-        for (size_t s = 1; s <= 4; ++s) {
-            time_ = rk4_get_time(t0, dt, s - 1);
+
+        // derivative f(t, u) -> du shared by all integrators. Threading the stage time
+        // into time_ samples a time-varying applied wrench / driven joint at the correct
+        // stage time (RK4: t_i + {0, dt/2, dt/2, dt}); coupled_step restores the clock
+        // on exit and step() advances it by dt.
+        auto f = [&](value_t t, std::vector<value_t> const& u, std::vector<value_t>& du) {
+            time_ = t;
             apply_driven_joints(); // prescribe the moving base at this stage time
-            apply_u();
+            write_u(u);
             auto const qdd = forward_dynamics(rj);
             for (size_t k = 0; k < n; ++k) {
-                rhs_mem[k] = u[n + k];   // dphi/dt = omega
-                rhs_mem[n + k] = qdd[k]; // domega/dt = q-ddot
+                du[k] = u[n + k];   // dphi/dt = omega
+                du[n + k] = qdd[k]; // domega/dt = q-ddot
             }
-            rk4_step(u, uh, rhs, dt, s);
+        };
+
+        value_t const t0 = time_;
+        if (integ_ == integrator_kind::abm2) {
+            if (!abm_ || abm_->dim() != dim) abm_.emplace(dim); // (re)size the history
+            abm_->step(f, u_mem, t0, dt);
+        }
+        else if (integ_ == integrator_kind::dp54) {
+            if (!dp_ || dp_->dim() != dim) dp_.emplace(dim); // (re)size the stages
+            // no FSAL across step() calls: wrenches, springs or driven joints may have
+            // been edited in between, which u alone can't reveal
+            dp_->reset();
+            if (dp_dt_ <= 0.0) dp_dt_ = dt; // first call: start from the output interval
+            dp_->integrate(f, u_mem, t0, t0 + dt, dp_dt_, atol_, rtol_);
+        }
+        else if (integ_ == integrator_kind::sdirk3) {
+            if (!sd_ || sd_->dim() != dim) sd_.emplace(dim); // (re)size J + LU
+            // J + LU persist across step() calls; one gone stale (e.g. an edited spring
+            // rate) only costs a Newton retry with a fresh Jacobian
+            sd_->set_tolerances(atol_, rtol_);
+            sd_->step(f, u_mem, t0, dt);
+        }
+        else {
+            if (!rk4_ || rk4_->dim() != dim) rk4_.emplace(dim); // (re)size the scratch
+            rk4_->step(f, u_mem, t0, dt); // wraps the canonical rk4_step
         }
         time_ = t0;
-        apply_u(); // write the integrated state back into the joints + kinematic layers
+        write_u(u_mem); // write the integrated state back into the joints + kinematics
     }
 };
 
@@ -22,6 +22,8 @@ namespace hd::ga::pga {
 // - get_motor_from_lines()               -> provide a motor (from two lines moved
 //                                                            into each other)
 // - move3dp(), move3dp_opt()             -> move object with motor
+// - move3dp_inplace()                    -> move a SoA batch or a std::span in place
+// - get_xform()                          -> precomputed motor transform (Xform3dp)
 // - project_onto(), reject_from()        -> simple projection and rejection
 // - expand()                             -> expansion: new line/plane through point/line
 //                                                      perpendicular to line/plane
@@ -808,6 +810,160 @@ move3dp(std::vector<TriVec3dp<T>> const& tvec, MVec3dp_E<U> const& M)
     return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// precomputed motor transform (Xform3dp, see ga_xform_t.hpp)
+//
+// get_xform(M) evaluates the sandwich of M on points, lines and planes ONCE and
+// keeps the three matrices. The result applies like the move3dp() overloads
+// below, but without rebuilding the coefficients on every call:
+//
+//   auto const xf = get_xform(M);
+//   auto p1 = xf(p);          // == move3dp_opt(p, M), also for lines and planes
+//   xf(pts, pts_out);         // std::span / std::vector or SoA batches
+//   xf.apply_inplace(lines);
+//
+// Composition is the matrix product, (xf2 * xf1)(x) == xf2(xf1(x)): the object
+// for "first M1, then M2" is get_xform(M2) * get_xform(M1), the same map as
+// get_xform(rgpr(M2, M1)).
+//
+// get_grade_xform<E>(M) builds the matrix of a single grade E (Vec3dp<T>,
+// BiVec3dp<T> or TriVec3dp<T>; columns = move3dp_opt() of the basis elements),
+// rounded to T, the scalar type of E.
+//
+// pre: motor M must be unitized to avoid surprises
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename E, typename U>
+    requires(numeric_type<U>)
+GradeXform_t<E> get_grade_xform(MVec3dp_E<U> const& M)
+{
+    return GradeXform_t<E>::from_map([&M](E const& e) { return E(move3dp_opt(e, M)); });
+}
+
+template <typename T>
+    requires(numeric_type<T>)
+Xform3dp<T> get_xform(MVec3dp_E<T> const& M)
+{
+    return Xform3dp<T>(get_grade_xform<Vec3dp<T>>(M), get_grade_xform<BiVec3dp<T>>(M),
+                       get_grade_xform<TriVec3dp<T>>(M));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// batch moves on structure-of-arrays containers (Vec3dp_SoA, BiVec3dp_SoA,
+// TriVec3dp_SoA, see ga_soa_t.hpp)
+//
+// The sandwich map of the motor on the grade is built once per batch
+// (get_grade_xform), then all elements run through one branch-free unit-stride
+// loop that the compiler vectorizes across the elements (detail::soa_transform).
+// Two forms per type:
+//
+//   move3dp(in, M, out)    out-parameter: out is resized to in.size(), its
+//                          storage is reused between calls (no allocation)
+//   move3dp_inplace(v, M)  overwrites v
+//
+// The matrix is rounded to T, the scalar type of the container.
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp(Vec3dp_SoA<T> const& in, MVec3dp_E<U> const& M, Vec3dp_SoA<T>& out)
+{
+    get_grade_xform<Vec3dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp_inplace(Vec3dp_SoA<T>& vec, MVec3dp_E<U> const& M)
+{
+    get_grade_xform<Vec3dp<T>>(M).apply_inplace(vec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp(BiVec3dp_SoA<T> const& in, MVec3dp_E<U> const& M, BiVec3dp_SoA<T>& out)
+{
+    get_grade_xform<BiVec3dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp_inplace(BiVec3dp_SoA<T>& bvec, MVec3dp_E<U> const& M)
+{
+    get_grade_xform<BiVec3dp<T>>(M).apply_inplace(bvec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp(TriVec3dp_SoA<T> const& in, MVec3dp_E<U> const& M, TriVec3dp_SoA<T>& out)
+{
+    get_grade_xform<TriVec3dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp_inplace(TriVec3dp_SoA<T>& tvec, MVec3dp_E<U> const& M)
+{
+    get_grade_xform<TriVec3dp<T>>(M).apply_inplace(tvec);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// batch moves on caller-owned AoS storage (std::span over a std::vector,
+// std::array, a reused stream buffer, ...): nothing is allocated
+//
+//   move3dp(in, M, out)    out[i] = move3dp_opt(in[i], M); in and out must have
+//                          the same size (throws std::invalid_argument) and must
+//                          be disjoint or identical
+//   move3dp_inplace(v, M)  overwrites v
+//
+// Same matrix as for the SoA batches above, applied element by element
+// (detail::span_transform). T is deduced from out; a std::vector<Vec3dp<T>>
+// converts implicitly to in, out is passed as std::span(vec).
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp(std::type_identity_t<std::span<Vec3dp<T> const>> in,
+             MVec3dp_E<U> const& M, std::span<Vec3dp<T>> out)
+{
+    get_grade_xform<Vec3dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp_inplace(std::span<Vec3dp<T>> vec, MVec3dp_E<U> const& M)
+{
+    get_grade_xform<Vec3dp<T>>(M).apply_inplace(vec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp(std::type_identity_t<std::span<BiVec3dp<T> const>> in,
+             MVec3dp_E<U> const& M, std::span<BiVec3dp<T>> out)
+{
+    get_grade_xform<BiVec3dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp_inplace(std::span<BiVec3dp<T>> bvec, MVec3dp_E<U> const& M)
+{
+    get_grade_xform<BiVec3dp<T>>(M).apply_inplace(bvec);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp(std::type_identity_t<std::span<TriVec3dp<T> const>> in,
+             MVec3dp_E<U> const& M, std::span<TriVec3dp<T>> out)
+{
+    get_grade_xform<TriVec3dp<T>>(M)(in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void move3dp_inplace(std::span<TriVec3dp<T>> tvec, MVec3dp_E<U> const& M)
+{
+    get_grade_xform<TriVec3dp<T>>(M).apply_inplace(tvec);
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 // projections, rejections
@@ -24,9 +24,10 @@
 //   - dynamics. joint_accelerations() / step() solve the bordered acceleration-level KKT
 //     system for the joint accelerations and the constraint (Lagrange) forces (M / tau
 //     from the open-loop assemble_mass_bias), integrating by RK4 with post-step GGL
-//     projection (position + velocity).
+//     projection (position + velocity). By default through the Schur complement
+//     (kkt_method3dp::schur), which never forms the bordered matrix.
 
-#include "detail/ga_solver.hpp"        // hd::ga::lstsq_solve / kkt_solve (shared solvers)
+#include "detail/ga_solver.hpp"        // hd::ga::lstsq / kkt / kkt_schur solvers
 #include "ga_pga3dp_ops_mechanics.hpp" // dynamic_system3dp (the reused spanning tree)
 #include "ga_usr_utilities.hpp"        // hd::ga::rk4_step (shared RK4 integrator)
 #include "ga_value_t.hpp"              // value_t
@@ -36,6 +37,7 @@
 #include <mdspan>    // RK4 state views (step)
 #include <stdexcept> // std::runtime_error
 #include <string>
+#include <utility>   // std::move (chord warm start)
 #include <vector>
 
 
@@ -62,6 +64,42 @@ struct loop_constraint3dp {
 };
 
 
+// Solver for the acceleration-level KKT system of closed_loop_system3dp (see
+// set_kkt_method):
+//   schur    -- factor the tree-sparse mass matrix M once (LTDL), form the small m x m
+//               Schur complement G M^-1 G^T and solve for the constraint forces first,
+//               then q-ddot (hd::ga::kkt_schur_solve). Loops on disjoint sub-chains stay
+//               decoupled, and the symbolic structure is reused across steps (default)
+//   bordered -- assemble the full (n+m) x (n+m) saddle-point matrix and solve it by the
+//               pivoting dense LU (hd::ga::kkt_solve); the reference path
+// Both give the same q-ddot and lambda; schur is the fast path for mechanisms with many
+// constraint rows (a Stewart platform: 6 legs, 18 rows).
+enum class kkt_method3dp { schur, bordered };
+
+
+// Position-projection method of step() (see set_projection_method):
+//   newton -- the full Newton iteration of assemble(): a fresh constraint Jacobian and
+//             least-squares solve in every iteration (default; the reference)
+//   chord  -- chord iteration: warm-started from the previous step's correction and
+//             reusing ONE factorization of the constraint Jacobian across iterations and
+//             steps (the velocity projection of the previous step refreshes it for free).
+//             A Jacobian that stops contracting the residual is refreshed; a chord that
+//             does not converge within max_iter finishes with the full Newton
+enum class projection_method3dp { newton, chord };
+
+// Report of the post-step position projection (see projection_stats()). The per-step
+// fields describe the LAST step; the totals accumulate until reset_projection_stats().
+struct projection_stats3dp {
+    size_t iterations{0};          // Newton / chord iterations of the last step
+    size_t jacobian_evals{0};      // constraint Jacobians built + factorized for them
+    bool warm_start{false};        // previous correction applied and accepted (chord)
+    std::vector<value_t> residual; // ‖g‖ at entry, after the warm start, per iteration
+    size_t steps{0};               // projected steps
+    size_t total_iterations{0};
+    size_t total_jacobian_evals{0};
+};
+
+
 // A closed-loop / parallel mechanism: an open-chain spanning tree (the reused
 // dynamic_system3dp) plus loop-closure constraints between tree frames. Build the tree
 // through the familiar forwarded API, then close loops with add_loop_constraint(...).
@@ -70,6 +108,16 @@ class closed_loop_system3dp {
     dynamic_system3dp tree_;                // the open-chain spanning tree (reused as-is)
     std::vector<loop_constraint3dp> loops_; // the extra closure edges
 
+    projection_method3dp proj_{projection_method3dp::newton}; // see step()
+    projection_stats3dp pstats_{};                 // report of the projections
+    hd::ga::lstsq_factorization<value_t> chord_{}; // reused Jacobian factorization
+    std::vector<size_t> chord_dep_;                // joint list chord_ belongs to
+    std::vector<value_t> dq_prev_;                 // previous step's position correction
+
+    kkt_method3dp kkt_{kkt_method3dp::schur};     // KKT solver of kkt_dynamics()
+    hd::ga::kkt_schur_workspace<value_t> schur_{}; // symbolic analysis + scratch (schur)
+    std::vector<size_t> schur_rj_;                // joint list schur_ was analyzed for
+
   public:
 
     closed_loop_system3dp() = default;
@@ -141,6 +189,18 @@ class closed_loop_system3dp {
         return tree_.joint_omega(joint_frame);
     }
 
+    // select the KKT solver of the constrained dynamics (see kkt_method3dp)
+    void set_kkt_method(kkt_method3dp k) { kkt_ = k; }
+    kkt_method3dp get_kkt_method() const { return kkt_; }
+
+    // select the post-step position projection of step() (see projection_method3dp)
+    void set_projection_method(projection_method3dp p) { proj_ = p; }
+    projection_method3dp get_projection_method() const { return proj_; }
+
+    // iteration counts and residual history of the post-step projections
+    projection_stats3dp const& projection_stats() const { return pstats_; }
+    void reset_projection_stats() { pstats_ = projection_stats3dp{}; }
+
     size_t loop_count() const { return loops_.size(); }
     loop_constraint3dp const& loop(size_t c) const { return loops_[c]; }
 
@@ -186,32 +246,7 @@ class closed_loop_system3dp {
     value_t assemble(std::vector<size_t> const& driven = {}, value_t tol = value_t(1e-12),
                      size_t max_iter = 50)
     {
-        std::vector<size_t> const dep = dependent_joints(driven);
-
-        for (size_t it = 0; it <= max_iter; ++it) {
-            std::vector<value_t> const g = residual();
-            value_t gnorm = 0.0;
-            for (value_t const gi : g)
-                gnorm = std::max(gnorm, std::abs(gi));
-            if (gnorm < tol) return gnorm;
-            if (it == max_iter) break;
-
-            // Newton step: solve G_dep * delta = -g for the dependent joint increments
-            std::vector<value_t> const G = constraint_jacobian(dep);
-            std::vector<value_t> b(g.size());
-            for (size_t i = 0; i < g.size(); ++i)
-                b[i] = -g[i];
-            std::vector<value_t> const delta = hd::ga::lstsq_solve(G, b, dep.size());
-            for (size_t k = 0; k < dep.size(); ++k) {
-                tree_.joint[dep[k]].phi += delta[k];
-                tree_.apply_joint_state(dep[k]);
-            }
-        }
-        throw std::runtime_error(
-            std::string(
-                "closed_loop_system3dp::assemble: Newton did not converge within ") +
-            std::to_string(max_iter) + std::string(" iterations (residual ") +
-            std::to_string(residual_norm()) + std::string(")"));
+        return assemble_dep(dependent_joints(driven), tol, max_iter, nullptr);
     }
 
     // --- velocity / acceleration distribution (kinematic closed loop)
@@ -330,34 +365,168 @@ class closed_loop_system3dp {
         }
         apply_u();
 
-        assemble(/*driven*/ {}); // position: min-norm Newton -> g ~ 0
-        project_velocities(rj);  // velocity:  q-dot <- q-dot - G⁺(G q-dot)
+        // position: min-norm Newton (or chord) -> g ~ 0, with the report in pstats_
+        pstats_.iterations = 0;
+        pstats_.jacobian_evals = 0;
+        pstats_.warm_start = false;
+        pstats_.residual.clear();
+        if (proj_ == projection_method3dp::chord)
+            project_positions_chord(rj, value_t(1e-12), 50);
+        else
+            assemble_dep(rj, value_t(1e-12), 50, &pstats_);
+        ++pstats_.steps;
+        pstats_.total_iterations += pstats_.iterations;
+        pstats_.total_jacobian_evals += pstats_.jacobian_evals;
+        project_velocities(rj); // velocity: q-dot <- q-dot - G⁺(G q-dot)
     }
 
   private:
 
+    // assemble() on an explicit dependent-joint list; records the iterations and the
+    // residual history into `st` if non-null (the newton projection of step()).
+    value_t assemble_dep(std::vector<size_t> const& dep, value_t tol, size_t max_iter,
+                         projection_stats3dp* st)
+    {
+        for (size_t it = 0; it <= max_iter; ++it) {
+            std::vector<value_t> const g = residual();
+            value_t gnorm = 0.0;
+            for (value_t const gi : g)
+                gnorm = std::max(gnorm, std::abs(gi));
+            if (st) st->residual.push_back(gnorm);
+            if (gnorm < tol) return gnorm;
+            if (it == max_iter) break;
+
+            // Newton step: solve G_dep * delta = -g for the dependent joint increments
+            std::vector<value_t> const G = constraint_jacobian(dep);
+            if (st) {
+                ++st->iterations;
+                ++st->jacobian_evals;
+            }
+            std::vector<value_t> b(g.size());
+            for (size_t i = 0; i < g.size(); ++i)
+                b[i] = -g[i];
+            std::vector<value_t> const delta = hd::ga::lstsq_solve(G, b, dep.size());
+            for (size_t k = 0; k < dep.size(); ++k) {
+                tree_.joint[dep[k]].phi += delta[k];
+                tree_.apply_joint_state(dep[k]);
+            }
+        }
+        throw std::runtime_error(
+            std::string(
+                "closed_loop_system3dp::assemble: Newton did not converge within ") +
+            std::to_string(max_iter) + std::string(" iterations (residual ") +
+            std::to_string(residual_norm()) + std::string(")"));
+    }
+
+    // Chord variant of the post-step position projection (projection_method3dp::chord)
+    // on the dependent joints `dep`:
+    //
+    //   1. warm start: re-apply the previous step's total correction dq_prev_ (the
+    //      drift of consecutive steps is nearly the same) and keep it if it lowers ‖g‖;
+    //   2. chord iterations  q <- q + G0⁺(-g(q))  with ONE factorization G0⁺ (chord_),
+    //      normally the one left by the previous step's velocity projection, so a step
+    //      usually costs no Jacobian evaluation at all;
+    //   3. G0 is rebuilt only when an iteration contracts ‖g‖ by less than a factor of
+    //      20 (the configuration moved too far for the stale Jacobian), and the full
+    //      Newton (assemble_dep) takes over if max_iter chord iterations do not converge.
+    value_t project_positions_chord(std::vector<size_t> const& dep, value_t tol,
+                                    size_t max_iter)
+    {
+        auto& st = pstats_;
+        size_t const n = dep.size();
+        auto norm_inf = [](std::vector<value_t> const& v) {
+            value_t r = 0.0;
+            for (value_t const vi : v)
+                r = std::max(r, std::abs(vi));
+            return r;
+        };
+        auto shift = [&](std::vector<value_t> const& d, value_t sgn) {
+            for (size_t k = 0; k < n; ++k) {
+                tree_.joint[dep[k]].phi += sgn * d[k];
+                tree_.apply_joint_state(dep[k]);
+            }
+        };
+        if (chord_dep_ != dep) { // other joint list: nothing to reuse
+            chord_.valid = false;
+            dq_prev_.clear();
+            chord_dep_ = dep;
+        }
+
+        std::vector<value_t> g = residual();
+        value_t gnorm = norm_inf(g);
+        st.residual.push_back(gnorm);
+        std::vector<value_t> dq(n, 0.0); // total correction of this step
+
+        if (gnorm >= tol && dq_prev_.size() == n) {
+            shift(dq_prev_, 1.0);
+            std::vector<value_t> g1 = residual();
+            value_t const gnorm1 = norm_inf(g1);
+            if (gnorm1 < gnorm) {
+                g = std::move(g1);
+                gnorm = gnorm1;
+                dq = dq_prev_;
+                st.warm_start = true;
+                st.residual.push_back(gnorm);
+            }
+            else {
+                shift(dq_prev_, -1.0); // no better: undo
+            }
+        }
+
+        std::vector<value_t> b(g.size());
+        for (size_t it = 0; gnorm >= tol; ++it) {
+            if (it == max_iter) { // chord stalled: finish with the full Newton
+                dq_prev_.clear();
+                chord_.valid = false;
+                return assemble_dep(dep, tol, max_iter, &st);
+            }
+            if (!chord_.valid || chord_.m != g.size()) {
+                hd::ga::lstsq_factorize(chord_, constraint_jacobian(dep), g.size(), n);
+                ++st.jacobian_evals;
+            }
+            for (size_t i = 0; i < g.size(); ++i)
+                b[i] = -g[i];
+            std::vector<value_t> const delta = hd::ga::lstsq_apply(chord_, b);
+            shift(delta, 1.0);
+            for (size_t k = 0; k < n; ++k)
+                dq[k] += delta[k];
+            ++st.iterations;
+
+            g = residual();
+            value_t const gnorm_new = norm_inf(g);
+            st.residual.push_back(gnorm_new);
+            if (gnorm_new > 0.05 * gnorm) chord_.valid = false; // slow: refresh G0
+            gnorm = gnorm_new;
+        }
+        dq_prev_ = std::move(dq);
+        return gnorm;
+    }
+
     // world-coordinate, unitized (w = 1) position of an anchor point of a tree frame
     vec3dp anchor_world(size_t frame, vec3dp const& anchor)
     {
         return unitize(move3dp(anchor, tree_.get_pos_trafo(frame, 0)));
     }
 
-    // Solve the bordered acceleration-level KKT system for q-ddot (and lambda) at the
-    // current state -- see joint_accelerations(). `rj` is the joint list (all dof joints
-    // for dynamics). Reuses the open-loop M / tau (assemble_mass_bias), G
-    // (constraint_jacobian) and -G-dot q-dot (constraint_bias).
+    // Solve the acceleration-level KKT system for q-ddot (and lambda) at the current
+    // state -- see joint_accelerations(). `rj` is the joint list (all dof joints for
+    // dynamics). Reuses the open-loop M / tau (assemble_mass_bias), G
+    // (constraint_jacobian) and -G-dot q-dot (constraint_bias). Dispatches on kkt_ (see
+    // kkt_method3dp); the schur path re-runs its symbolic analysis only when the joint
+    // list, the dof tree or the loop set changed since the last call.
     std::vector<value_t> kkt_dynamics(std::vector<size_t> const& rj,
                                       std::vector<value_t>* lambda_out)
     {
         size_t const n = rj.size();
         size_t const m = 3 * loops_.size();
 
-        // M (n*n) and tau (n) from the open-loop assembly; this also runs the bias pass
-        // (zeroes the chain's relative accel twists), the q-ddot = 0 state
-        // constraint_bias() needs below.
-        auto const mb = tree_.assemble_mass_bias(rj);
-        std::vector<value_t> const& M = mb.first;
-        std::vector<value_t> const& tau = mb.second;
+        // M (n*n) and tau (n) from the open-loop assembly, left in the tree's workspace
+        // together with the dof parents of M; this also runs the bias pass (zeroes the
+        // chain's relative accel twists), the q-ddot = 0 state constraint_bias() needs
+        // below.
+        tree_.assemble_mass_bias_ws(rj);
+        std::vector<value_t> const& M = tree_.ws_.Mmat;
+        std::vector<value_t> const& tau = tree_.ws_.rhs;
 
         std::vector<value_t> const G = constraint_jacobian(rj);
         std::vector<value_t> const gd = constraint_bias(); // G-dot q-dot (m)
@@ -366,7 +535,24 @@ class closed_loop_system3dp {
         for (size_t c = 0; c < m; ++c)
             gbias[c] = -gd[c];
 
-        return hd::ga::kkt_solve(M, G, tau, gbias, n, m, lambda_out);
+        if (kkt_ == kkt_method3dp::bordered)
+            return hd::ga::kkt_solve(M, G, tau, gbias, n, m, lambda_out);
+
+        if (!schur_.analyzed || schur_rj_ != rj || schur_.lambda != tree_.ws_.lambda ||
+            schur_.m != m) {
+            // one block of 3 rows per loop; its columns are the joints supporting
+            // either anchor (the structural nonzeros of constraint_jacobian)
+            std::vector<size_t> rows(loops_.size(), 3);
+            std::vector<std::vector<size_t>> cols(loops_.size());
+            for (size_t c = 0; c < loops_.size(); ++c)
+                for (size_t k = 0; k < n; ++k)
+                    if (tree_.is_ancestor(rj[k], loops_[c].frame_a) ||
+                        tree_.is_ancestor(rj[k], loops_[c].frame_b))
+                        cols[c].push_back(k);
+            hd::ga::kkt_schur_analyze(schur_, tree_.ws_.lambda, rows, cols);
+            schur_rj_ = rj;
+        }
+        return hd::ga::kkt_schur_solve(schur_, M, G, tau, gbias, lambda_out);
     }
 
     // Velocity-product term G-dot q-dot (length m): the relative acceleration of the two
@@ -405,7 +591,16 @@ class closed_loop_system3dp {
             for (size_t k = 0; k < n; ++k)
                 Gv[i] += G[i * n + k] * qd[k];
 
-        std::vector<value_t> const dqd = hd::ga::lstsq_solve(G, Gv, n); // G⁺(G q-dot)
+        std::vector<value_t> dqd; // G⁺(G q-dot)
+        if (proj_ == projection_method3dp::chord) {
+            // keep the factorization: the next step's position chord starts from it
+            hd::ga::lstsq_factorize(chord_, G, m, n);
+            chord_dep_ = rj;
+            dqd = hd::ga::lstsq_apply(chord_, Gv);
+        }
+        else {
+            dqd = hd::ga::lstsq_solve(G, Gv, n);
+        }
         for (size_t k = 0; k < n; ++k) {
             tree_.joint[rj[k]].omega -= dqd[k];
             tree_.apply_joint_state(rj[k]);
@@ -0,0 +1,242 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+// Penalty-contact layer for PGA3DP: contact between body-attached spheres, e.g. for
+// granular media of thousands of grains. Like the closed-loop and ensemble layers it is
+// additive: it plugs into dynamic_system3dp through the extra_wrenches() seam and
+// needs no change of the open-chain tier.
+//
+//   penalty_contact3dp  the force element: a set of contact spheres (one body frame
+//                       each, centre in the body frame) and the normal force law
+//   contact_system3dp   a dynamic_system3dp that owns one and feeds its contact wrenches
+//                       into the dynamics (jointed bodies at every RK4 sub-step, free
+//                       bodies once per step, see gather_free_body_wrenches)
+//
+// Force law (per overlapping pair a, b with world centres Ca, Cb, radii ra, rb):
+//
+//     n = (Cb - Ca)/|Cb - Ca|,   delta = ra + rb - |Cb - Ca| > 0   (penetration depth)
+//     P = Ca + (ra - delta/2) n                                     (contact point)
+//     Fn = k delta - c v_n,      v_n = (v_b(P) - v_a(P)) . n        (no adhesion)
+//
+// applied as the force line wdg(P, Fn n) on b and its negative on a -- the same wrench
+// form as the grounded spring, so moments about the body origins emerge from P. A sphere
+// attached to frame 0 (the root) is a static obstacle (e.g. a floor of spheres).
+//
+// BROADPHASE: a uniform grid with cell edge h >= the largest sphere diameter, so an
+// overlapping pair lies in the same or in adjacent cells. The spheres are sorted by their
+// cell key (no hashing) and each one probes its 27 neighbour cells by binary search:
+// O(N log N) per evaluation instead of the O(N^2) all-pairs distance check. The
+// resulting pair list is sorted, so the wrench order (and the trajectory) does not
+// depend on the grid.
+
+#include "ga_pga3dp_ops_mechanics.hpp" // dynamic_system3dp (extra_wrenches seam)
+#include "ga_value_t.hpp"              // value_t
+
+#include <algorithm> // std::sort, std::lower_bound, std::max, std::clamp
+#include <cmath>     // std::floor, std::sqrt, std::isfinite
+#include <cstddef>   // size_t
+#include <cstdint>   // uint64_t (grid cell key)
+#include <stdexcept> // std::invalid_argument
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+
+namespace hd::ga::pga {
+
+// A contact sphere rigidly attached to a body frame.
+struct contact_sphere3dp {
+    size_t frame{0};            // body frame (0: static, attached to the root)
+    vec3dp centre_b{O_3dp};     // centre in the body frame (w = 1)
+    value_t radius{0.0};
+};
+
+class penalty_contact3dp {
+
+    std::vector<contact_sphere3dp> sph_;
+    value_t k_{0.0};    // normal stiffness [N/m]
+    value_t c_{0.0};    // normal damping [N s/m]
+    value_t h_{0.0};    // requested grid cell edge (0: automatic)
+    value_t rmax_{0.0}; // largest radius
+
+    // workspace of the last evaluation (reused, no allocation once sized)
+    std::vector<vec3dp> cw_;                        // world centres
+    std::vector<std::pair<uint64_t, size_t>> cell_; // (cell key, sphere), sorted
+    std::vector<std::pair<size_t, size_t>> pairs_;  // overlapping pairs a < b, sorted
+
+  public:
+
+    penalty_contact3dp(value_t stiffness, value_t damping = 0.0) :
+        k_(stiffness), c_(damping)
+    {
+        if (!(stiffness > 0.0) || !(damping >= 0.0)) {
+            throw std::invalid_argument(
+                std::string("penalty_contact3dp: need stiffness > 0 and damping >= 0, "
+                            "got k = ") +
+                std::to_string(stiffness) + std::string(", c = ") +
+                std::to_string(damping));
+        }
+    }
+
+    // attach a sphere (centre in the body frame, w = 1) to `frame`; returns its index
+    size_t add_sphere(size_t frame, vec3dp const& centre_b, value_t radius)
+    {
+        if (!(radius > 0.0)) {
+            throw std::invalid_argument(
+                std::string("penalty_contact3dp: sphere radius must be > 0, got ") +
+                std::to_string(radius));
+        }
+        sph_.push_back(contact_sphere3dp{frame, centre_b, radius});
+        rmax_ = std::max(rmax_, radius);
+        return sph_.size() - 1;
+    }
+
+    size_t size() const { return sph_.size(); }
+    contact_sphere3dp const& sphere(size_t s) const { return sph_[s]; }
+
+    // Grid cell edge of the broadphase. It never drops below the largest diameter (the
+    // default, h = 0), which keeps the neighbour-cell search exact; a larger cell can
+    // pay off for strongly mixed radii.
+    void set_cell_size(value_t h)
+    {
+        if (!(h >= 0.0) || !std::isfinite(h)) {
+            throw std::invalid_argument(
+                std::string("penalty_contact3dp: cell size must be finite and >= 0, "
+                            "got ") +
+                std::to_string(h));
+        }
+        h_ = h;
+    }
+    value_t cell_size() const { return std::max(h_, 2.0 * rmax_); }
+
+    // overlapping sphere pairs (a < b, sorted) found by the last wrenches() call
+    std::vector<std::pair<size_t, size_t>> const& contact_pairs() const { return pairs_; }
+
+    // Append the contact wrenches (world frame) for the current state of `sys` to
+    // `out`: one (frame, wrench) pair per loaded side of each contact.
+    void wrenches(kinematic_system3dp& sys, std::vector<std::pair<size_t, bivec3dp>>& out)
+    {
+        broadphase(sys);
+        for (auto const& [a, b] : pairs_) {
+            auto const& sa = sph_[a];
+            auto const& sb = sph_[b];
+            vec3dp const d = cw_[b] - cw_[a];
+            value_t const dist = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+            if (!(dist > 0.0)) continue; // coincident centres: no normal
+            vec3dp const n = (1.0 / dist) * d;
+            value_t const delta = sa.radius + sb.radius - dist;
+            vec3dp const P = cw_[a] + (sa.radius - 0.5 * delta) * n;
+            vec3dp const vrel =
+                kinematic_system3dp::velocity_field(sys.twist_world(sb.frame), P) -
+                kinematic_system3dp::velocity_field(sys.twist_world(sa.frame), P);
+            value_t const vn = vrel.x * n.x + vrel.y * n.y + vrel.z * n.z;
+            value_t const Fn = k_ * delta - c_ * vn;
+            if (!(Fn > 0.0)) continue; // separating fast enough: no adhesion
+            bivec3dp const W = wdg(P, Fn * n);
+            if (sb.frame != 0) out.emplace_back(sb.frame, W);
+            if (sa.frame != 0) out.emplace_back(sa.frame, -W);
+        }
+    }
+
+  private:
+
+    // grid cells per half axis: 21-bit key field per axis
+    static constexpr int64_t cell_lim = int64_t(1) << 20;
+
+    // world centres + grid sort + neighbour-cell probe -> pairs_ (narrowphase included)
+    void broadphase(kinematic_system3dp& sys)
+    {
+        size_t const ns = sph_.size();
+        cw_.resize(ns);
+        cell_.resize(ns);
+        pairs_.clear();
+        if (ns < 2) return;
+
+        value_t const h = cell_size();
+        auto icell = [h](value_t x) -> int64_t {
+            // 21 bits per axis, clamped: far-out spheres share the border cells
+            return std::clamp<int64_t>(int64_t(std::floor(x / h)), -cell_lim,
+                                       cell_lim - 1);
+        };
+        auto key = [](int64_t ix, int64_t iy, int64_t iz) -> uint64_t {
+            return (uint64_t(ix + cell_lim) << 42) | (uint64_t(iy + cell_lim) << 21) |
+                   uint64_t(iz + cell_lim);
+        };
+        auto in_grid = [](int64_t i) { return i >= -cell_lim && i < cell_lim; };
+
+        for (size_t s = 0; s < ns; ++s) {
+            cw_[s] =
+                unitize(move3dp(sph_[s].centre_b, sys.get_pos_trafo(sph_[s].frame, 0)));
+            cell_[s] = {key(icell(cw_[s].x), icell(cw_[s].y), icell(cw_[s].z)), s};
+        }
+        std::sort(cell_.begin(), cell_.end());
+
+        for (size_t a = 0; a < ns; ++a) {
+            int64_t const ix = icell(cw_[a].x);
+            int64_t const iy = icell(cw_[a].y);
+            int64_t const iz = icell(cw_[a].z);
+            for (int64_t dx = -1; dx <= 1; ++dx) {
+                for (int64_t dy = -1; dy <= 1; ++dy) {
+                    for (int64_t dz = -1; dz <= 1; ++dz) {
+                        // past the border cells: no sphere there, and the key
+                        // would spill into the neighbouring bit field
+                        if (!in_grid(ix + dx) || !in_grid(iy + dy) || !in_grid(iz + dz))
+                            continue;
+                        probe(a, key(ix + dx, iy + dy, iz + dz));
+                    }
+                }
+            }
+        }
+        std::sort(pairs_.begin(), pairs_.end());
+    }
+
+    // narrowphase of sphere a against the spheres b > a in grid cell kn
+    void probe(size_t a, uint64_t kn)
+    {
+        auto it = std::lower_bound(cell_.begin(), cell_.end(),
+                                   std::pair<uint64_t, size_t>{kn, 0});
+        for (; it != cell_.end() && it->first == kn; ++it) {
+            size_t const b = it->second;
+            if (b <= a || sph_[a].frame == sph_[b].frame) continue;
+            vec3dp const d = cw_[b] - cw_[a];
+            value_t const rs = sph_[a].radius + sph_[b].radius;
+            if (d.x * d.x + d.y * d.y + d.z * d.z < rs * rs) pairs_.emplace_back(a, b);
+        }
+    }
+};
+
+// A dynamic_system3dp with penalty contact between body-attached spheres: the contact
+// wrenches enter through the extra_wrenches() seam. Build the mechanism as usual (free
+// bodies, joints), then attach spheres with add_contact_sphere().
+class contact_system3dp : public dynamic_system3dp {
+
+    penalty_contact3dp contact_;
+
+  public:
+
+    explicit contact_system3dp(value_t stiffness, value_t damping = 0.0) :
+        contact_(stiffness, damping)
+    {
+    }
+
+    // attach a contact sphere (centre in the body frame, w = 1) to frame idx
+    size_t add_contact_sphere(size_t idx, vec3dp const& centre_b, value_t radius)
+    {
+        return contact_.add_sphere(idx, centre_b, radius);
+    }
+
+    penalty_contact3dp& contacts() { return contact_; }
+    penalty_contact3dp const& contacts() const { return contact_; }
+
+  protected:
+
+    // appends into the base's reused buffer: no allocation once the contacts settle
+    void append_extra_wrenches(std::vector<std::pair<size_t, bivec3dp>>& out) override
+    {
+        contact_.wrenches(*this, out);
+    }
+};
+
+} // namespace hd::ga::pga
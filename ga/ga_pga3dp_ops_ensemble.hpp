@@ -0,0 +1,356 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+// Ensemble layer for PGA3DP: many perturbed copies of ONE articulated mechanism, e.g.
+// for Monte-Carlo robustness studies (varying masses, joint spring constants and initial
+// joint states), stepped in parallel. Like the closed-loop layer it is additive: it
+// composes a dynamic_system3dp as the shared MODEL (topology, joint types, screws, force
+// elements, nominal parameters) and reaches its private joint / body state through
+// friendship.
+//
+// Only what differs between instances is stored per instance, in SoA layout (one
+// contiguous column per quantity, all instances side by side):
+//
+//   q, q-dot      joint coordinates / rates         (one column per dof joint)
+//   k             joint spring stiffness            (one column per dof joint)
+//   mass scale    uniform body mass/inertia factor  (one column per frame)
+//
+// step() distributes the instances over worker threads that claim small chunks from a
+// shared counter (dynamic self-scheduling, so a slow chunk never stalls the others).
+// The workers are a persistent pool owned by the ensemble (detail/ga_worker_pool.hpp),
+// and each keeps a private copy of the model with its own allocation-free workspace
+// across calls: threads and copies are created once, not per step() or statistics
+// call. A worker loads an instance into its copy, advances it by all requested steps
+// while its state is hot in cache, and stores it back. An instance is integrated by exactly the same code as a
+// standalone dynamic_system3dp, so its result is bit-for-bit independent of the thread
+// count and of the scheduling order.
+//
+// Aggregated statistics (energy, joint coordinates, frame positions) are reduced over
+// the instances in instance order, hence deterministic as well, and returned without
+// copying any per-instance trajectory out.
+//
+// Scope: the generalised coordinates are the dof joints (revolute / prismatic). Free
+// bodies keep their state in the kinematic base layer and are not carried per instance
+// (the constructor rejects a model with a dynamic free body). Integrator state that
+// carries over between steps (ABM2 history, DP54 step-size suggestion, SDIRK3 Jacobian)
+// is not carried per instance either, so the model must use RK4 (the constructor
+// rejects any other integrator). The model is held BY VALUE as a dynamic_system3dp, so
+// force elements of a subclass (extra_wrenches()) are not part of it.
+
+#include "detail/ga_worker_pool.hpp"   // detail::worker_pool (persistent workers)
+#include "ga_pga3dp_ops_mechanics.hpp" // dynamic_system3dp (the shared model)
+#include "ga_value_t.hpp"              // value_t
+
+#include <algorithm> // std::min, std::max
+#include <array>
+#include <atomic>    // std::atomic (chunk counter)
+#include <cmath>     // std::sqrt
+#include <cstddef>   // size_t
+#include <span>      // std::span (per-instance column views)
+#include <stdexcept> // std::runtime_error, std::invalid_argument
+#include <string>
+#include <thread> // std::thread::hardware_concurrency
+#include <vector>
+
+
+namespace hd::ga::pga {
+
+// Summary statistics of one scalar quantity over all instances of an ensemble3dp.
+struct ensemble_stats {
+    value_t mean{0.0};
+    value_t stddev{0.0}; // population standard deviation
+    value_t min{0.0};
+    value_t max{0.0};
+};
+
+// A body with mass and inertia scaled uniformly by s (same shape, density * s): the
+// per-instance mass perturbation of ensemble3dp.
+inline body3dp scale_body3dp(body3dp const& b, value_t s)
+{
+    body3dp r = b;
+    for (size_t k = 0; k < 36; ++k) {
+        r.I.data[k] *= s;
+        r.I_inv.data[k] /= s;
+    }
+    r.mass *= s;
+    if (r.Ip) {
+        r.Ip->m *= s;
+        r.Ip->Jxx *= s;
+        r.Ip->Jyy *= s;
+        r.Ip->Jzz *= s;
+    }
+    return r;
+}
+
+class ensemble3dp {
+
+    dynamic_system3dp model_;  // shared topology + nominal parameters
+    std::vector<size_t> dofs_; // dof joint frames (dof_joints() order)
+    size_t n_{0};              // number of instances
+    value_t time_{0.0};        // common simulation clock [s]
+
+    // per-instance state and parameters, SoA: entry (column c, instance i) is stored at
+    // [c * n_ + i], so one quantity of all instances is contiguous
+    std::vector<value_t> q_;      // joint coordinates        (column = dof slot)
+    std::vector<value_t> qd_;     // joint rates              (column = dof slot)
+    std::vector<value_t> k_;      // joint spring stiffness   (column = dof slot)
+    std::vector<value_t> mscale_; // body mass/inertia scale  (column = frame index)
+
+    ga::detail::worker_pool pool_;           // persistent worker threads
+    std::vector<dynamic_system3dp> scratch_; // one model copy per worker, reused
+
+  public:
+
+    // Create n_instances copies of `model`, all starting at the model's current joint
+    // state and parameters (perturb them afterwards with the setters below).
+    ensemble3dp(dynamic_system3dp const& model, size_t n_instances) :
+        model_(model), dofs_(model.dof_joints()), n_(n_instances), time_(model.time())
+    {
+        for (size_t i = 1; i < model_.size(); ++i) {
+            if (model_.joint[i].type == joint3dp::free && model_.body[i].mass > 0.0) {
+                throw std::runtime_error(
+                    std::string("ensemble3dp: free body in frame ") + std::to_string(i) +
+                    std::string(" is not supported (only dof joints are carried per "
+                                "instance)"));
+            }
+        }
+        if (model_.get_integrator() != integrator_kind::rk4) {
+            throw std::invalid_argument(
+                "ensemble3dp: the model must use integrator_kind::rk4 (the state of "
+                "ABM2 / DP54 / SDIRK3 is not carried per instance)");
+        }
+
+        size_t const nd = dofs_.size();
+        q_.resize(nd * n_);
+        qd_.resize(nd * n_);
+        k_.resize(nd * n_);
+        for (size_t c = 0; c < nd; ++c) {
+            auto const& js = model_.joint[dofs_[c]];
+            std::fill_n(q_.begin() + c * n_, n_, js.phi);
+            std::fill_n(qd_.begin() + c * n_, n_, js.omega);
+            std::fill_n(k_.begin() + c * n_, n_, js.stiffness);
+        }
+        mscale_.assign(model_.size() * n_, 1.0);
+    }
+
+    size_t size() const { return n_; }                // number of instances
+    size_t dof_count() const { return dofs_.size(); } // dof joints per instance
+    value_t time() const { return time_; }            // common simulation clock [s]
+    dynamic_system3dp const& model() const { return model_; }
+
+    // --- per-instance state and parameters -------------------------------------------
+
+    void set_joint_state(size_t inst, size_t frame, value_t q, value_t qdot)
+    {
+        size_t const c = column(frame);
+        q_[at(c, inst)] = q;
+        qd_[at(c, inst)] = qdot;
+    }
+    value_t joint_phi(size_t inst, size_t frame) const
+    {
+        return q_[at(column(frame), inst)];
+    }
+    value_t joint_omega(size_t inst, size_t frame) const
+    {
+        return qd_[at(column(frame), inst)];
+    }
+
+    // joint spring stiffness k of one instance (damping and rest position are shared)
+    void set_joint_stiffness(size_t inst, size_t frame, value_t k)
+    {
+        k_[at(column(frame), inst)] = k;
+    }
+
+    // uniform mass/inertia factor of the body in `frame` for one instance
+    void set_mass_scale(size_t inst, size_t frame, value_t s)
+    {
+        check_instance(inst);
+        mscale_[frame * n_ + inst] = s;
+    }
+
+    // the joint coordinates / rates of all instances for one joint (a read-only view of
+    // the SoA column, no copy)
+    std::span<value_t const> joint_phi_column(size_t frame) const
+    {
+        return std::span<value_t const>(q_).subspan(column(frame) * n_, n_);
+    }
+    std::span<value_t const> joint_omega_column(size_t frame) const
+    {
+        return std::span<value_t const>(qd_).subspan(column(frame) * n_, n_);
+    }
+
+    // --- time integration ------------------------------------------------------------
+
+    // Advance every instance by nsteps steps of dt on n_threads workers (0: one per
+    // hardware thread). Each instance runs through dynamic_system3dp::step(), so its
+    // trajectory equals that of a standalone system with the same parameters.
+    void step(value_t dt, size_t nsteps = 1, size_t n_threads = 0)
+    {
+        value_t const t0 = time_;
+        for_each_instance(n_threads, [&](dynamic_system3dp& sys, size_t inst) {
+            load(sys, inst, t0);
+            for (size_t s = 0; s < nsteps; ++s)
+                sys.step(dt);
+            store(sys, inst);
+        });
+        // the same clock increments as the instances' own (t += dt per step)
+        for (size_t s = 0; s < nsteps; ++s)
+            time_ += dt;
+    }
+
+    // --- aggregated statistics (no trajectory copies) --------------------------------
+
+    // total energy (kinetic + potential) over the instances at the current time
+    ensemble_stats energy_stats(size_t n_threads = 0)
+    {
+        std::vector<value_t> val(n_);
+        for_each_instance(n_threads, [&](dynamic_system3dp& sys, size_t inst) {
+            load(sys, inst, time_);
+            val[inst] = sys.total_energy();
+        });
+        return reduce(val);
+    }
+
+    // joint coordinate of one dof joint over the instances
+    ensemble_stats joint_stats(size_t frame) const
+    {
+        return reduce(joint_phi_column(frame));
+    }
+
+    // world position (x, y, z) of a frame's origin over the instances
+    std::array<ensemble_stats, 3> position_stats(size_t frame, size_t n_threads = 0)
+    {
+        check_frame(frame);
+        std::vector<value_t> val(3 * n_);
+        for_each_instance(n_threads, [&](dynamic_system3dp& sys, size_t inst) {
+            load(sys, inst, time_);
+            vec3dp const P = move3dp(O_3dp, sys.get_pos_trafo(frame, 0));
+            val[inst] = P.x;
+            val[n_ + inst] = P.y;
+            val[2 * n_ + inst] = P.z;
+        });
+        std::span<value_t const> const v(val);
+        return {reduce(v.subspan(0, n_)), reduce(v.subspan(n_, n_)),
+                reduce(v.subspan(2 * n_, n_))};
+    }
+
+  private:
+
+    size_t at(size_t c, size_t inst) const
+    {
+        check_instance(inst);
+        return c * n_ + inst;
+    }
+
+    void check_instance(size_t inst) const
+    {
+        if (inst >= n_) {
+            throw std::runtime_error(std::string("ensemble3dp: instance index must be "
+                                                 "within [0,") +
+                                     std::to_string(n_) + std::string("), but inst == ") +
+                                     std::to_string(inst));
+        }
+    }
+
+    void check_frame(size_t frame) const
+    {
+        if (frame >= model_.size()) {
+            throw std::runtime_error(
+                std::string("ensemble3dp: frame index must be within [0,") +
+                std::to_string(model_.size()) + std::string("), but frame == ") +
+                std::to_string(frame));
+        }
+    }
+
+    // SoA column of a dof joint frame (throws for frames without a dof joint)
+    size_t column(size_t frame) const
+    {
+        for (size_t c = 0; c < dofs_.size(); ++c)
+            if (dofs_[c] == frame) return c;
+        throw std::runtime_error(std::string("ensemble3dp: frame ") +
+                                 std::to_string(frame) +
+                                 std::string(" is not a dof joint of the model"));
+    }
+
+    // write instance `inst` (parameters + state, clock t) into a worker's model copy
+    void load(dynamic_system3dp& sys, size_t inst, value_t t) const
+    {
+        sys.set_time(t);
+        for (size_t i = 1; i < model_.size(); ++i)
+            sys.body[i] = scale_body3dp(model_.body[i], mscale_[i * n_ + inst]);
+        for (size_t c = 0; c < dofs_.size(); ++c) {
+            auto& js = sys.joint[dofs_[c]];
+            js.phi = q_[c * n_ + inst];
+            js.omega = qd_[c * n_ + inst];
+            js.stiffness = k_[c * n_ + inst];
+            sys.apply_joint_state(dofs_[c]);
+        }
+        sys.apply_driven_joints(); // prescribed joints at the instance clock
+    }
+
+    // read the integrated state of instance `inst` back from a worker's model copy
+    void store(dynamic_system3dp const& sys, size_t inst)
+    {
+        for (size_t c = 0; c < dofs_.size(); ++c) {
+            q_[c * n_ + inst] = sys.joint[dofs_[c]].phi;
+            qd_[c * n_ + inst] = sys.joint[dofs_[c]].omega;
+        }
+    }
+
+    // Run f(sys, inst) for every instance on n_threads workers of the pool, each with
+    // its own model copy `sys` (scratch_[w], made once and reused: load() overwrites
+    // everything an instance owns). Workers claim chunks of instances from a shared
+    // atomic counter until none are left; an exception thrown by f stops all workers
+    // and is rethrown here.
+    template <typename F> void for_each_instance(size_t n_threads, F&& f)
+    {
+        if (n_threads == 0)
+            n_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        size_t constexpr chunk = 16; // instances per claim
+        n_threads = std::min(n_threads, (n_ + chunk - 1) / chunk);
+        if (n_threads == 0) return; // empty ensemble
+        while (scratch_.size() < n_threads)
+            scratch_.push_back(model_);
+
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        pool_.run(n_threads, [&](size_t w) {
+            try {
+                for (;;) {
+                    size_t const begin = next.fetch_add(chunk);
+                    if (begin >= n_ || failed.load()) break;
+                    size_t const end = std::min(n_, begin + chunk);
+                    for (size_t inst = begin; inst < end; ++inst)
+                        f(scratch_[w], inst);
+                }
+            }
+            catch (...) {
+                failed.store(true);
+                throw; // rethrown by run()
+            }
+        });
+    }
+
+    static ensemble_stats reduce(std::span<value_t const> v)
+    {
+        ensemble_stats st;
+        if (v.empty()) return st;
+        st.min = st.max = v[0];
+        value_t sum = 0.0;
+        for (value_t x : v) {
+            sum += x;
+            st.min = std::min(st.min, x);
+            st.max = std::max(st.max, x);
+        }
+        st.mean = sum / static_cast<value_t>(v.size());
+        value_t var = 0.0;
+        for (value_t x : v)
+            var += (x - st.mean) * (x - st.mean);
+        st.stddev = std::sqrt(var / static_cast<value_t>(v.size()));
+        return st;
+    }
+};
+
+} // namespace hd::ga::pga
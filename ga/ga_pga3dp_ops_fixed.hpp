@@ -0,0 +1,378 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+// Fixed-topology layer for PGA3DP: a dynamic_system3dp whose kinematic tree is known at
+// COMPILE TIME, e.g. the 6-DOF arm of an embedded controller. The tree is a template
+// parameter pack of parent frame indices,
+//
+//     fixed_dynamic_system3dp<N, Parents...>     (frame 0 = root, frames 1..N = bodies)
+//
+// with one 1-DOF joint (revolute or prismatic) per body. Everything that the general
+// dynamic_system3dp discovers at run time (dof_joints, parent walks, ancestor tests,
+// workspace sizes) is fixed by the type instead:
+//
+//   storage     std::array per frame / per coordinate -- no allocation, no hashing
+//   ancestors   a constexpr table anc[j][i] (j on the path from i to the root)
+//   assembly    mass matrix + bias forces expanded over index_sequence with
+//               if constexpr on the table, so only the non-zero (ancestor) terms exist
+//   solve       the fixed-size LDL^T of detail/ga_solver.hpp (ldlt_decomp<N>)
+//
+// The system is built ONCE from a dynamic_system3dp model with the same topology (set up
+// through the usual add_revolute_body / add_prismatic_body / set_joint_spring_damper
+// API), so both describe the same mechanism. It evaluates the same forward dynamics as
+// the dense (CRBA + LTDL) path of dynamic_system3dp -- gravity, Newton-Euler bias and the
+// joint spring/dampers -- and integrates with the same RK4, so its trajectory agrees
+// with the model's to rounding (not bit for bit: the model round-trips its poses through
+// pose3dp and sums the mass matrix in CRBA order).
+//
+// Scope: the model must consist of exactly N dof joints whose parents match Parents...;
+// kinematically driven joints, applied wrenches and grounded springs are rejected by the
+// constructor (they need the run-time containers this layer avoids). Extra wrenches of a
+// subclass (extra_wrenches()) are not part of the model. A per-joint generalised force
+// (set_joint_torque, held constant over a step) takes their place as the controller
+// input.
+
+#include "ga_pga3dp_ops_mechanics.hpp" // dynamic_system3dp (the model)
+#include "ga_value_t.hpp"              // value_t
+
+#include <algorithm> // std::ranges::copy
+#include <array>
+#include <cstddef> // size_t
+#include <mdspan>
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <type_traits> // std::integral_constant
+#include <utility>     // std::index_sequence
+
+
+namespace hd::ga::pga {
+
+template <size_t N, size_t... Parents> class fixed_dynamic_system3dp {
+
+    static_assert(N > 0, "fixed_dynamic_system3dp: at least one body required");
+    static_assert(sizeof...(Parents) == N,
+                  "fixed_dynamic_system3dp: one parent frame index per body required");
+
+    // parent frame of each frame (index = frame, the root is its own parent)
+    static constexpr std::array<size_t, N + 1> parent_frame{0, Parents...};
+
+    // frames must be listed parent-before-child (as dynamic_system3dp adds them), so
+    // ascending frame order is a topological order of the tree
+    static constexpr bool topological_order()
+    {
+        for (size_t i = 1; i <= N; ++i)
+            if (parent_frame[i] >= i) return false;
+        return true;
+    }
+    static_assert(topological_order(),
+                  "fixed_dynamic_system3dp: each parent index must be smaller than the "
+                  "index of its child frame");
+
+    // anc[j][i] == true iff joint frame j lies on the path from frame i to the root
+    // (i included, the root excluded): joint j moves body i
+    static constexpr std::array<std::array<bool, N + 1>, N + 1> anc = [] {
+        std::array<std::array<bool, N + 1>, N + 1> t{};
+        for (size_t i = 1; i <= N; ++i)
+            for (size_t j = i; j != 0; j = parent_frame[j])
+                t[j][i] = true;
+        return t;
+    }();
+
+    // call f(std::integral_constant<size_t, i>{}) for the frames i = 1..N, expanded at
+    // compile time (the frame index is a constant expression inside f)
+    template <typename F> static constexpr void for_frames(F&& f)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (f(std::integral_constant<size_t, I + 1>{}), ...);
+        }(std::make_index_sequence<N>{});
+    }
+
+    // per-frame model data (index = frame, entry 0 = root is unused)
+    std::array<body3dp, N + 1> body_{};
+    std::array<twist3dp, N + 1> screw_{}; // joint screw in the body frame
+    std::array<mvec3dp_e, N + 1> rest_{}; // body->parent motor at q = 0
+    std::array<value_t, N + 1> k_{};      // joint spring stiffness
+    std::array<value_t, N + 1> c_{};      // joint damping
+    std::array<value_t, N + 1> q0_{};     // spring rest coordinate
+    vec3dp grav_{0.0, -9.81, 0.0, 0.0};
+
+    // integrated state u = [q_1..q_N, q-dot_1..q-dot_N] and the joint torque input
+    std::array<value_t, 2 * N> u_{};
+    std::array<value_t, N + 1> tau_{};
+    value_t time_{0.0};
+
+    // kinematics of one state, world frame: motor body -> world, world joint screw,
+    // world velocity twist and bias acceleration twist (q-ddot = 0) per frame
+    struct kin_state {
+        std::array<mvec3dp_e, N + 1> M;
+        std::array<twist3dp, N + 1> S;
+        std::array<twist3dp, N + 1> V;
+        std::array<twist3dp, N + 1> A;
+    };
+
+  public:
+
+    using mass_matrix_t = std::array<value_t, N * N>; // row-major N x N
+
+    // Copy topology, bodies, joint screws, force elements and the current joint state
+    // from `model`, which must consist of N dof joints with the parents Parents...
+    explicit fixed_dynamic_system3dp(dynamic_system3dp const& model) :
+        grav_(model.gravity()), time_(model.time())
+    {
+        if (model.size() != N + 1) {
+            throw std::runtime_error(
+                std::string("fixed_dynamic_system3dp: model has ") +
+                std::to_string(model.size()) + std::string(" frames, expected ") +
+                std::to_string(N + 1));
+        }
+        if (!model.driven_.empty() || !model.wrench_.empty() ||
+            !model.springs_.empty()) {
+            throw std::runtime_error(
+                std::string("fixed_dynamic_system3dp: driven joints, applied wrenches "
+                            "and grounded springs are not supported"));
+        }
+        for (size_t i = 1; i <= N; ++i) {
+            auto const& js = model.joint[i];
+            if (js.type != joint3dp::revolute && js.type != joint3dp::prismatic) {
+                throw std::runtime_error(
+                    std::string("fixed_dynamic_system3dp: frame ") + std::to_string(i) +
+                    std::string(" is not a revolute or prismatic joint"));
+            }
+            if (model.parent(i) != parent_frame[i]) {
+                throw std::runtime_error(
+                    std::string("fixed_dynamic_system3dp: frame ") + std::to_string(i) +
+                    std::string(" has parent ") + std::to_string(model.parent(i)) +
+                    std::string(" in the model, but ") + std::to_string(parent_frame[i]) +
+                    std::string(" in the template parameters"));
+            }
+            body_[i] = model.body[i];
+            screw_[i] = js.screw_b;
+            rest_[i] = js.rest;
+            k_[i] = js.stiffness;
+            c_[i] = js.damping;
+            q0_[i] = js.q_rest;
+            u_[i - 1] = js.phi;
+            u_[N + i - 1] = js.omega;
+        }
+    }
+
+    static constexpr size_t size() { return N + 1; } // number of frames (incl. root)
+    static constexpr size_t dof_count() { return N; }
+    static constexpr size_t parent(size_t idx) { return parent_frame[idx]; }
+
+    value_t time() const { return time_; }
+    void set_gravity(vec3dp const& g) { grav_ = g; } // g is a direction (w = 0)
+    vec3dp gravity() const { return grav_; }
+
+    // joint state of frame idx (1..N); the joint accessors throw std::runtime_error
+    // for an idx outside of 1..N
+    value_t joint_phi(size_t idx) const
+    {
+        if (idx == 0 || idx > N) throw joint_index_error("joint_phi", idx);
+        return u_[idx - 1];
+    }
+    value_t joint_omega(size_t idx) const
+    {
+        if (idx == 0 || idx > N) throw joint_index_error("joint_omega", idx);
+        return u_[N + idx - 1];
+    }
+    void set_joint_state(size_t idx, value_t q, value_t qdot)
+    {
+        if (idx == 0 || idx > N) throw joint_index_error("set_joint_state", idx);
+        u_[idx - 1] = q;
+        u_[N + idx - 1] = qdot;
+    }
+
+    // same force law as dynamic_system3dp::set_joint_spring_damper
+    void set_joint_spring_damper(size_t idx, value_t k, value_t c, value_t q0 = 0.0)
+    {
+        if (idx == 0 || idx > N) throw joint_index_error("set_joint_spring_damper", idx);
+        k_[idx] = k;
+        c_[idx] = c;
+        q0_[idx] = q0;
+    }
+
+    // generalised force (torque / force) applied by the actuator of joint idx, held
+    // constant over the following step() calls (zero-order hold)
+    void set_joint_torque(size_t idx, value_t tau)
+    {
+        if (idx == 0 || idx > N) throw joint_index_error("set_joint_torque", idx);
+        tau_[idx] = tau;
+    }
+    value_t joint_torque(size_t idx) const
+    {
+        if (idx == 0 || idx > N) throw joint_index_error("joint_torque", idx);
+        return tau_[idx];
+    }
+
+    // Advance the joint state by dt with RK4 (shared rk4_step, the integrator of the
+    // model's default path). Allocation-free.
+    void step(value_t dt)
+    {
+        std::array<value_t, 2 * 2 * N> uh_mem{};
+        std::array<value_t, 2 * N> rhs_mem{};
+        auto u = std::mdspan<value_t, std::dextents<size_t, 1>>(u_.data(), 2 * N);
+        auto uh = std::mdspan<value_t, std::dextents<size_t, 2>>(uh_mem.data(), 2, 2 * N);
+        auto const rhs =
+            std::mdspan<value_t const, std::dextents<size_t, 1>>(rhs_mem.data(), 2 * N);
+        for (size_t s = 1; s <= 4; ++s) {
+            auto const qdd = forward_dynamics(u_);
+            for (size_t k = 0; k < N; ++k) {
+                rhs_mem[k] = u_[N + k]; // dphi/dt = omega
+                rhs_mem[N + k] = qdd[k]; // domega/dt = q-ddot
+            }
+            rk4_step(u, uh, rhs, dt, s);
+        }
+        time_ += dt;
+    }
+
+    // joint accelerations q-ddot at the current state
+    std::array<value_t, N> joint_accel() const { return forward_dynamics(u_); }
+
+    // joint-space mass matrix M(q) at the current state (row-major N x N, symmetric);
+    // equals dynamic_system3dp::mass_matrix() of the model in the same state
+    mass_matrix_t mass_matrix() const
+    {
+        kin_state const ks = kinematics(u_);
+        mass_matrix_t Mm{};
+        std::array<value_t, N> rhs{};
+        assemble(ks, u_, Mm, rhs);
+        for (size_t j = 0; j < N; ++j)
+            for (size_t k = j + 1; k < N; ++k)
+                Mm[j * N + k] = Mm[k * N + j]; // assemble() fills the lower triangle
+        return Mm;
+    }
+
+    // body -> world motor of frame idx at the current state
+    mvec3dp_e world_motor(size_t idx) const { return kinematics(u_).M[idx]; }
+
+    // total kinetic energy: sum over bodies of 1/2 <V_body, I(V_body)>
+    value_t kinetic_energy() const
+    {
+        kin_state const ks = kinematics(u_);
+        value_t ke = 0.0;
+        for_frames([&](auto ic) {
+            constexpr size_t i = decltype(ic)::value;
+            twist3dp const Vb = move3dp(ks.V[i], rrev(ks.M[i]));
+            ke += 0.5 * spatial_dot(Vb, inertia(i, Vb));
+        });
+        return ke;
+    }
+
+  private:
+
+    // the exception thrown by the joint accessors for an idx outside of 1..N
+    static std::runtime_error joint_index_error(char const* fn, size_t idx)
+    {
+        return std::runtime_error(
+            std::string("fixed_dynamic_system3dp: ") + std::string(fn) +
+            std::string(": joint index must be within [1,") + std::to_string(N) +
+            std::string("], but idx == ") + std::to_string(idx));
+    }
+
+    static value_t spatial_dot(twist3dp const& xi, bivec3dp const& mom)
+    {
+        return dynamic_system3dp::spatial_dot(xi, mom);
+    }
+
+    // body momentum of body i for body twist X (the structured map if the body has one)
+    bivec3dp inertia(size_t i, twist3dp const& X) const
+    {
+        if (body_[i].Ip) return (*body_[i].Ip)(X);
+        return body_[i].I(X);
+    }
+
+    // forward kinematics of state u in one root -> leaves sweep (parents first)
+    kin_state kinematics(std::array<value_t, 2 * N> const& u) const
+    {
+        kin_state ks;
+        ks.M[0] = I_3dp_mv_e;
+        ks.V[0] = twist3dp{};
+        ks.A[0] = twist3dp{};
+        for_frames([&](auto ic) {
+            constexpr size_t i = decltype(ic)::value;
+            constexpr size_t p = parent_frame[i];
+            ks.M[i] = rgpr(ks.M[p], rgpr(rest_[i], rexp(0.5 * u[i - 1] * screw_[i])));
+            ks.S[i] = move3dp(screw_[i], ks.M[i]);
+            twist3dp const zeta = u[N + i - 1] * ks.S[i]; // joint twist (world)
+            ks.V[i] = ks.V[p] + zeta;
+            ks.A[i] = ks.A[p] + rcmt(ks.V[i], zeta); // bias: relative q-ddot = 0
+        });
+        return ks;
+    }
+
+    // Mass matrix (lower triangle, row-major) and RHS at state u, by virtual work over
+    // the bodies as in dynamic_system3dp::assemble_mass_bias:
+    //
+    //   M[j][k] = sum_i  spatial_dot( S_j^body_i , I_i( S_k^body_i ) )
+    //   RHS[j]  = sum_i [ m_i vcm_i(S_j).g  -  spatial_dot( S_j^body_i, F_bias_i ) ]
+    //             - k_j (q_j - q0_j) - c_j q-dot_j + tau_j
+    //
+    // with i running over the bodies moved by joint j (and k). The sums are expanded at
+    // compile time: only the (i, j) pairs with anc[j][i] generate code.
+    void assemble(kin_state const& ks, std::array<value_t, 2 * N> const& u,
+                  mass_matrix_t& Mm, std::array<value_t, N>& rhs) const
+    {
+        for_frames([&](auto ic) {
+            constexpr size_t i = decltype(ic)::value;
+            auto const Minv = rrev(ks.M[i]);
+            vec3dp const cm = move3dp(O_3dp, ks.M[i]);
+            twist3dp const Vb = move3dp(ks.V[i], Minv);
+            twist3dp const Ab = move3dp(ks.A[i], Minv);
+            bivec3dp const Fbias = inertia(i, Ab) + rcmt(Vb, inertia(i, Vb));
+            value_t const m = body_[i].mass;
+
+            // joint screws of the supporting joints in body i, and their momenta
+            std::array<twist3dp, N + 1> xs;
+            std::array<bivec3dp, N + 1> Ixs;
+            for_frames([&](auto jc) {
+                constexpr size_t j = decltype(jc)::value;
+                if constexpr (anc[j][i]) {
+                    xs[j] = move3dp(ks.S[j], Minv);
+                    Ixs[j] = inertia(i, xs[j]);
+                    vec3dp const vj = kinematic_system3dp::velocity_field(ks.S[j], cm);
+                    rhs[j - 1] += m * (vj.x * grav_.x + vj.y * grav_.y + vj.z * grav_.z) -
+                                  spatial_dot(xs[j], Fbias);
+                }
+            });
+            for_frames([&](auto jc) {
+                constexpr size_t j = decltype(jc)::value;
+                for_frames([&](auto kc) {
+                    constexpr size_t k = decltype(kc)::value;
+                    if constexpr (k <= j && anc[j][i] && anc[k][i])
+                        Mm[(j - 1) * N + (k - 1)] += spatial_dot(xs[j], Ixs[k]);
+                });
+            });
+        });
+
+        for (size_t j = 1; j <= N; ++j)
+            rhs[j - 1] += -k_[j] * (u[j - 1] - q0_[j]) - c_[j] * u[N + j - 1] + tau_[j];
+    }
+
+    // q-ddot solving M(q) q-ddot = RHS(q, q-dot) by the fixed-size LDL^T (M is SPD)
+    std::array<value_t, N> forward_dynamics(std::array<value_t, 2 * N> const& u) const
+    {
+        kin_state const ks = kinematics(u);
+        mass_matrix_t Mm{};
+        std::array<value_t, N> rhs{};
+        assemble(ks, u, Mm, rhs);
+        // the fixed-size solver works in double (as lu_solve does for the dynamic path):
+        // factorize a double copy of M, then cast the solution back to value_t
+        std::array<double, N * N> Md{};
+        std::array<double, N> x{};
+        std::ranges::copy(Mm, Md.begin());
+        std::ranges::copy(rhs, x.begin());
+        hd::ga::ldlt_decomp<N>(
+            std::mdspan<double, std::extents<size_t, N, N>>(Md.data()));
+        hd::ga::ldlt_backsubs<N>(
+            std::mdspan<double const, std::extents<size_t, N, N>>(Md.data()),
+            std::mdspan<double, std::extents<size_t, N>>(x.data()));
+        for (size_t i = 0; i < N; ++i)
+            rhs[i] = static_cast<value_t>(x[i]);
+        return rhs;
+    }
+};
+
+} // namespace hd::ga::pga
@@ -3,20 +3,25 @@
 // Copyright 2024-2026, Daniel Hug. All rights reserved.
 // Licensed under the terms specified in LICENSE.txt file.
 
-#include "detail/ga_solver.hpp" // hd::ga::lu_decomp / lu_backsubs / det
+#include "detail/ga_solver.hpp"      // hd::ga::lu_decomp / lu_backsubs / ldlt / det
+#include "detail/ga_worker_pool.hpp" // detail::worker_pool (parallel free bodies)
 #include "ga_pga3dp_ops.hpp"
 #include "ga_usr_utilities.hpp" // hd::ga::rk4_step (shared RK4 integrator)
 #include "ga_value_t.hpp"       // for value_t used in convenience type alias
 
-#include <algorithm> // std::find, std::reverse
+#include <algorithm> // std::min, std::max, std::fill, std::reverse
 #include <array>
+#include <atomic>     // std::atomic (parallel free-body chunk counter)
+#include <bit>        // std::bit_ceil (segment tree size)
 #include <cmath>      // std::abs
 #include <functional> // std::function (time-varying applied wrench)
 #include <limits>     // std::numeric_limits
 #include <mdspan>
 #include <optional> // std::optional (multistep integrator state)
+#include <span>     // std::span (subtree ranges)
 #include <stdexcept>
 #include <string>
+#include <thread>        // std::thread::hardware_concurrency
 #include <unordered_map> // std::unordered_map (frame name -> index)
 #include <utility>       // std::pair, std::move (assemble_mass_bias return)
 #include <vector>
@@ -27,11 +32,19 @@ namespace hd::ga::pga {
 // Forward declaration of the (optional) closed-loop layer in
 // ga_pga3dp_ops_constraints.hpp. dynamic_system3dp grants it friendship so the
 // constrained KKT / assembly solver can reuse the tree's private assembly seam
-// (assemble_mass_bias, the joint screws, dof_joints/is_ancestor, apply_joint_state)
+// (assemble_mass_bias, the joint screws, dof_joints, apply_joint_state)
 // WITHOUT widening the open-loop public API. Open-loop users never include the
 // constraints header.
 class closed_loop_system3dp;
 
+// Forward declaration of the (optional) ensemble layer in ga_pga3dp_ops_ensemble.hpp,
+// befriended for the same reason: it loads / stores per-instance joint and body state.
+class ensemble3dp;
+
+// Forward declaration of the (optional) fixed-topology layer in ga_pga3dp_ops_fixed.hpp,
+// befriended for the same reason: it copies the model's joints and bodies once.
+template <size_t N, size_t... Parents> class fixed_dynamic_system3dp;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Inertia3dp: Inertia matrix for 3D projective GA (6x6 matrix)
 //
@@ -351,52 +364,184 @@ Inertia3dp<T> get_disc_inertia(T m, T r, T t, BiVec3dp<T> const& L_pivot = BiVec
 }
 
 
-// Get inverse of inertia matrix using LU decomposition
+// Get inverse of inertia matrix
 // Solves I * I_inv = Identity by back-substitution for each column
-// Throws std::invalid_argument if inertia matrix is singular (det = 0)
+// Throws std::invalid_argument if inertia matrix is singular
+//
+// Fixed-size (6x6), heap-free and constexpr-capable. The map pairs the rate components
+// (vx, vy, vz, mx, my, mz) with the momentum components in swapped order, so swapping
+// its two 3-row blocks (P: rows 3..5 first) turns it into the SYMMETRIC matrix
+//
+//     S = P I = [ m (|X|^2 1 - X X^T) (summed)   m Xw [X]x  ]
+//               [ (m Xw [X]x)^T                   m Xw^2 1   ]
+//
+// which is definite for any physical body. So I x = e  <=>  S x = P e  is solved by
+// LDL^T (no pivoting, about half the work of LU). A map that is not symmetric in that
+// sense (hand-assembled) or has a zero LDL^T pivot falls back to the pivoting LU.
 template <typename T>
     requires(std::floating_point<T>)
-Inertia3dp<T> get_inertia_inverse(Inertia3dp<T> const& I)
+constexpr Inertia3dp<T> get_inertia_inverse(Inertia3dp<T> const& I)
 {
-    // Check determinant before attempting inversion
-    T const d = hd::ga::det(I.view());
-    if (d == T{0}) {
-        throw std::invalid_argument(
-            "get_inertia_inverse: singular inertia matrix (determinant is zero)");
+    using hd::ga::detail::solver_abs;
+    std::array<double, 36> a{};
+    double amax = 0.0;
+    for (size_t r = 0; r < 6; ++r) {
+        for (size_t c = 0; c < 6; ++c) {
+            a[r * 6 + c] = static_cast<double>(I.data[((r + 3) % 6) * 6 + c]); // P I
+            amax = std::max(amax, solver_abs(a[r * 6 + c]));
+        }
     }
-
-    // Copy data for LU decomposition (modifies in place)
-    std::array<double, 36> A_data;
-    for (size_t i = 0; i < 36; ++i) {
-        A_data[i] = static_cast<double>(I.data[i]);
+    bool sym = true;
+    for (size_t r = 0; r < 6 && sym; ++r)
+        for (size_t c = r + 1; c < 6 && sym; ++c)
+            sym = solver_abs(a[r * 6 + c] - a[c * 6 + r]) <= 1.0e-12 * amax;
+
+    auto const av = std::mdspan<double, std::extents<size_t, 6, 6>>(a.data());
+    std::array<int, 6> perm{};
+    auto const pv = std::mdspan<int, std::extents<size_t, 6>>(perm.data());
+    bool const use_ldlt = sym && hd::ga::detail::ldlt_decomp_fixed<6>(av);
+    if (!use_ldlt) { // general path: pivoting LU of I itself
+        for (size_t k = 0; k < 36; ++k)
+            a[k] = static_cast<double>(I.data[k]);
+        if (!hd::ga::detail::lu_decomp_fixed<6>(av, pv)) {
+            throw std::invalid_argument(
+                "get_inertia_inverse: singular inertia matrix (determinant is zero)");
+        }
     }
-    std::array<int, 6> perm;
-
-    auto A = std::mdspan<double, std::dextents<size_t, 2>>{A_data.data(), 6, 6};
-    auto perm_view = std::mdspan<int, std::dextents<size_t, 1>>{perm.data(), 6};
 
-    hd::ga::lu_decomp(A, perm_view);
-
-    // Solve for each column of identity matrix to get inverse
     Inertia3dp<T> I_inv;
-    auto A_const =
-        std::mdspan<double const, std::dextents<size_t, 2>>{A_data.data(), 6, 6};
-    auto perm_const = std::mdspan<int const, std::dextents<size_t, 1>>{perm.data(), 6};
-
     for (size_t col = 0; col < 6; ++col) {
-        std::array<double, 6> e = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-        e[col] = 1.0;
-        auto e_view = std::mdspan<double, std::dextents<size_t, 1>>{e.data(), 6};
-        hd::ga::lu_backsubs(A_const, perm_const, e_view);
-
+        std::array<double, 6> e{};
+        auto const ev = std::mdspan<double, std::extents<size_t, 6>>(e.data());
+        if (use_ldlt) {
+            e[(col + 3) % 6] = 1.0; // P e_col
+            hd::ga::ldlt_backsubs(av, ev);
+        }
+        else {
+            e[col] = 1.0;
+            hd::ga::lu_backsubs(av, pv, ev);
+        }
         // Store column in row-major format
-        for (size_t row = 0; row < 6; ++row) {
+        for (size_t row = 0; row < 6; ++row)
             I_inv.data[row * 6 + col] = static_cast<T>(e[row]);
-        }
     }
     return I_inv;
 }
 
+// Batched inverse: I_inv[k] = get_inertia_inverse(I[k]) -- e.g. every body after a
+// payload change. Throws std::invalid_argument on a size mismatch or a singular map.
+template <typename T>
+    requires(std::floating_point<T>)
+void get_inertia_inverse(std::span<Inertia3dp<T> const> I, std::span<Inertia3dp<T>> I_inv)
+{
+    if (I.size() != I_inv.size())
+        throw std::invalid_argument("get_inertia_inverse: batch sizes differ");
+    for (size_t k = 0; k < I.size(); ++k)
+        I_inv[k] = get_inertia_inverse(I[k]);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// PrincipalInertia3dp: STRUCTURED form of a rigid body's inertia map
+//
+// The inertia map of a physical body is not a general 6x6 matrix (see the block
+// structure documented at get_cuboid_inertia). With the body axes along the principal
+// axes it is fixed by 7 numbers (8 with the homogeneous w of the cm): the mass m, the
+// principal moments J = diag(Jxx, Jyy, Jzz) about the cm, and the cm position c in
+// body coordinates (the OPTIONAL offset; c = 0 when the body origin is the cm):
+//
+//   I = get_point_inertia(m, c) + J     (J in the lower-left block, as for the cuboid)
+//
+// Written out on Omega = (omega | v) (weight = angular, bulk = linear velocity):
+//
+//   p = m (v + omega x c)               (linear momentum, the vx,vy,vz slots)
+//   L = J omega + c x p                 (angular momentum, the mx,my,mz slots)
+//
+// and the inverse map solves these two lines back in closed form:
+//
+//   omega = J^-1 (L - c x p),   v = p / m - omega x c
+//
+// i.e. about 20 multiplies each way instead of the 36 of the dense Inertia3dp mat-vec
+// (for I and again for I_inv), and no 6x6 inverse to precompute. The dense Inertia3dp
+// stays the general path (hand-assembled or accumulated maps); dense() converts.
+// The Steiner-corrected pivot maps of get_cuboid_inertia / get_disc_inertia are
+// representable too (corrected J, c = 0).
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+    requires(std::floating_point<T>)
+struct PrincipalInertia3dp {
+    T m{0};                               // mass
+    T Jxx{0}, Jyy{0}, Jzz{0};             // principal moments about the cm
+    Vec3dp<T> cm{T{0}, T{0}, T{0}, T{1}}; // cm in body coordinates (unitized, w = 1)
+
+    // Apply inertia map: I[Omega] (twist -> momentum), same result as dense()(Omega)
+    constexpr BiVec3dp<T> operator()(BiVec3dp<T> const& Omega) const
+    {
+        // velocity of the cm: u = v + omega x c
+        T const ux = Omega.mx + Omega.vy * cm.z - Omega.vz * cm.y;
+        T const uy = Omega.my + Omega.vz * cm.x - Omega.vx * cm.z;
+        T const uz = Omega.mz + Omega.vx * cm.y - Omega.vy * cm.x;
+        T const px = m * ux, py = m * uy, pz = m * uz;
+        return BiVec3dp<T>{px,
+                           py,
+                           pz,
+                           Jxx * Omega.vx + cm.y * pz - cm.z * py,
+                           Jyy * Omega.vy + cm.z * px - cm.x * pz,
+                           Jzz * Omega.vz + cm.x * py - cm.y * px};
+    }
+
+    // Apply inverse inertia map: I^-1[P] (momentum -> twist), the closed-form solve
+    // Pre: m > 0 and Jxx, Jyy, Jzz > 0 (see get_principal_inertia)
+    constexpr BiVec3dp<T> inverse(BiVec3dp<T> const& P) const
+    {
+        // omega = J^-1 (L - c x p)
+        T const wx = (P.mx - (cm.y * P.vz - cm.z * P.vy)) / Jxx;
+        T const wy = (P.my - (cm.z * P.vx - cm.x * P.vz)) / Jyy;
+        T const wz = (P.mz - (cm.x * P.vy - cm.y * P.vx)) / Jzz;
+        // v = p / m - omega x c
+        T const inv_m = T{1} / m;
+        return BiVec3dp<T>{wx,
+                           wy,
+                           wz,
+                           P.vx * inv_m - (wy * cm.z - wz * cm.y),
+                           P.vy * inv_m - (wz * cm.x - wx * cm.z),
+                           P.vz * inv_m - (wx * cm.y - wy * cm.x)};
+    }
+
+    // The equivalent general (dense 6x6) inertia map
+    Inertia3dp<T> dense() const
+    {
+        Inertia3dp<T> I = get_point_inertia(m, cm);
+        auto v = I.view();
+        v[3, 0] += Jxx;
+        v[4, 1] += Jyy;
+        v[5, 2] += Jzz;
+        return I;
+    }
+};
+
+// Checked construction of a PrincipalInertia3dp. Throws std::invalid_argument for a
+// map without a well-defined inverse (m <= 0 or a principal moment <= 0) or a cm that is
+// not a unitized point.
+template <typename T>
+    requires(std::floating_point<T>)
+PrincipalInertia3dp<T> get_principal_inertia(T m, T Jxx, T Jyy, T Jzz,
+                                             Vec3dp<T> const& cm = Vec3dp<T>{T{0}, T{0},
+                                                                            T{0}, T{1}})
+{
+    if (!(m > T{0} && Jxx > T{0} && Jyy > T{0} && Jzz > T{0})) {
+        throw std::invalid_argument(
+            "get_principal_inertia: mass and principal moments must be > 0");
+    }
+    if (cm.w != T{1}) {
+        throw std::invalid_argument(
+            "get_principal_inertia: unitized cm expected. Provided cm.w == " +
+            std::to_string(cm.w));
+    }
+    return PrincipalInertia3dp<T>{m, Jxx, Jyy, Jzz, cm};
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // ODE right-hand side helpers for 3D rigid body dynamics
@@ -418,6 +563,16 @@ BiVec3dp<T> compute_omega_dot(Inertia3dp<T> const& I_inv, BiVec3dp<T> const& F,
     return I_inv(rhs);
 }
 
+// Same right-hand side through the structured inertia map: both applications use the
+// block form (I and its closed-form inverse) instead of two dense 6x6 mat-vecs.
+template <typename T>
+    requires(std::floating_point<T>)
+constexpr BiVec3dp<T> compute_omega_dot(PrincipalInertia3dp<T> const& I,
+                                        BiVec3dp<T> const& F, BiVec3dp<T> const& Omega)
+{
+    return I.inverse(F - rcmt(Omega, I(Omega)));
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 // pose3dp: a rigid pose RELATIVE to a parent frame, the 3D twin of pose2dp{origin, phi}.
@@ -519,6 +674,27 @@ class static_system3dp {
     std::vector<size_t> parent_of;    // parent frame index per frame (root: itself)
     std::unordered_map<std::string, size_t> name_to_idx; // frame name -> index
 
+    // forward-kinematics cache (as in static_system2dp): body -> world motor per frame,
+    // refreshed lazily after set_pose() marked a frame (and thus its subtree) stale
+    std::vector<mvec3dp_e> fk_motor; // cached body -> world motor per frame
+    std::vector<char> fk_stale;      // frame pose (or an ancestor pose) changed
+    size_t fk_first_stale{0};        // lowest stale index (== size(): cache is valid)
+
+    // ancestor index (as in static_system2dp): pre-order intervals, maintained by
+    // add_frame(); the subtree of i is tour[tour_in[i], tour_out[i])
+    std::vector<size_t> tour;     // frame indices in pre-order (tour[tour_in[i]] == i)
+    std::vector<size_t> tour_in;  // pre-order position of frame i
+    std::vector<size_t> tour_out; // one past the last pre-order position in i's subtree
+
+    // opt-in motor segment tree over one root -> tip path (see enable_segment_tree): a
+    // complete binary tree in an array, leaf p at seg_node[seg_leaves + p] holding the
+    // link motor (body -> parent) of path frame p, each inner node the rgpr product of
+    // its two children in path order (root side on the left)
+    std::vector<size_t> seg_path;    // path frames, root first (empty: disabled)
+    std::vector<size_t> seg_pos;     // position of a frame on the path, or off_path
+    std::vector<mvec3dp_e> seg_node; // tree nodes, [1, 2 * seg_leaves)
+    size_t seg_leaves{0};            // leaf count (power of two >= path length)
+
   public:
 
     static_system3dp() = default; // create an empty system
@@ -553,6 +729,11 @@ class static_system3dp {
         name_to_idx.emplace(rf.get_name(), new_idx);
         vfr.push_back(rf);
         parent_of.push_back(parent_idx);
+        fk_motor.push_back(I_3dp_mv_e);
+        fk_stale.push_back(1);
+        fk_first_stale = std::min(fk_first_stale, new_idx);
+        insert_into_tour(new_idx, parent_idx);
+        if (!seg_path.empty()) seg_pos.push_back(off_path); // new frame: off the path
     }
 
     // Look up a frame index by its name (throws if no such frame exists).
@@ -586,13 +767,25 @@ class static_system3dp {
         // identity transformation (M is the pseudoscalar, the neutral element of rgpr())
         if (from_idx == to_idx) return I_3dp_mv_e;
 
-        auto const to_chain = ancestor_chain(to_idx); // [to, parent(to), ..., root]
+        // both frames on the segment-tree path (the root always is): one range product
+        // of the link motors between them, O(log n) rgpr calls
+        if (!seg_path.empty() && seg_pos[from_idx] != off_path &&
+            seg_pos[to_idx] != off_path) {
+            size_t const pf = seg_pos[from_idx];
+            size_t const pt = seg_pos[to_idx];
+            return (pf > pt) ? seg_range(pt + 1, pf + 1)         // up: from -> to
+                             : rrev(seg_range(pf + 1, pt + 1)); // down
+        }
+
+        // fast paths vs. the root: served from the forward-kinematics cache
+        if (to_idx == 0) return world_motor(from_idx);       // body -> world
+        if (from_idx == 0) return rrev(world_motor(to_idx)); // world -> body
 
         // M_up: from -> LCA. Each child -> parent step is rrev(step_pos_trafo(child)); a
         // further-up step is multiplied on the LEFT.
         mvec3dp_e M_up = I_3dp_mv_e;
         size_t node = from_idx;
-        while (std::find(to_chain.begin(), to_chain.end(), node) == to_chain.end()) {
+        while (!is_ancestor(node, to_idx)) { // O(1) interval test locates the LCA
             M_up = rgpr(rrev(step_pos_trafo(node)), M_up);
             node = parent_of[node];
         }
@@ -601,8 +794,8 @@ class static_system3dp {
         // M_down: LCA -> to. Each parent -> child step is step_pos_trafo(child); the
         // deepest child (to) ends up on the far LEFT.
         mvec3dp_e M_down = I_3dp_mv_e;
-        for (size_t j = 0; to_chain[j] != lca; ++j) {
-            M_down = rgpr(M_down, step_pos_trafo(to_chain[j]));
+        for (size_t n = to_idx; n != lca; n = parent_of[n]) {
+            M_down = rgpr(M_down, step_pos_trafo(n));
         }
 
         return rgpr(M_down, M_up); // apply the up-segment first, then the down-segment
@@ -637,20 +830,162 @@ class static_system3dp {
     static_frame3dp const& frame(size_t idx) const { return vfr[idx]; }
     size_t parent(size_t idx) const { return parent_of[idx]; }
 
+    // frame `anc` on the path from `idx` up to the root (inclusive)? O(1) interval test
+    bool is_ancestor(size_t anc, size_t idx) const
+    {
+        return tour_in[anc] <= tour_in[idx] && tour_in[idx] < tour_out[anc];
+    }
+
+    // subtree rooted at idx (idx first, then its descendants in pre-order)
+    std::span<size_t const> subtree(size_t idx) const
+    {
+        return std::span<size_t const>(tour).subspan(tour_in[idx],
+                                                     tour_out[idx] - tour_in[idx]);
+    }
+
+    size_t subtree_size(size_t idx) const { return tour_out[idx] - tour_in[idx]; }
+
     // reposition frame idx relative to its parent (origin expected unitized, w = 1)
-    void set_pose(size_t idx, pose3dp const& p) { vfr[idx].set_pose(p); }
+    void set_pose(size_t idx, pose3dp const& p)
+    {
+        vfr[idx].set_pose(p);
+        mark_stale(idx);
+        if (!seg_path.empty() && seg_pos[idx] != off_path && parent_of[idx] != idx) {
+            seg_update(seg_pos[idx], rrev(step_pos_trafo(idx)));
+        }
+    }
+
+    // Opt-in balanced composition tree of the link motors along the root -> tip_idx path
+    // (a serial chain, or the chain of one end effector inside a larger tree). With it,
+    // set_pose() of a path frame updates O(log n) tree nodes and get_pos_trafo() between
+    // any two path frames (e.g. tip -> world) is one range product of O(log n) rgpr
+    // calls -- instead of the O(n) recomposition below a changed joint that the
+    // forward-kinematics cache needs. Made for loops that perturb ONE joint and then ask
+    // for the tip pose (IK, teleoperation on long snake arms). Queries involving frames
+    // off the path keep using the cache. Costs O(n) to build; call again to move it to
+    // another tip, disable_segment_tree() to drop it.
+    void enable_segment_tree(size_t tip_idx)
+    {
+        if (tip_idx >= vfr.size()) {
+            throw std::runtime_error(
+                std::string("static_system3dp: enable_segment_tree: tip_idx must be "
+                            "within [0,") +
+                std::to_string(vfr.size()) + std::string("), but provided tip_idx == ") +
+                std::to_string(tip_idx));
+        }
+        seg_path.clear();
+        for (size_t n = tip_idx;; n = parent_of[n]) {
+            seg_path.push_back(n);
+            if (parent_of[n] == n) break;
+        }
+        std::reverse(seg_path.begin(), seg_path.end());
+        seg_pos.assign(vfr.size(), off_path);
+        for (size_t p = 0; p < seg_path.size(); ++p)
+            seg_pos[seg_path[p]] = p;
+
+        seg_leaves = std::bit_ceil(seg_path.size());
+        seg_node.assign(2 * seg_leaves, I_3dp_mv_e); // padding leaves: identity
+        for (size_t p = 1; p < seg_path.size(); ++p) // leaf 0 (the root): identity
+            seg_node[seg_leaves + p] = rrev(step_pos_trafo(seg_path[p]));
+        for (size_t k = seg_leaves; k-- > 1;)
+            seg_node[k] = rgpr(seg_node[2 * k], seg_node[2 * k + 1]);
+    }
+
+    void disable_segment_tree()
+    {
+        seg_path.clear();
+        seg_pos.clear();
+        seg_node.clear();
+        seg_leaves = 0;
+    }
+
+    bool has_segment_tree() const { return !seg_path.empty(); }
+
+    // frames of the segment-tree path, root first (empty if disabled)
+    std::span<size_t const> segment_tree_path() const { return seg_path; }
 
   private:
 
-    // chain of ancestors from idx up to the root: [idx, parent(idx), ..., root]
-    std::vector<size_t> ancestor_chain(size_t idx) const
+    static size_t constexpr off_path = std::numeric_limits<size_t>::max();
+
+    // product of the link motors of path positions [lo, hi) in path order: the motor
+    // from body path[hi - 1] to frame path[lo - 1]. Bottom-up walk collecting the left
+    // and the right partial products separately (rgpr does not commute).
+    mvec3dp_e seg_range(size_t lo, size_t hi) const
+    {
+        mvec3dp_e left = I_3dp_mv_e;
+        mvec3dp_e right = I_3dp_mv_e;
+        for (lo += seg_leaves, hi += seg_leaves; lo < hi; lo >>= 1, hi >>= 1) {
+            if (lo & 1) left = rgpr(left, seg_node[lo++]);
+            if (hi & 1) right = rgpr(seg_node[--hi], right);
+        }
+        return rgpr(left, right);
+    }
+
+    // replace the link motor of path position p and recompose its O(log n) ancestors
+    void seg_update(size_t p, mvec3dp_e const& link)
+    {
+        size_t k = seg_leaves + p;
+        seg_node[k] = link;
+        for (k >>= 1; k >= 1; k >>= 1)
+            seg_node[k] = rgpr(seg_node[2 * k], seg_node[2 * k + 1]);
+    }
+
+    // invalidate the cached world motor of frame idx (its subtree follows on refresh)
+    void mark_stale(size_t idx)
+    {
+        fk_stale[idx] = 1;
+        fk_first_stale = std::min(fk_first_stale, idx);
+    }
+
+    // cached body -> world motor of frame idx (== the former LCA walk for to_idx == 0)
+    mvec3dp_e const& world_motor(size_t idx)
+    {
+        if (fk_first_stale < vfr.size()) refresh_world_motors();
+        return fk_motor[idx];
+    }
+
+    // Single sweep over [fk_first_stale, size()): staleness propagates from parent to
+    // child (parent index < child index), and only stale frames are recomposed from
+    // their parent's (already valid) world motor: world(j) = world(parent(j)) * (j ->
+    // parent(j)). The root IS the world frame: its motor stays the identity.
+    void refresh_world_motors()
+    {
+        for (size_t j = fk_first_stale; j < vfr.size(); ++j) {
+            size_t const par = parent_of[j];
+            if (par != j && fk_stale[par]) fk_stale[j] = 1;
+            if (!fk_stale[j]) continue;
+            fk_motor[j] =
+                (par == j) ? I_3dp_mv_e : rgpr(fk_motor[par], rrev(step_pos_trafo(j)));
+        }
+        std::fill(fk_stale.begin() + fk_first_stale, fk_stale.end(), 0);
+        fk_first_stale = vfr.size();
+    }
+
+    // insert the new leaf `idx` as the last child of `par` into the pre-order index
+    // (see static_system2dp::insert_into_tour)
+    void insert_into_tour(size_t idx, size_t par)
     {
-        std::vector<size_t> chain{idx};
-        while (parent_of[idx] != idx) { // root is its own parent
-            idx = parent_of[idx];
-            chain.push_back(idx);
+        if (idx == par) { // root
+            tour.assign(1, idx);
+            tour_in.assign(1, 0);
+            tour_out.assign(1, 1);
+            return;
+        }
+        size_t const pos = tour_out[par];
+        size_t const par_in = tour_in[par];
+        for (size_t i = 0; i < idx; ++i) {
+            if (tour_in[i] >= pos) { // behind the insertion point: shift
+                ++tour_in[i];
+                ++tour_out[i];
+            }
+            else if (tour_in[i] <= par_in && par_in < tour_out[i]) { // ancestor of idx
+                ++tour_out[i];
+            }
         }
-        return chain;
+        tour.insert(tour.begin() + static_cast<std::ptrdiff_t>(pos), idx);
+        tour_in.push_back(pos);
+        tour_out.push_back(pos + 1);
     }
 };
 
@@ -674,6 +1009,13 @@ class static_system3dp {
 // twist2dp was a vec2dp -- see the 2D->3D notes.
 using twist3dp = bivec3dp;
 
+// SoA block of n points or free vectors for the batch point_velocity/point_acceleration
+// queries: row k holds component k (x, y, z, w), column i is point i -- i.e. an extent
+// (4, n) layout_right view, so each component row is contiguous and the per-point loop
+// vectorizes. Results are free vectors (w row = 0).
+using vec_block3dp = std::mdspan<value_t, std::dextents<size_t, 2>>;
+using vec_cblock3dp = std::mdspan<value_t const, std::dextents<size_t, 2>>;
+
 
 // Momentary kinematic state of a frame RELATIVE to its parent (physical inputs). Both
 // quantities are direction vectors (w = 0). Carries NO pose -- the pose is held by the
@@ -803,12 +1145,126 @@ class kinematic_system3dp : public static_system3dp {
         return rcmt(A, X) + rcmt(V, rcmt(V, X));
     }
 
+    // Block forms of velocity_field / accel_field: one twist (pair), n points. The
+    // rcmt(bivec, vec) products are written out component-wise with the twist read once
+    // into scalars, and there is ONE loop per output row: each loop streams over at
+    // most four contiguous input rows and writes one, which keeps the runtime alias
+    // checks the compiler emits few enough for it to vectorize (a single loop writing
+    // all rows needs more checks than it is willing to version for). The row-wise loops
+    // rule out in-place use: throws std::invalid_argument unless X and out are both
+    // (4, n) blocks that do not overlap.
+    static void velocity_field(twist3dp const& V, vec_cblock3dp X, vec_block3dp out)
+    {
+        check_blocks("velocity_field", X, out);
+        size_t const n = X.extent(1);
+        if (n == 0) return;
+        value_t const wx = V.vx, wy = V.vy, wz = V.vz; // angular part
+        value_t const mx = V.mx, my = V.my, mz = V.mz; // linear part
+        value_t const *x = &X[0, 0], *y = &X[1, 0], *z = &X[2, 0], *w = &X[3, 0];
+        value_t *o0 = &out[0, 0], *o1 = &out[1, 0], *o2 = &out[2, 0], *o3 = &out[3, 0];
+        for (size_t i = 0; i < n; ++i)
+            o0[i] = wy * z[i] - wz * y[i] + mx * w[i];
+        for (size_t i = 0; i < n; ++i)
+            o1[i] = -wx * z[i] + wz * x[i] + my * w[i];
+        for (size_t i = 0; i < n; ++i)
+            o2[i] = wx * y[i] - wy * x[i] + mz * w[i];
+        std::fill(o3, o3 + n, value_t(0.0)); // free vectors
+    }
+
+    static void accel_field(twist3dp const& V, twist3dp const& A, vec_cblock3dp X,
+                            vec_block3dp out)
+    {
+        check_blocks("accel_field", X, out);
+        size_t const n = X.extent(1);
+        if (n == 0) return;
+        value_t const wx = V.vx, wy = V.vy, wz = V.vz, mx = V.mx, my = V.my, mz = V.mz;
+        value_t const ax = A.vx, ay = A.vy, az = A.vz, nx = A.mx, ny = A.my, nz = A.mz;
+        value_t const *x = &X[0, 0], *y = &X[1, 0], *z = &X[2, 0], *w = &X[3, 0];
+        value_t *o0 = &out[0, 0], *o1 = &out[1, 0], *o2 = &out[2, 0], *o3 = &out[3, 0];
+        // a = rcmt(A, X) + rcmt(V, v) with v = rcmt(V, X) (a free vector, w = 0)
+        for (size_t i = 0; i < n; ++i) {
+            value_t const vy = -wx * z[i] + wz * x[i] + my * w[i];
+            value_t const vz = wx * y[i] - wy * x[i] + mz * w[i];
+            o0[i] = ay * z[i] - az * y[i] + nx * w[i] + wy * vz - wz * vy;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            value_t const vx = wy * z[i] - wz * y[i] + mx * w[i];
+            value_t const vz = wx * y[i] - wy * x[i] + mz * w[i];
+            o1[i] = -ax * z[i] + az * x[i] + ny * w[i] - wx * vz + wz * vx;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            value_t const vx = wy * z[i] - wz * y[i] + mx * w[i];
+            value_t const vy = -wx * z[i] + wz * x[i] + my * w[i];
+            o2[i] = ax * y[i] - ay * x[i] + nz * w[i] + wx * vy - wy * vx;
+        }
+        std::fill(o3, o3 + n, value_t(0.0)); // free vectors
+    }
+
+    // World velocity & acceleration twist pair of a frame (see world_VA_all below).
+    struct world_va3dp {
+        twist3dp V; // velocity twist
+        twist3dp A; // acceleration twist
+    };
+
+    // World velocity & acceleration twists of ALL frames in ONE topological sweep,
+    // written into the caller-provided buffer va (va[i] <-> frame i; needs
+    // va.size() >= size()).
+    //
+    // A parent is always added before its children (add_frame only accepts an existing
+    // parent index), so ascending index order IS a root -> leaf order: every frame
+    // reuses the already finished entry of its parent,
+    //
+    //   va[i].V = va[parent].V + Ad(xi_i)
+    //   va[i].A = va[parent].A + Ad(xidot_i) + [va[i].V, Ad(xi_i)]
+    //
+    // i.e. ONE world motor and two adjoints per frame instead of one world_VA(idx)
+    // recursion (depth motor lookups) per frame. Meant for callers that query every frame
+    // (exporters, visualization): fill the buffer once, then hand it to the span
+    // overloads of point_velocity / point_acceleration. The buffer is NOT kept in sync
+    // -- refill it after any change of poses or twists.
+    void world_VA_all(std::span<world_va3dp> va)
+    {
+        if (va.size() < size()) {
+            throw std::runtime_error(std::string("world_VA_all: buffer holds ") +
+                                     std::to_string(va.size()) +
+                                     std::string(" entries, system has ") +
+                                     std::to_string(size()) + std::string(" frames"));
+        }
+        for (size_t i = 0; i < size(); ++i) {
+            auto const par = parent(i);
+            if (par == i) { // root contributes nothing
+                va[i] = {};
+                continue;
+            }
+            auto const M = get_pos_trafo(i, 0);
+            auto const zeta = move3dp(rel_vtwist[i], M);    // Ad(xi_i)     world rel. vel
+            auto const zetadot = move3dp(rel_atwist[i], M); // Ad(xidot_i)  world rel. acc
+            auto const V = va[par].V + zeta;
+            va[i] = {V, va[par].A + zetadot + rcmt(V, zeta)};
+        }
+    }
+
     // Velocity of a world-space point X rigidly attached to frame idx.
     vec3dp point_velocity(vec3dp const& X_world, size_t idx)
     {
         return velocity_field(twist_world(idx), X_world);
     }
 
+    // same, read from a buffer filled by world_VA_all (no propagation per query)
+    static vec3dp point_velocity(vec3dp const& X_world, size_t idx,
+                                 std::span<world_va3dp const> va)
+    {
+        return velocity_field(va[idx].V, X_world);
+    }
+
+    // Batch form: velocities of the n world-space points X (a (4, n) SoA block) all
+    // rigidly attached to frame idx, written into out. The frame's world twist is
+    // derived ONCE for the whole block.
+    void point_velocity(vec_cblock3dp X_world, size_t idx, vec_block3dp out)
+    {
+        velocity_field(twist_world(idx), X_world, out);
+    }
+
     vec3dp point_velocity(vec3dp const& X_world, std::string const& frame_name)
     {
         return point_velocity(X_world, index_of(frame_name));
@@ -830,6 +1286,20 @@ class kinematic_system3dp : public static_system3dp {
         return accel_field(va.V, va.A, X_world);
     }
 
+    // same, read from a buffer filled by world_VA_all (no propagation per query)
+    static vec3dp point_acceleration(vec3dp const& X_world, size_t idx,
+                                     std::span<world_va3dp const> va)
+    {
+        return accel_field(va[idx].V, va[idx].A, X_world);
+    }
+
+    // Batch form (see the batch point_velocity): one world_VA(idx) for the whole block.
+    void point_acceleration(vec_cblock3dp X_world, size_t idx, vec_block3dp out)
+    {
+        auto const va = world_VA(idx);
+        accel_field(va.V, va.A, X_world, out);
+    }
+
     vec3dp point_acceleration(vec3dp const& X_world, std::string const& frame_name)
     {
         return point_acceleration(X_world, index_of(frame_name));
@@ -837,6 +1307,27 @@ class kinematic_system3dp : public static_system3dp {
 
   private:
 
+    // shape and overlap check shared by the block field kernels: they write one output
+    // row per loop and read all input rows in each loop, so out must not share storage
+    // with X (in place, a later loop would read the rows an earlier one overwrote)
+    static void check_blocks(char const* fn, vec_cblock3dp X, vec_block3dp out)
+    {
+        if (X.extent(0) != 4 || out.extent(0) != 4 || X.extent(1) != out.extent(1)) {
+            throw std::invalid_argument(
+                std::string(fn) +
+                std::string(": expected two (4, n) point blocks of equal n"));
+        }
+        value_t const* xb = X.data_handle();
+        value_t const* xe = xb + X.extent(0) * X.extent(1);
+        value_t const* ob = out.data_handle();
+        value_t const* oe = ob + out.extent(0) * out.extent(1);
+        if (std::less<>{}(ob, xe) && std::less<>{}(xb, oe)) {
+            throw std::invalid_argument(
+                std::string(fn) +
+                std::string(": point blocks X and out must not overlap"));
+        }
+    }
+
     // World velocity & acceleration twists of frame idx, propagated root -> idx by the
     // recursive Newton-Euler relations (twists transported to world by the adjoint
     // move3dp):
@@ -847,31 +1338,18 @@ class kinematic_system3dp : public static_system3dp {
     // The se(3) twist Lie bracket [.,.] is the regressive commutator
     // rcmt(BiVec3dp,BiVec3dp) (the 3D twin of the se(2) bracket, which is exactly rcmt of
     // the vec2dp twists).
-    struct world_va3dp {
-        twist3dp V; // velocity twist
-        twist3dp A; // acceleration twist
-    };
-
+    //
+    // Recursion root -> idx (depth = tree depth): no path buffer is built, so the
+    // query stays allocation-free inside the dynamics hot path.
     world_va3dp world_VA(size_t idx)
     {
-        std::vector<size_t> path; // root -> idx
-        for (size_t n = idx;; n = parent(n)) {
-            path.push_back(n);
-            if (parent(n) == n) break; // reached the root (self-parent)
-        }
-        std::reverse(path.begin(), path.end());
-
-        twist3dp V{};
-        twist3dp A{};
-        for (size_t n : path) {
-            if (parent(n) == n) continue; // root contributes nothing
-            auto const M = get_pos_trafo(n, 0);
-            auto const zeta = move3dp(rel_vtwist[n], M);    // Ad(xi_n)     world rel. vel
-            auto const zetadot = move3dp(rel_atwist[n], M); // Ad(xidot_n)  world rel. acc
-            V = V + zeta;
-            A = A + zetadot +
-                rcmt(V, zeta); // rcmt = the se(3) twist Lie bracket [V, zeta]
-        }
+        if (parent(idx) == idx) return {}; // root contributes nothing
+        auto [V, A] = world_VA(parent(idx));
+        auto const M = get_pos_trafo(idx, 0);
+        auto const zeta = move3dp(rel_vtwist[idx], M);    // Ad(xi_n)     world rel. vel
+        auto const zetadot = move3dp(rel_atwist[idx], M); // Ad(xidot_n)  world rel. acc
+        V = V + zeta;
+        A = A + zetadot + rcmt(V, zeta); // rcmt = the se(3) twist Lie bracket [V, zeta]
         return {V, A};
     }
 };
@@ -892,27 +1370,42 @@ class kinematic_system3dp : public static_system3dp {
 /////////////////////////////////////////////////////////////////////////////////////////
 
 // Rigid-body inertial properties of a frame (body frame, about the body origin = cm).
+// Ip is the optional structured form of the same map (see PrincipalInertia3dp): when
+// set, the free-body integration uses it instead of the dense I / I_inv. Whoever edits
+// I / I_inv by hand must update or reset Ip as well.
 struct body3dp {
     Inertia3dp<value_t> I;     // inertia map: body twist -> body momentum
     Inertia3dp<value_t> I_inv; // its inverse (cached)
     value_t mass{0.0};         // total mass (gravity + energy)
+    std::optional<PrincipalInertia3dp<value_t>> Ip{}; // structured I (fast path)
 };
 
+// Build a body3dp from a structured inertia map (principal moments about the cm + the
+// optional cm offset; see get_principal_inertia for the checks).
+inline body3dp make_principal_body(value_t m, value_t Jxx, value_t Jyy, value_t Jzz,
+                                   vec3dp const& cm = O_3dp)
+{
+    auto const Ip = get_principal_inertia(m, Jxx, Jyy, Jzz, cm);
+    auto const I = Ip.dense();
+    return body3dp{I, get_inertia_inverse(I), m, Ip};
+}
+
 // Build a body3dp for a uniform cuboid (extents w,h,d along e1,e2,e3) of total mass m,
 // with the body origin at the centre of mass.
 inline body3dp make_cuboid_body(value_t m, value_t w, value_t h, value_t d)
 {
-    auto const I =
-        get_cuboid_inertia(m, w, h, d); // about cm (default pivot = body origin)
-    return body3dp{I, get_inertia_inverse(I), m};
+    // same moments as get_cuboid_inertia(m, w, h, d) (about cm, pivot = body origin)
+    return make_principal_body(m, m * (h * h + d * d) / 12.0, m * (w * w + d * d) / 12.0,
+                               m * (w * w + h * h) / 12.0);
 }
 
 // Build a body3dp for a uniform disc/cylinder of radius r and thickness/height t
 // (symmetry/spin axis along e3) of total mass m, body origin at the centre.
 inline body3dp make_disc_body(value_t m, value_t r, value_t t)
 {
-    auto const I = get_disc_inertia(m, r, t); // about cm (default pivot = body origin)
-    return body3dp{I, get_inertia_inverse(I), m};
+    // same moments as get_disc_inertia(m, r, t) (about cm, pivot = body origin)
+    value_t const I_trans = m * (r * r / 4.0 + t * t / 12.0);
+    return make_principal_body(m, I_trans, I_trans, m * r * r / 2.0);
 }
 
 // Joint type connecting a body to its parent (the reduced-coordinate degrees of freedom).
@@ -975,13 +1468,23 @@ struct grounded_spring3dp {
     value_t c{0.0};               // linear (isotropic) damping on the point velocity
 };
 
-// Time-integration scheme selectable on dynamic_system3dp (see set_integrator):
-//   rk4  -- canonical 4th-order Runge-Kutta (default), 4 rhs evals/step
-//   abm2 -- Adams-Bashforth-Moulton 2nd-order predictor-corrector, 2 rhs evals/step
-// (both from ga/ga_usr_utilities.hpp). RK4 is the robust default; ABM2 trades order for
-// fewer evaluations. Both are EXPLICIT -- neither is an implicit/stiff solver, so on a
-// genuinely stiff system the step is bounded by stability, not accuracy.
-enum class integrator_kind { rk4, abm2 };
+// Tabulated applied wrench (world frame) over time: samples of a bivec3dp interpolated
+// linearly or by a natural cubic spline (see tabulated_profile in ga_usr_utilities.hpp).
+// The built-in, callback-free form of dynamic_system3dp::set_applied_wrench.
+using wrench_profile3dp = tabulated_profile<bivec3dp>;
+
+// (integrator_kind, the time-integration selector of set_integrator, lives with the
+// integrators in ga/ga_usr_utilities.hpp -- it is shared with dynamic_system2dp.)
+
+// Forward-dynamics algorithm selectable on dynamic_system3dp (see set_forward_dynamics):
+//   dense -- assemble the joint-space mass matrix M(q) (composite-rigid-body algorithm)
+//            + RHS (assemble_mass_bias) and solve by the tree-sparse LTDL factorization:
+//            O(n d^2) for tree depth d, i.e. O(n^3) for a serial chain (default)
+//   aba   -- Featherstone's articulated-body algorithm: three sweeps over the frame tree,
+//            O(n) per rhs evaluation, the same joint accelerations as the dense path
+// Long serial chains (cables, tethers of many links) want aba; the dense path stays the
+// default because mass_matrix() and the closed-loop layer are built on its assembly.
+enum class fd_method3dp { dense, aba };
 
 class dynamic_system3dp : public kinematic_system3dp {
 
@@ -997,19 +1500,35 @@ class dynamic_system3dp : public kinematic_system3dp {
     // wrenches into the force assembly, evaluated at each RK4 sub-step. Each
     // returned (frame_idx, wrench) pair is folded onto that frame's supporting
     // joints exactly like an applied wrench (same spatial_dot(S_j, W) pairing).
+    // A pair on a FREE body's frame acts on that body directly (evaluated once per
+    // step, see gather_free_body_wrenches). Several pairs may name the same frame.
     // The generic base contributes none; a subclass overrides this to add its
-    // own force elements without the base knowing anything about them.
+    // own force elements without the base knowing anything about them (e.g.
+    // contact_system3dp in ga_pga3dp_ops_contact.hpp).
     virtual std::vector<std::pair<size_t, bivec3dp>> extra_wrenches() { return {}; }
 
+    // Allocation-free form of the same seam: append the pairs to out (cleared by the
+    // caller, a reused workspace buffer, so its capacity carries over from stage to
+    // stage). This is the form the base calls; the default forwards to the returning
+    // extra_wrenches() above, so existing subclasses keep working unchanged.
+    virtual void append_extra_wrenches(std::vector<std::pair<size_t, bivec3dp>>& out)
+    {
+        auto const w = extra_wrenches();
+        out.insert(out.end(), w.begin(), w.end());
+    }
+
   private:
 
 
     // The optional closed-loop layer (ga_pga3dp_ops_constraints.hpp) composes a
     // dynamic_system3dp as its spanning tree and reuses this class's private assembly
-    // seam (assemble_mass_bias, the joint screws, dof_joints/is_ancestor,
+    // seam (assemble_mass_bias, the joint screws, dof_joints,
     // apply_joint_state) to build the loop-closure constraint Jacobian and the
     // constrained dynamics on top -- without those internals becoming public API.
     friend class closed_loop_system3dp;
+    friend class ensemble3dp; // per-instance joint / body state (ensemble layer)
+    template <size_t N, size_t... Parents>
+    friend class fixed_dynamic_system3dp; // copies the model (fixed-topology layer)
 
     std::vector<body3dp> body;         // per-frame inertial properties (index = frame)
     std::vector<joint_state3dp> joint; // per-frame joint state (index = frame)
@@ -1017,17 +1536,27 @@ class dynamic_system3dp : public kinematic_system3dp {
     vec3dp grav{0.0, -9.81, 0.0, 0.0};
 
     // Optional time-varying applied wrench per frame (world frame), folded into tau as an
-    // external generalised force. Sparse map (frame index -> wrench function of time); a
-    // frame without an entry has no applied wrench. The simulation clock `time_` is the
-    // argument passed at each RK4 sub-step (set transiently by coupled_step). Only the
-    // jointed (assemble_mass_bias) path consumes it; free bodies see gravity only.
+    // external generalised force. Flat registry sorted by frame (frame index -> wrench of
+    // time); a frame without an entry has no applied wrench. The simulation clock `time_`
+    // is the argument passed at each RK4 sub-step (set transiently by coupled_step). Only
+    // the jointed (assemble_mass_bias) path consumes it; free bodies see gravity only.
+    //
+    // The wrench is either a built-in tabulated profile (wrench_profile3dp, evaluated
+    // in place) or -- opt-in, for anything a table can't express -- a type-erased
+    // callback. The registry is walked once per integrator stage, so with hundreds of
+    // loaded frames the contiguous entries and the direct profile call matter.
     using wrench_fn = std::function<bivec3dp(value_t)>;
-    std::unordered_map<size_t, wrench_fn> wrench_;
+    struct applied_wrench {
+        wrench_profile3dp profile; // used unless fn is set
+        wrench_fn fn;
+        bivec3dp operator()(value_t t) const { return fn ? fn(t) : profile(t); }
+    };
+    frame_registry<applied_wrench> wrench_;
     value_t time_{0.0}; // simulation clock [s], advanced by step()
 
     // Optional KINEMATICALLY DRIVEN joints: a 1-DOF joint whose coordinate is PRESCRIBED
     // q(t) = q0 + rate*t (constant rate) rather than integrated from the dynamics -- a
-    // motor-driven spin or a steady feed. A joint is "driven" iff it appears in this map
+    // motor-driven spin or a steady feed. A joint is "driven" iff it has an entry here
     // (it keeps its revolute/prismatic screw machinery, but is excluded from dof_joints
     // and instead re-evaluated from q(t) at each sub-step). The driven motion is a moving
     // base for the dynamic sub-chain below it: its velocity (omega*screw) propagates into
@@ -1038,24 +1567,42 @@ class dynamic_system3dp : public kinematic_system3dp {
         value_t rate{0.0}; // prescribed q-dot
         value_t q0{0.0};   // q at t = 0
     };
-    std::unordered_map<size_t, driven_spec> driven_;
+    frame_registry<driven_spec> driven_;
 
     // Optional GROUNDED spatial springs/dampers per frame (a frame may carry several --
     // e.g. two radial springs + an axial spring). Configuration-dependent: their
     // restoring wrench is recomputed from the live pose/velocity at each RK4 sub-step, so
     // it is folded into assemble_mass_bias (the q-ddot-dependent path) like an applied
     // wrench, NOT prescribed as a function of time. See grounded_spring3dp.
-    std::unordered_map<size_t, std::vector<grounded_spring3dp>> springs_;
+    // One flat registry entry per spring, sorted by frame.
+    frame_registry<grounded_spring3dp> springs_;
 
     // Selectable time integrator for the coupled joint chain (coupled_step). RK4
     // (default, the canonical mdspan rk4_step) or ABM2 (Adams-Bashforth-Moulton 2nd-order
     // multistep). ABM2 is a MULTISTEP method, so its history (the previous derivative)
     // persists across step() calls in `abm_`, lazily sized to the dof count and reset on
     // a switch / dof change. Both share one rhs evaluation (forward dynamics), so RK4
-    // stays byte-identical to the hand-rolled loop and ABM2 is a drop-in alternative. See
-    // set_integrator.
+    // stays byte-identical to the hand-rolled loop and ABM2 is a drop-in alternative.
+    // DP54 (Dormand-Prince 5(4)) covers each step(dt) with error-controlled sub-steps;
+    // its step-size suggestion dp_dt_ carries over between step() calls. The implicit
+    // SDIRK3 (stiff springs) keeps its Jacobian + LU in `sd_` across calls. See
+    // set_integrator / set_tolerances.
     integrator_kind integ_{integrator_kind::rk4};
     std::optional<abm2_integrator> abm_;
+    std::optional<dp54_integrator> dp_;
+    std::optional<sdirk3_integrator> sd_;
+    value_t atol_{1.0e-9}, rtol_{1.0e-7}; // DP54 error / SDIRK3 Newton tolerances
+    value_t dp_dt_{0.0};                        // DP54 suggested sub-step (0: none yet)
+
+    // Selectable forward-dynamics algorithm (dense LU or articulated-body, see
+    // fd_method3dp). Only forward_dynamics() dispatches on it; the dense assembly seam
+    // used by mass_matrix() and the closed-loop layer is unaffected.
+    fd_method3dp fd_{fd_method3dp::dense};
+
+    // Worker threads for the free bodies in step() (1: serial, 0: one per hardware
+    // thread; see set_free_body_threads), and the persistent pool that runs them.
+    size_t fb_threads_{1};
+    ga::detail::worker_pool fb_pool_;
 
   public:
 
@@ -1121,12 +1668,25 @@ class dynamic_system3dp : public kinematic_system3dp {
     // as an external generalised force projected onto each supporting joint screw. The
     // wrench is a bivec3dp (force/torque line); for a pure force F through a point P use
     // wdg(P, F). Evaluated at each RK4 sub-step time. Pass an empty function to clear.
+    // Replaces any wrench (callback or profile) already attached to the frame.
     void set_applied_wrench(size_t idx, wrench_fn fn)
     {
-        if (fn) wrench_[idx] = std::move(fn);
+        if (fn) wrench_.assign(idx, applied_wrench{{}, std::move(fn)});
         else wrench_.erase(idx);
     }
 
+    // Attach a tabulated applied wrench (world frame): samples interpolated linearly or
+    // by a natural cubic spline, held constant outside the table. The built-in,
+    // allocation- and callback-free form of the above, e.g.
+    //
+    //     sys.set_applied_wrench(i, wrench_profile3dp(t, W, profile_interp::cubic));
+    void set_applied_wrench(size_t idx, wrench_profile3dp profile)
+    {
+        wrench_.assign(idx, applied_wrench{std::move(profile), {}});
+    }
+
+    void clear_applied_wrench(size_t idx) { wrench_.erase(idx); }
+
     value_t time() const { return time_; }  // simulation clock [s]
     void set_time(value_t t) { time_ = t; } // reset / seed the clock
 
@@ -1136,12 +1696,12 @@ class dynamic_system3dp : public kinematic_system3dp {
     // for the dynamic sub-chain below it. Use for a motor-driven spin or a steady feed.
     void set_driven_rate(size_t idx, value_t rate, value_t q0 = 0.0)
     {
-        driven_[idx] = driven_spec{rate, q0};
+        driven_.assign(idx, driven_spec{rate, q0});
         apply_driven_joints(); // seed the joint state at the current clock
     }
 
     void clear_driven_joint(size_t idx) { driven_.erase(idx); }
-    bool is_driven(size_t idx) const { return driven_.count(idx) != 0; }
+    bool is_driven(size_t idx) const { return driven_.contains(idx); }
 
     // read-only access to a body's inertial properties
     body3dp const& body_props(size_t idx) const { return body[idx]; }
@@ -1171,27 +1731,66 @@ class dynamic_system3dp : public kinematic_system3dp {
                              value_t c = 0.0)
     {
         vec3dp const p0 = unitize(move3dp(anchor_b, get_pos_trafo(idx, 0)));
-        springs_[idx].push_back(grounded_spring3dp{anchor_b, p0, k, c});
+        springs_.append(idx, grounded_spring3dp{anchor_b, p0, k, c});
     }
 
     void add_grounded_spring(size_t idx, vec3dp const& anchor_b, vec3dp const& p0_world,
                              vec3dp const& k, value_t c)
     {
-        springs_[idx].push_back(grounded_spring3dp{anchor_b, p0_world, k, c});
+        springs_.append(idx, grounded_spring3dp{anchor_b, p0_world, k, c});
     }
 
-    // Select the time integrator for the coupled joint chain. RK4 (default) or ABM2
-    // (Adams-Bashforth-Moulton 2nd-order). Switching resets the ABM2 multistep history so
+    // Select the time integrator for the coupled joint chain. RK4 (default), ABM2
+    // (Adams-Bashforth-Moulton 2nd-order), DP54 (adaptive Dormand-Prince 5(4)) or SDIRK3
+    // (L-stable implicit, for stiff joint / grounded springs).
+    // Switching resets the ABM2 multistep history and the DP54 step-size suggestion so
     // the next step() self-starts cleanly. RK4 is byte-identical to the previous
-    // hand-rolled loop; ABM2 is a drop-in alternative sharing the same forward-dynamics
-    // rhs.
+    // hand-rolled loop; the others are drop-in alternatives sharing the same
+    // forward-dynamics rhs.
     void set_integrator(integrator_kind k)
     {
         integ_ = k;
         abm_.reset(); // restart the multistep history on any switch
+        dp_dt_ = 0.0;
     }
     integrator_kind get_integrator() const { return integ_; }
 
+    // Absolute / relative per-component tolerances on the joint state [phi, omega]. With
+    // DP54 they drive the error control: step(dt) advances the full dt but takes as many
+    // sub-steps as these tolerances need -- so dt becomes the OUTPUT interval, not an
+    // accuracy knob. With SDIRK3 they are the Newton convergence tolerances.
+    void set_tolerances(value_t atol, value_t rtol)
+    {
+        if (!(atol >= 0.0 && rtol >= 0.0 && atol + rtol > 0.0))
+            throw std::invalid_argument(
+                "set_tolerances: need atol, rtol >= 0, not both 0");
+        atol_ = atol;
+        rtol_ = rtol;
+    }
+
+    // Select the forward-dynamics algorithm for the coupled joint chain: the dense
+    // mass-matrix path (default; CRBA + tree-sparse LTDL, O(n d^2) for tree depth d) or
+    // the O(n) articulated-body algorithm. Both return the same joint accelerations (to
+    // rounding), so this is a pure performance switch -- step(), joint_accel() and
+    // sync_accelerations() all follow it.
+    void set_forward_dynamics(fd_method3dp m) { fd_ = m; }
+    fd_method3dp get_forward_dynamics() const { return fd_; }
+
+    // Number of worker threads that integrate the FREE bodies in step() (1 = serial, the
+    // default; 0 = one per hardware thread). Each free body's RK4 on (B, Omega) depends
+    // only on its own state and gravity, so with n != 1 step() copies the free bodies'
+    // states into one contiguous block (ws_.fb), integrates disjoint chunks of it on
+    // worker threads, and writes the results back serially. The trajectory is
+    // bit-identical to the serial one. The workers are a persistent pool owned by the
+    // system (started by the first such step(), reused after), so a steady-state step()
+    // stays allocation-free in this mode too. Worth it for scenes with many free bodies
+    // (debris, particles); with few of them the hand-off costs more than the RK4. An
+    // exception thrown while integrating a free body (e.g. by a user callback) is
+    // rethrown by step() after all workers have stopped; no free body is updated then.
+    // Do not combine with ensemble3dp threads (each instance would run its own pool).
+    void set_free_body_threads(size_t n_threads) { fb_threads_ = n_threads; }
+    size_t get_free_body_threads() const { return fb_threads_; }
+
     void clear_grounded_springs(size_t idx) { springs_.erase(idx); }
 
     // Current acceleration of joint `idx`, from the COUPLED joint-space forward dynamics
@@ -1199,7 +1798,7 @@ class dynamic_system3dp : public kinematic_system3dp {
     value_t joint_accel(size_t idx)
     {
         auto const rj = dof_joints();
-        auto const qdd = forward_dynamics(rj);
+        auto const& qdd = forward_dynamics(rj);
         for (size_t k = 0; k < rj.size(); ++k)
             if (rj[k] == idx) return qdd[k];
         return 0.0;
@@ -1212,22 +1811,35 @@ class dynamic_system3dp : public kinematic_system3dp {
     void sync_accelerations()
     {
         auto const rj = dof_joints();
-        auto const qdd = forward_dynamics(rj); // zeroes rel_atwist internally
+        auto const& qdd = forward_dynamics(rj); // zeroes rel_atwist internally
         for (size_t k = 0; k < rj.size(); ++k)
             set_accel_twist(rj[k], qdd[k] * joint[rj[k]].screw_b);
     }
 
     // Advance the system by dt. The 1-DOF joints form a COUPLED chain integrated together
     // in their reduced (joint) coordinates via the joint-space forward dynamics; free
-    // bodies are integrated independently. RK4 throughout.
+    // bodies are integrated independently. The chain uses the selected integrator (see
+    // set_integrator); free bodies always use RK4.
+    //
+    // All scratch lives in the persistent workspace ws_ (and the integrators rk4_ /
+    // abm_ / dp_), so once it is sized by the first step a steady-state step()
+    // performs NO heap allocation (as long as user-supplied callbacks -- applied wrench
+    // functions, append_extra_wrenches() overrides -- do not allocate themselves; a
+    // subclass overriding only the vector-returning extra_wrenches() allocates that
+    // vector).
     void step(value_t dt)
     {
-        auto const rj = dof_joints();
+        gather_free_body_wrenches(); // at the state of time t, before the joints move
+        collect_dof_joints(ws_.rj);
+        auto const& rj = ws_.rj;
         if (!rj.empty())
             coupled_step(rj, dt); // uses time_ for sub-step wrench/drive eval
-        for (size_t i = 1; i < size(); ++i)
-            if (joint[i].type == joint3dp::free && body[i].mass > 0.0)
-                step_free_body(i, dt);
+        if (fb_threads_ == 1) {
+            for (size_t i = 1; i < size(); ++i)
+                if (is_free_body(i)) step_free_body(i, dt);
+        }
+        else
+            step_free_bodies_parallel(dt);
         time_ += dt;           // advance the clock (coupled_step restores it to t0)
         apply_driven_joints(); // prescribe the driven joints at t + dt (final state)
     }
@@ -1262,14 +1874,10 @@ class dynamic_system3dp : public kinematic_system3dp {
             pe += 0.5 * joint[i].stiffness * dq * dq;
         }
         // grounded-spring potential 1/2 (k.x dx^2 + k.y dy^2 + k.z dz^2)
-        for (auto const& [fi, sps] : springs_) {
-            auto const M = get_pos_trafo(fi, 0);
-            for (auto const& sp : sps) {
-                vec3dp const P = unitize(move3dp(sp.anchor_b, M));
-                vec3dp const d = P - sp.p0_world;
-                pe +=
-                    0.5 * (sp.k.x * d.x * d.x + sp.k.y * d.y * d.y + sp.k.z * d.z * d.z);
-            }
+        for (auto const& [fi, sp] : springs_) {
+            vec3dp const P = unitize(move3dp(sp.anchor_b, get_pos_trafo(fi, 0)));
+            vec3dp const d = P - sp.p0_world;
+            pe += 0.5 * (sp.k.x * d.x * d.x + sp.k.y * d.y * d.y + sp.k.z * d.z * d.z);
         }
         return pe;
     }
@@ -1289,32 +1897,65 @@ class dynamic_system3dp : public kinematic_system3dp {
     // Joint-space mass matrix M(q) (n*n row-major, n = number of 1-DOF joints) at the
     // current configuration. A diagnostic / showcase quantity: the reduced inertia of the
     // articulated system, with the identity  1/2 * qdot^T M(q) qdot == kinetic_energy().
+    // Built by the composite-rigid-body algorithm (see crba_mass_matrix).
     std::vector<value_t> mass_matrix()
+    {
+        std::vector<value_t> Mmat;
+        crba_mass_matrix(dof_joints(), false, Mmat);
+        return Mmat;
+    }
+
+    // Inverse dynamics by the recursive Newton-Euler algorithm (RNEA): the generalised
+    // forces tau (one per dof joint, in dof_joints() order) that must be applied AT THE
+    // JOINTS, on top of all force elements already present (gravity, joint springs /
+    // dampers, applied wrenches, grounded springs, extra_wrenches()), so that the system
+    // moves with joint accelerations qdd at the current state (q, q-dot):
+    //
+    //   tau = M(q) qdd - RHS(q, q-dot)       (M, RHS as in assemble_mass_bias)
+    //
+    // Two O(n) sweeps in the world frame instead of the O(n^3) dense route:
+    //
+    //   root -> leaves: a_i = a_parent + c_i + S_i qdd_i     (outward_sweep: V, c, p)
+    //                   f_i = I_i(a_i) + p_i                 (body wrench, world)
+    //   leaves -> root: F_i = f_i + sum_children F_child,  tau_i = <S_i, F_i> - tau_k,c
+    //
+    // where tau_k,c is the joint's own spring/damper force. Hence inverse_dynamics of
+    // the forward-dynamics accelerations is zero, and inverse_dynamics(e_k) -
+    // inverse_dynamics(0) is column k of mass_matrix(). Does not modify the state.
+    std::vector<value_t> inverse_dynamics(std::vector<value_t> const& qdd)
     {
         auto const rj = dof_joints();
-        size_t const n = rj.size();
-        std::vector<twist3dp> S(n); // world joint screws (unit rate)
-        std::vector<mvec3dp_e> Minv(
-            n); // world -> body i motor (pulls a twist into body i)
-        for (size_t i = 0; i < n; ++i) {
-            auto const M = get_pos_trafo(rj[i], 0); // body i -> world
-            S[i] = move3dp(joint[rj[i]].screw_b, M);
-            Minv[i] = rrev(M);
+        if (qdd.size() != rj.size()) {
+            throw std::runtime_error(
+                std::string("dynamic_system3dp: inverse_dynamics expects one joint "
+                            "acceleration per dof joint (") +
+                std::to_string(rj.size()) + std::string("), but qdd.size() == ") +
+                std::to_string(qdd.size()));
         }
-        std::vector<value_t> Mmat(n * n, 0.0);
-        for (size_t i = 0; i < n; ++i) {
-            auto const& I = body[rj[i]].I; // inertia map about body i's cm (body frame)
-            for (size_t j = 0; j < n; ++j) {
-                if (!is_ancestor(rj[j], rj[i])) continue;
-                twist3dp const xj = move3dp(S[j], Minv[i]); // joint-j screw in body i
-                for (size_t k = 0; k < n; ++k) {
-                    if (!is_ancestor(rj[k], rj[i])) continue;
-                    twist3dp const xk = move3dp(S[k], Minv[i]);
-                    Mmat[j * n + k] += spatial_dot(xj, I(xk));
-                }
+        size_t const nf = size();
+        auto& ts = outward_sweep(rj);
+        auto& F = ts.p; // bias wrench -> body wrench -> subtree wrench (in place)
+
+        // root -> leaves: world accelerations and the body wrenches they require
+        std::vector<twist3dp> A(nf);
+        for (size_t i = 1; i < nf; ++i) {
+            A[i] = A[parent(i)] + ts.c[i];
+            if (ts.slot[i] != no_dof) A[i] = A[i] + qdd[ts.slot[i]] * ts.S[i];
+            if (ts.loaded[i]) {
+                auto const& M = ts.M[i];
+                F[i] = F[i] + move3dp(body[i].I(move3dp(A[i], rrev(M))), M);
             }
         }
-        return Mmat;
+
+        // leaves -> root: subtree wrenches, projected onto the joint screws
+        std::vector<value_t> tau(rj.size(), 0.0);
+        for (size_t i = nf; i-- > 1;) {
+            if (ts.slot[i] != no_dof) {
+                tau[ts.slot[i]] = spatial_dot(ts.S[i], F[i]) - joint_spring_force(i);
+            }
+            F[parent(i)] = F[parent(i)] + F[i];
+        }
+        return tau;
     }
 
   private:
@@ -1330,30 +1971,97 @@ class dynamic_system3dp : public kinematic_system3dp {
         return -value_t(rwdg(xi, mom));
     }
 
-    // RK4-integrate one free rigid body (frame idx) over dt under gravity. The
-    // integration state is the Lie-algebra pair (B, Omega): B is the relative generator
-    // accumulated from the current relative pose M0 (so M(t) = M0 (x) rexp(1/2 B)), Omega
-    // the body twist. dB/dt = Omega; dOmega/dt = I^-1[ W_body - rcmt(Omega, I(Omega)) ].
-    // For a torque-free body (grav = 0) this reduces to the pure se(3) Euler equation
+    // RK4-integrate one free rigid body (frame idx) over dt under gravity (plus its
+    // extra wrench, see gather_free_body_wrenches). The integration state is the
+    // Lie-algebra pair (B, Omega): B is the relative generator accumulated from the
+    // current relative pose M0 (so M(t) = M0 (x) rexp(1/2 B)), Omega the body twist.
+    // dB/dt = Omega; dOmega/dt = I^-1[ W_body - rcmt(Omega, I(Omega)) ]. For a
+    // torque-free body (grav = 0) this reduces to the pure se(3) Euler equation
     // (Poinsot / Dzhanibekov).
     void step_free_body(size_t idx, value_t dt)
     {
-        auto const M0 = rrev(step_pos_trafo(idx)); // current body -> parent motor
-        auto const& I = body[idx].I;
-        auto const& I_inv = body[idx].I_inv;
-        value_t const m = body[idx].mass;
+        free_body_state3dp st{idx, frame(idx).get_pose(), relative_twist(idx),
+                              free_body_wrench(idx)};
+        integrate_free_body(st, dt);
+        set_pose(idx, st.pose);
+        set_twist(idx, st.Om);
+    }
+
+    // State of one free body as integrated by integrate_free_body: frame index, relative
+    // pose and body twist (in: at t, out: at t + dt), plus the external wrench held over
+    // the step (parent frame; see gather_free_body_wrenches).
+    struct free_body_state3dp {
+        size_t idx;
+        pose3dp pose;
+        twist3dp Om;
+        bivec3dp W_ext{};
+    };
+
+    // Extra wrenches (extra_wrenches()) acting on FREE bodies. The jointed path folds
+    // them in at every RK4 sub-step; a free body is integrated on its own, so its share
+    // is evaluated once at the start of the step and held over it (first-order
+    // splitting, the usual treatment of penalty contact in a per-body integrator).
+    // Stored per frame in ws_.fw, pulled into the parent frame the free body's pose
+    // lives in; ws_.fw stays empty if there is none (and extra_wrenches() is not even
+    // called without free bodies).
+    void gather_free_body_wrenches()
+    {
+        auto& fw = ws_.fw;
+        fw.clear();
+        bool any_free = false;
+        for (size_t i = 1; i < size() && !any_free; ++i)
+            any_free = is_free_body(i);
+        if (!any_free) return;
+        for (auto const& [fi, W] : collect_extra_wrenches()) {
+            if (!is_free_body(fi)) continue;
+            if (fw.empty()) fw.assign(size(), bivec3dp{});
+            fw[fi] = fw[fi] + move3dp(W, rrev(get_pos_trafo(parent(fi), 0)));
+        }
+    }
+
+    // the pairs of the append_extra_wrenches() seam for the current state, gathered
+    // into the reused workspace buffer (valid until the next call)
+    std::vector<std::pair<size_t, bivec3dp>> const& collect_extra_wrenches()
+    {
+        ws_.xw.clear();
+        append_extra_wrenches(ws_.xw);
+        return ws_.xw;
+    }
+
+    // a free joint carrying mass: integrated on its own (step_free_body), outside the
+    // joint-space dynamics. A free joint transmits no force to its parent, so wrenches
+    // on such a frame must not be projected onto its jointed ancestors.
+    bool is_free_body(size_t idx) const
+    {
+        return joint[idx].type == joint3dp::free && body[idx].mass > 0.0;
+    }
+
+    bivec3dp free_body_wrench(size_t idx) const
+    {
+        return ws_.fw.empty() ? bivec3dp{} : ws_.fw[idx];
+    }
+
+    // The RK4 of step_free_body on a detached state: reads only st, body[st.idx] and
+    // grav and writes only st, so disjoint states may be integrated concurrently.
+    void integrate_free_body(free_body_state3dp& st, value_t dt) const
+    {
+        auto const M0 = motor_from_pose3dp(st.pose); // current body -> parent motor
+        auto const& b = body[st.idx];
+        value_t const m = b.mass;
 
-        // body-frame twist rate from the gravity wrench acting at the cm (= body origin)
+        // body-frame twist rate from the gravity wrench acting at the cm (= body origin);
+        // through the structured inertia map when the body has one (see body3dp::Ip)
         auto omega_dot = [&](twist3dp const& B, twist3dp const& Om) -> twist3dp {
             auto const M = rgpr(M0, rexp(0.5 * B));            // pose at this stage
             auto const W_w = wdg(move3dp(O_3dp, M), m * grav); // gravity wrench (world)
-            auto const W_b = move3dp(W_w, rrev(M)); // pulled into the body frame
-            return compute_omega_dot(I_inv, W_b, Om, I);
+            auto const W_b = move3dp(W_w + st.W_ext, rrev(M)); // into the body frame
+            if (b.Ip) return compute_omega_dot(*b.Ip, W_b, Om);
+            return compute_omega_dot(b.I_inv, W_b, Om, b.I);
         };
 
         // RK4 (shared rk4_step) on the Lie-algebra pair u = (B, Omega): dB/dt = Omega,
         // dOmega/dt = omega_dot(B, Omega). B starts at 0 (M(t) = M0 (x) rexp(1/2 B)).
-        std::array<twist3dp, 2> u_mem{twist3dp{}, relative_twist(idx)};
+        std::array<twist3dp, 2> u_mem{twist3dp{}, st.Om};
         std::array<twist3dp, 4> uh_mem{};
         std::array<twist3dp, 2> rhs_mem{};
         auto u = std::mdspan<twist3dp, std::dextents<size_t, 1>>(u_mem.data(), 2);
@@ -1366,10 +2074,56 @@ class dynamic_system3dp : public kinematic_system3dp {
             rk4_step(u, uh, rhs, dt, s);
         }
 
-        // decode the evolved pose (motor -> pose3dp via the constrained motor log) and
-        // write pose + twist back into the base layers
-        set_pose(idx, pose3dp_from_motor(rgpr(M0, rexp(0.5 * u[0]))));
-        set_twist(idx, u[1]);
+        // decode the evolved pose (motor -> pose3dp via the constrained motor log)
+        st.pose = pose3dp_from_motor(rgpr(M0, rexp(0.5 * u[0])));
+        st.Om = u[1];
+    }
+
+    // Parallel branch of step() (see set_free_body_threads): gather the free-body states
+    // into the contiguous block ws_.fb, integrate chunks of it on the pool's workers
+    // (claimed from a shared atomic counter, as in ensemble3dp), then scatter the results
+    // back serially -- set_pose() touches the shared forward-kinematics cache and the
+    // segment tree, so it must not run on the workers. An exception thrown by a worker
+    // stops the others and is rethrown here (no free body is updated then).
+    void step_free_bodies_parallel(value_t dt)
+    {
+        auto& fb = ws_.fb;
+        fb.clear();
+        for (size_t i = 1; i < size(); ++i)
+            if (is_free_body(i))
+                fb.push_back(
+                    {i, frame(i).get_pose(), relative_twist(i), free_body_wrench(i)});
+        size_t const n = fb.size();
+
+        size_t n_threads = fb_threads_;
+        if (n_threads == 0)
+            n_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        size_t constexpr chunk = 32; // free bodies per claim
+        n_threads = std::min(n_threads, (n + chunk - 1) / chunk);
+
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        // a single chunk runs on the calling thread (run(1, ...) involves no worker)
+        fb_pool_.run(std::max<size_t>(n_threads, 1), [&](size_t) {
+            try {
+                for (;;) {
+                    size_t const begin = next.fetch_add(chunk);
+                    if (begin >= n || failed.load()) break;
+                    size_t const end = std::min(n, begin + chunk);
+                    for (size_t k = begin; k < end; ++k)
+                        integrate_free_body(fb[k], dt);
+                }
+            }
+            catch (...) {
+                failed.store(true);
+                throw; // rethrown by run()
+            }
+        });
+
+        for (auto const& st : fb) {
+            set_pose(st.idx, st.pose);
+            set_twist(st.idx, st.Om);
+        }
     }
 
     // shared constructor for the 1-DOF screw joints (revolute / prismatic): the ONLY
@@ -1429,21 +2183,19 @@ class dynamic_system3dp : public kinematic_system3dp {
     std::vector<size_t> dof_joints() const
     {
         std::vector<size_t> rj;
-        for (size_t i = 1; i < size(); ++i)
-            if ((joint[i].type == joint3dp::revolute ||
-                 joint[i].type == joint3dp::prismatic) &&
-                driven_.count(i) == 0)
-                rj.push_back(i);
+        collect_dof_joints(rj);
         return rj;
     }
 
-    // Is joint frame `jf` on the path from body `bf` up to the root (inclusive)?
-    bool is_ancestor(size_t jf, size_t bf) const
+    // dof_joints() into an existing buffer (no allocation once its capacity suffices)
+    void collect_dof_joints(std::vector<size_t>& rj) const
     {
-        for (size_t n = bf;; n = parent(n)) {
-            if (n == jf) return true;
-            if (parent(n) == n) return false; // reached the root
-        }
+        rj.clear();
+        for (size_t i = 1; i < size(); ++i)
+            if ((joint[i].type == joint3dp::revolute ||
+                 joint[i].type == joint3dp::prismatic) &&
+                !driven_.contains(i))
+                rj.push_back(i);
     }
 
     // Assemble the joint-space mass matrix M(q) and the generalised-force RHS for the
@@ -1451,6 +2203,7 @@ class dynamic_system3dp : public kinematic_system3dp {
     // SPATIAL (screw) form:
     //
     //   M[j][k] = sum_i  spatial_dot( S_j^body_i , I_i( S_k^body_i ) )      (mass matrix)
+    //             (evaluated by crba_mass_matrix as <S_j, Ic_k(S_k)>, the same sum)
     //   RHS[j]  = sum_i [ m_i vcm_i(S_j).g  -  spatial_dot( S_j^body_i, F_bias_i ) ]
     //
     // over bodies i with joint j (and k) as ancestor. S_j = move3dp(screw_j,
@@ -1481,6 +2234,14 @@ class dynamic_system3dp : public kinematic_system3dp {
     // Mmat (n*n, row-major), RHS (n) }.
     std::pair<std::vector<value_t>, std::vector<value_t>>
     assemble_mass_bias(std::vector<size_t> const& rj)
+    {
+        assemble_mass_bias_ws(rj);
+        return {ws_.Mmat, ws_.rhs};
+    }
+
+    // assemble_mass_bias() into the workspace (ws_.Mmat, ws_.rhs): the allocation-free
+    // form used by forward_dynamics() on the stepping hot path.
+    void assemble_mass_bias_ws(std::vector<size_t> const& rj)
     {
         size_t const n = rj.size();
 
@@ -1489,11 +2250,6 @@ class dynamic_system3dp : public kinematic_system3dp {
         for (size_t k = 0; k < n; ++k)
             set_accel_twist(rj[k], twist3dp{});
 
-        // World joint screws of the dof coordinates (the n unknowns).
-        std::vector<twist3dp> S(n);
-        for (size_t j = 0; j < n; ++j)
-            S[j] = move3dp(joint[rj[j]].screw_b, get_pos_trafo(rj[j], 0));
-
         // Inertia-bearing bodies of the articulated chain: the dof joints AND the
         // kinematically DRIVEN joints. A driven joint is a MOVING BASE -- its body
         // inertia still loads its ancestor dof joints (mass matrix) and its prescribed
@@ -1503,21 +2259,23 @@ class dynamic_system3dp : public kinematic_system3dp {
         // inertia below a dof joint, make the mass matrix singular). Its relative
         // acceleration is zero (constant rate, apply_driven_joints), so the bias is pure
         // velocity-product.
-        std::vector<size_t> bl(rj);
+        auto& bl = ws_.bl;
+        bl.assign(rj.begin(), rj.end());
         for (auto const& [idx, d] : driven_)
             bl.push_back(idx);
         size_t const nb = bl.size();
 
-        std::vector<vec3dp> cm(nb);      // body cm in world
-        std::vector<mvec3dp_e> Minv(nb); // world -> body i motor
-        std::vector<twist3dp> Fbias(nb); // body-frame spatial bias wrench
-        std::vector<value_t> mass(nb);
+        auto& cm = ws_.cm;       // body cm in world
+        auto& Minv = ws_.Minv;   // world -> body i motor
+        auto& Fbias = ws_.Fbias; // body-frame spatial bias wrench
+        cm.resize(nb);
+        Minv.resize(nb);
+        Fbias.resize(nb);
         for (size_t i = 0; i < nb; ++i) {
             size_t const fb = bl[i];
             auto const M = get_pos_trafo(fb, 0);
             cm[i] = move3dp(O_3dp, M);
             Minv[i] = rrev(M);
-            mass[i] = body[fb].mass;
             // body-frame velocity / bias-acceleration twists + the spatial bias wrench
             twist3dp const Vb = move3dp(twist_world(fb), Minv[i]);
             twist3dp const Ab = move3dp(accel_twist_world(fb), Minv[i]); // rel_atwist = 0
@@ -1525,20 +2283,21 @@ class dynamic_system3dp : public kinematic_system3dp {
             Fbias[i] = I(Ab) + rcmt(Vb, I(Vb)); // I*A_bias + gyroscopic V x* (I V)
         }
 
-        std::vector<value_t> Mmat(n * n, 0.0), RHS(n, 0.0);
+        // M(q) by the composite-rigid-body algorithm (incl. the driven bodies' inertia);
+        // it also leaves the world joint screws S_j of the n unknowns in ws_.S
+        crba_mass_matrix(rj, true, ws_.Mmat);
+        auto const& S = ws_.S;
+
+        auto& RHS = ws_.rhs;
+        RHS.assign(n, 0.0);
         for (size_t j = 0; j < n; ++j) {
             for (size_t i = 0; i < nb; ++i) { // contribution of body i to coordinate j
                 if (!is_ancestor(rj[j], bl[i])) continue;
                 vec3dp const vj = velocity_field(S[j], cm[i]); // cm velocity, unit rate j
                 twist3dp const xj = move3dp(S[j], Minv[i]);    // joint-j screw in body i
-                RHS[j] += mass[i] * (vj.x * grav.x + vj.y * grav.y + vj.z * grav.z) -
+                value_t const m = body[bl[i]].mass;
+                RHS[j] += m * (vj.x * grav.x + vj.y * grav.y + vj.z * grav.z) -
                           spatial_dot(xj, Fbias[i]);
-                auto const& I = body[bl[i]].I; // inertia about body i's cm (body frame)
-                for (size_t k = 0; k < n; ++k) {
-                    if (!is_ancestor(rj[k], bl[i])) continue;
-                    twist3dp const xk = move3dp(S[k], Minv[i]);
-                    Mmat[j * n + k] += spatial_dot(xj, I(xk));
-                }
             }
         }
 
@@ -1555,9 +2314,8 @@ class dynamic_system3dp : public kinematic_system3dp {
         // spatial_dot(S_j, W) to every joint j that supports fi (j ancestor of fi). The
         // reciprocal pairing is the rate of work of W under unit joint rate -- the same
         // pairing that yields the gravity term. Zero unless a wrench was attached.
-        for (auto const& [fi, fn] : wrench_) {
-            if (!fn) continue;
-            bivec3dp const W = fn(time_);
+        for (auto const& [fi, aw] : wrench_) {
+            bivec3dp const W = aw(time_);
             for (size_t j = 0; j < n; ++j)
                 if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
         }
@@ -1567,52 +2325,371 @@ class dynamic_system3dp : public kinematic_system3dp {
         // anisotropic stiffness + isotropic damping); the force line wdg(P, F) is the
         // wrench, projected onto every supporting joint screw. Recomputed from state here
         // (not a function of time) -- this is the configuration-dependent path.
-        for (auto const& [fi, sps] : springs_) {
-            auto const M = get_pos_trafo(fi, 0);
-            twist3dp const Vw = twist_world(fi); // world velocity twist of frame fi
-            for (auto const& sp : sps) {
-                vec3dp const P = unitize(move3dp(sp.anchor_b, M)); // world point (w = 1)
-                vec3dp const v = velocity_field(Vw, P);            // world point velocity
-                vec3dp const F{-sp.k.x * (P.x - sp.p0_world.x) - sp.c * v.x,
-                               -sp.k.y * (P.y - sp.p0_world.y) - sp.c * v.y,
-                               -sp.k.z * (P.z - sp.p0_world.z) - sp.c * v.z, 0.0};
-                bivec3dp const W = wdg(P, F);
-                for (size_t j = 0; j < n; ++j)
-                    if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
+        size_t fcur = size(); // frame of M / Vw below (none yet)
+        mvec3dp_e M{};
+        twist3dp Vw{};
+        for (auto const& [fi, sp] : springs_) {
+            if (fi != fcur) { // the registry is sorted: one fetch per loaded frame
+                M = get_pos_trafo(fi, 0);
+                Vw = twist_world(fi); // world velocity twist of frame fi
+                fcur = fi;
             }
+            vec3dp const P = unitize(move3dp(sp.anchor_b, M)); // world point (w = 1)
+            vec3dp const v = velocity_field(Vw, P);            // world point velocity
+            vec3dp const F{-sp.k.x * (P.x - sp.p0_world.x) - sp.c * v.x,
+                           -sp.k.y * (P.y - sp.p0_world.y) - sp.c * v.y,
+                           -sp.k.z * (P.z - sp.p0_world.z) - sp.c * v.z, 0.0};
+            bivec3dp const W = wdg(P, F);
+            for (size_t j = 0; j < n; ++j)
+                if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
         }
 
         // application-specific external wrenches contributed by a subclass (e.g. a
         // contact/penalty force model): each (frame, world-wrench) pair is projected onto
         // its frame's supporting joints exactly like the grounded-spring path above.
-        // Empty in the generic base (extra_wrenches() returns nothing).
-        for (auto const& [fi, W] : extra_wrenches()) {
+        // Empty in the generic base (extra_wrenches() returns nothing). Pairs on a free
+        // body act on that body alone (gather_free_body_wrenches).
+        for (auto const& [fi, W] : collect_extra_wrenches()) {
+            if (is_free_body(fi)) continue;
             for (size_t j = 0; j < n; ++j)
                 if (is_ancestor(rj[j], fi)) RHS[j] += spatial_dot(S[j], W);
         }
-        return {std::move(Mmat), std::move(RHS)};
     }
 
     // Joint-space forward dynamics for the chain `rj`: returns the joint accelerations
     // q-ddot solving  M(q) q-ddot = RHS(q, q-dot). Thin wrapper over assemble_mass_bias()
-    // (see there for the assembly and its bias-pass side effect) plus the shared LU
-    // solve.
-    std::vector<value_t> forward_dynamics(std::vector<size_t> const& rj)
+    // (see there for the assembly and its bias-pass side effect) plus the tree-sparse
+    // LTDL solve: M is SPD with the sparsity of the dof tree, so no pivoting is needed
+    // and entries between different branches are never touched. The result lives in the
+    // workspace and stays valid until the next forward-dynamics evaluation.
+    std::vector<value_t> const& forward_dynamics(std::vector<size_t> const& rj)
+    {
+        if (fd_ == fd_method3dp::aba) return forward_dynamics_aba(rj);
+        assemble_mass_bias_ws(rj); // also leaves the dof parents in ws_.lambda
+        hd::ga::ltdl_decomp(ws_.Mmat, ws_.lambda); // shared solver (detail/ga_solver.hpp)
+        hd::ga::ltdl_backsubs(ws_.Mmat, ws_.lambda, ws_.rhs);
+        return ws_.rhs;
+    }
+
+    // Parent structure of the dof tree for the tree-sparse LTDL factorization: for each
+    // coordinate k the slot of the nearest dof joint above rj[k] (driven joints and plain
+    // frames are skipped), or k itself if there is none. rj is in ascending frame order
+    // (dof_joints), so a parent slot is always smaller than its child's. Written into
+    // ws_.lambda.
+    void dof_parents(std::vector<size_t> const& rj)
+    {
+        size_t const nf = size();
+        auto& nearest = ws_.nearest; // nearest dof slot at or above a frame
+        nearest.assign(nf, no_dof);
+        for (size_t k = 0; k < rj.size(); ++k)
+            nearest[rj[k]] = k;
+        for (size_t i = 1; i < nf; ++i)
+            if (nearest[i] == no_dof) nearest[i] = nearest[parent(i)];
+        auto& lambda = ws_.lambda;
+        lambda.resize(rj.size());
+        for (size_t k = 0; k < rj.size(); ++k) {
+            size_t const up = nearest[parent(rj[k])];
+            lambda[k] = (up == no_dof) ? k : up;
+        }
+    }
+
+    // Joint-space mass matrix of the chain `rj` by the composite-rigid-body algorithm
+    // (CRBA), in the world frame: one leaves -> root sweep accumulates the composite
+    // inertia Ic_i of each subtree (world-frame body inertias summed with +=), then
+    //
+    //   M[k][j] = M[j][k] = <S_j, Ic_k(S_k)>   for j == k or j a dof ancestor of k
+    //
+    // by walking up the dof tree from each k (all other entries are zero -- the joints
+    // lie on different branches). O(n d) instead of the O(n^2 nb) triple loop. The
+    // inertia-bearing bodies are the dof joints, plus the driven joints if with_driven
+    // (as in assemble_mass_bias; mass_matrix() reports the dof bodies only). Written
+    // into Mmat (n*n, row-major); leaves the world joint screws in ws_.S and the dof
+    // parents in ws_.lambda for the caller to reuse.
+    void crba_mass_matrix(std::vector<size_t> const& rj, bool with_driven,
+                          std::vector<value_t>& Mmat)
+    {
+        size_t const n = rj.size();
+        size_t const nf = size();
+        auto& loaded = ws_.loaded;
+        loaded.assign(nf, 0);
+        for (size_t k = 0; k < n; ++k)
+            loaded[rj[k]] = 1;
+        if (with_driven) {
+            for (auto const& [idx, d] : driven_)
+                loaded[idx] = 1;
+        }
+
+        // composite inertias, leaves -> root (parent index < child index)
+        auto& Ic = ws_.Ic;
+        Ic.assign(nf, Inertia3dp<value_t>{});
+        for (size_t i = nf; i-- > 1;) {
+            if (loaded[i]) Ic[i] += world_inertia(body[i].I, get_pos_trafo(i, 0));
+            Ic[parent(i)] += Ic[i];
+        }
+
+        auto& S = ws_.S; // world joint screws
+        S.resize(n);
+        for (size_t k = 0; k < n; ++k)
+            S[k] = move3dp(joint[rj[k]].screw_b, get_pos_trafo(rj[k], 0));
+
+        dof_parents(rj);
+        auto const& lambda = ws_.lambda;
+        Mmat.assign(n * n, 0.0);
+        for (size_t k = 0; k < n; ++k) {
+            bivec3dp const F = Ic[rj[k]](S[k]); // composite momentum of unit rate k
+            Mmat[k * n + k] = spatial_dot(S[k], F);
+            for (size_t j = k; lambda[j] != j;) {
+                j = lambda[j];
+                Mmat[k * n + j] = Mmat[j * n + k] = spatial_dot(S[j], F);
+            }
+        }
+    }
+
+    // World-frame inertia map of a body: the body-frame map I_b conjugated by its body ->
+    // world motor M, i.e. X -> move3dp(I_b(move3dp(X, rrev(M))), M). Stored as an
+    // Inertia3dp whose column k is the image of the k-th basis twist, so articulated
+    // inertias can be accumulated with operator+= across the tree (all in world frame).
+    static Inertia3dp<value_t> world_inertia(Inertia3dp<value_t> const& I_b,
+                                             mvec3dp_e const& M)
+    {
+        auto const Minv = rrev(M);
+        Inertia3dp<value_t> Iw;
+        auto v = Iw.view();
+        for (size_t k = 0; k < 6; ++k) {
+            auto const col = components(move3dp(I_b(move3dp(basis_twist(k), Minv)), M));
+            for (size_t r = 0; r < 6; ++r)
+                v[r, k] = col[r];
+        }
+        return Iw;
+    }
+
+    // k-th basis twist and the component array of a bivector, both in the Inertia3dp
+    // ordering (vx, vy, vz, mx, my, mz)
+    static twist3dp basis_twist(size_t k)
+    {
+        std::array<value_t, 6> e{};
+        e[k] = 1.0;
+        return twist3dp{e[0], e[1], e[2], e[3], e[4], e[5]};
+    }
+
+    static std::array<value_t, 6> components(bivec3dp const& B)
     {
-        auto const [Mmat, RHS] = assemble_mass_bias(rj);
-        return hd::ga::lu_solve(Mmat, RHS, rj.size()); // shared LU (detail/ga_solver.hpp)
+        return {B.vx, B.vy, B.vz, B.mx, B.my, B.mz};
     }
 
-    // RK4-integrate the coupled 1-DOF joint chain `rj` over dt in its joint coordinates
-    // via the shared rk4_step. The state is u = [phi_0..phi_{n-1}, omega_0..omega_{n-1}];
-    // the derivative (dphi, domega) = (omega, q-ddot) is recomputed each sub-step by
-    // writing u into the joint state, refreshing the kinematic poses + twists, and
-    // solving the coupled forward dynamics.
+    // Per-frame world quantities shared by the O(n) tree sweeps (forward_dynamics_aba,
+    // inverse_dynamics), filled root -> leaves by outward_sweep():
+    //
+    //   V_i = V_parent + Ad(xi_i)                        world velocity twist
+    //   c_i = Ad(xidot_i) + [V_i, Ad(xi_i)]              velocity-product bias accel.
+    //   p_i = Ad(rcmt(V_body, I(V_body))) - W_ext_i      bias wrench (world)
+    //
+    // i.e. the world_VA recursion with the dof joints' own q-ddot left out (it is the
+    // unknown, resp. the input), and the force elements of assemble_mass_bias folded
+    // per frame: W_ext collects gravity (inertia-bearing bodies), applied wrenches,
+    // grounded springs and extra_wrenches(). The inertia-bearing bodies are those of
+    // the dense path (dof + driven joints), so all paths solve the same equations.
+    static size_t constexpr no_dof = std::numeric_limits<size_t>::max();
+
+    struct tree_sweep3dp {
+        std::vector<size_t> slot;   // coordinate slot in rj per frame (or no_dof)
+        std::vector<char> loaded;   // inertia-bearing frame (dof + driven joints)
+        std::vector<mvec3dp_e> M;   // body -> world motor
+        std::vector<twist3dp> V;    // world velocity twist
+        std::vector<twist3dp> c;    // velocity-product bias acceleration (world)
+        std::vector<twist3dp> S;    // world joint screw (dof frames only)
+        std::vector<bivec3dp> p;    // bias wrench: gyroscopic - external (world)
+    };
+
+    // Persistent scratch of the stepping hot path (step -> coupled_step ->
+    // forward_dynamics), owned by the system so that a steady-state step() performs no
+    // heap allocation: every buffer is assign()ed / resize()d to the current frame and
+    // dof count on use, which only allocates when that count grows (frames added, a
+    // joint switched between dof and driven). Results handed out by reference
+    // (forward_dynamics, outward_sweep) live here until the next evaluation.
+    struct workspace3dp {
+        std::vector<size_t> rj;              // dof joints of the current step()
+        std::vector<value_t> u;              // coupled state [phi.., omega..]
+        std::vector<size_t> bl;              // inertia-bearing bodies (dof + driven)
+        std::vector<twist3dp> S;             // world joint screws of the dof joints
+        std::vector<vec3dp> cm;              // body cm in world
+        std::vector<mvec3dp_e> Minv;         // world -> body motor
+        std::vector<twist3dp> Fbias;         // body-frame spatial bias wrench
+        std::vector<value_t> Mmat;           // mass matrix (n*n), factorized in place
+        std::vector<value_t> rhs;            // generalised force -> q-ddot (dense)
+        std::vector<size_t> lambda;          // dof-tree parent slots
+        std::vector<size_t> nearest;         // nearest dof slot at or above a frame
+        std::vector<char> loaded;            // inertia-bearing frame (CRBA)
+        std::vector<Inertia3dp<value_t>> Ic; // composite (CRBA) / articulated (ABA)
+        tree_sweep3dp ts;                    // outward sweep (ABA, RNEA)
+        std::vector<bivec3dp> U;             // ABA: IA(S) per frame
+        std::vector<value_t> D, tau;         // ABA: <S, U>, joint force minus bias
+        std::vector<twist3dp> A;             // world accelerations
+        std::vector<value_t> qdd;            // joint accelerations (ABA)
+        std::vector<free_body_state3dp> fb;  // free-body block (parallel step)
+        std::vector<bivec3dp> fw;            // extra wrench per free body (or empty)
+        std::vector<std::pair<size_t, bivec3dp>> xw; // append_extra_wrenches() buffer
+    };
+    workspace3dp ws_;
+    std::optional<rk4_integrator> rk4_; // persistent RK4 scratch (cf. abm_)
+
+    tree_sweep3dp& outward_sweep(std::vector<size_t> const& rj)
+    {
+        size_t const nf = size();
+        auto& ts = ws_.ts;
+        ts.slot.assign(nf, no_dof);
+        ts.loaded.assign(nf, 0);
+        ts.M.assign(nf, I_3dp_mv_e);
+        ts.V.assign(nf, twist3dp{});
+        ts.c.assign(nf, twist3dp{});
+        ts.S.assign(nf, twist3dp{});
+        ts.p.assign(nf, bivec3dp{});
+        for (size_t k = 0; k < rj.size(); ++k) {
+            ts.slot[rj[k]] = k;
+            ts.loaded[rj[k]] = 1;
+        }
+        for (auto const& [idx, d] : driven_)
+            ts.loaded[idx] = 1;
+
+        for (size_t i = 1; i < nf; ++i) {
+            auto const& M = ts.M[i] = get_pos_trafo(i, 0); // cached world motor
+            twist3dp const zeta = move3dp(relative_twist(i), M);
+            ts.V[i] = ts.V[parent(i)] + zeta;
+            ts.c[i] = rcmt(ts.V[i], zeta);
+            if (ts.slot[i] != no_dof) ts.S[i] = move3dp(joint[i].screw_b, M);
+            else ts.c[i] = ts.c[i] + move3dp(relative_accel_twist(i), M);
+            if (ts.loaded[i]) {
+                auto const& I = body[i].I;
+                twist3dp const Vb = move3dp(ts.V[i], rrev(M));
+                ts.p[i] = move3dp(rcmt(Vb, I(Vb)), M) -
+                          wdg(move3dp(O_3dp, M), body[i].mass * grav);
+            }
+        }
+
+        // external wrenches act on their frame's bias wrench (world frame)
+        for (auto const& [fi, aw] : wrench_)
+            ts.p[fi] = ts.p[fi] - aw(time_);
+        for (auto const& [fi, sp] : springs_) {
+            vec3dp const P = unitize(move3dp(sp.anchor_b, ts.M[fi]));
+            vec3dp const v = velocity_field(ts.V[fi], P);
+            vec3dp const F{-sp.k.x * (P.x - sp.p0_world.x) - sp.c * v.x,
+                           -sp.k.y * (P.y - sp.p0_world.y) - sp.c * v.y,
+                           -sp.k.z * (P.z - sp.p0_world.z) - sp.c * v.z, 0.0};
+            ts.p[fi] = ts.p[fi] - wdg(P, F);
+        }
+        for (auto const& [fi, W] : collect_extra_wrenches())
+            if (!is_free_body(fi)) ts.p[fi] = ts.p[fi] - W; // free: its own integrator
+        return ts;
+    }
+
+    // generalised spring/damper force of 1-DOF joint frame idx: -k (q - q0) - c q-dot
+    value_t joint_spring_force(size_t idx) const
+    {
+        auto const& js = joint[idx];
+        return -js.stiffness * (js.phi - js.q_rest) - js.damping * js.omega;
+    }
+
+    // Joint-space forward dynamics for the chain `rj` by Featherstone's articulated-body
+    // algorithm (ABA), in the WORLD frame so no per-joint frame changes are needed:
+    //
+    //   1. root -> leaves: V_i, c_i, p_i by outward_sweep(); body inertias I_i (world).
+    //   2. leaves -> root: articulated inertias IA_i and bias wrenches pA_i. Across a
+    //      1-DOF joint with world screw S_i:
+    //        U_i = IA_i(S_i),  D_i = <S_i, U_i>,  u_i = tau_i - <S_i, pA_i>
+    //        parent += IA_i - U_i <., U_i> / D_i  and  pA_i + Ia(c_i) + U_i u_i / D_i
+    //      A rigid connection (driven joint, plain frame) passes IA_i, pA_i + IA_i(c_i).
+    //   3. root -> leaves: a_i = a_parent + c_i (+ S_i q-ddot_i), with
+    //        q-ddot_i = (u_i - <a_parent + c_i, U_i>) / D_i
+    //
+    // <.,.> is spatial_dot; tau_i is the joint spring/damper force. O(n) per call, the
+    // same joint accelerations as the dense path. Same bias-pass side effect as
+    // assemble_mass_bias.
+    std::vector<value_t> const& forward_dynamics_aba(std::vector<size_t> const& rj)
+    {
+        size_t const n = rj.size();
+        size_t const nf = size();
+
+        // velocity-product (bias) pass: zero the relative accel twists of the unknowns
+        for (size_t k = 0; k < n; ++k)
+            set_accel_twist(rj[k], twist3dp{});
+
+        // 1. outward sweep: velocities, bias accelerations + bias wrenches, inertias
+        auto& ts = outward_sweep(rj);
+        auto const& slot = ts.slot;
+        auto const& c = ts.c;
+        auto const& S = ts.S;
+        auto& pA = ts.p;
+        auto& IA = ws_.Ic;
+        IA.assign(nf, Inertia3dp<value_t>{});
+        for (size_t i = 1; i < nf; ++i)
+            if (ts.loaded[i]) IA[i] = world_inertia(body[i].I, ts.M[i]);
+
+        // 2. inward sweep: articulated inertias + bias wrenches, folded into the parent
+        auto& U = ws_.U;
+        auto& D = ws_.D;
+        auto& u = ws_.tau;
+        U.assign(nf, bivec3dp{});
+        D.assign(nf, 0.0);
+        u.assign(nf, 0.0);
+        for (size_t i = nf; i-- > 1;) {
+            Inertia3dp<value_t> Ia = IA[i];
+            bivec3dp pa = pA[i];
+            if (slot[i] != no_dof) {
+                U[i] = IA[i](S[i]);
+                D[i] = spatial_dot(S[i], U[i]);
+                if (std::abs(D[i]) < eps) {
+                    throw Solver_error(
+                        std::string("dynamic_system3dp: articulated-body inertia of "
+                                    "joint frame ") +
+                        std::to_string(i) + std::string(" is singular."));
+                }
+                u[i] = joint_spring_force(i) - spatial_dot(S[i], pA[i]);
+                // Ia = IA - U <., U> / D  (column k: the image of basis twist e_k)
+                auto v = Ia.view();
+                auto const Uc = components(U[i]);
+                for (size_t k = 0; k < 6; ++k) {
+                    value_t const w = spatial_dot(basis_twist(k), U[i]) / D[i];
+                    for (size_t r = 0; r < 6; ++r)
+                        v[r, k] -= Uc[r] * w;
+                }
+                pa = pa + Ia(c[i]) + (u[i] / D[i]) * U[i];
+            }
+            else {
+                pa = pa + Ia(c[i]);
+            }
+            IA[parent(i)] += Ia;
+            pA[parent(i)] = pA[parent(i)] + pa;
+        }
+
+        // 3. outward sweep: accelerations and the joint accelerations (root fixed)
+        auto& A = ws_.A;
+        auto& qdd = ws_.qdd;
+        A.assign(nf, twist3dp{});
+        qdd.assign(n, 0.0);
+        for (size_t i = 1; i < nf; ++i) {
+            twist3dp a = A[parent(i)] + c[i];
+            if (slot[i] != no_dof) {
+                value_t const qdd_i = (u[i] - spatial_dot(a, U[i])) / D[i];
+                qdd[slot[i]] = qdd_i;
+                a = a + qdd_i * S[i];
+            }
+            A[i] = a;
+        }
+        return qdd;
+    }
+
+    // Integrate the coupled 1-DOF joint chain `rj` over dt in its joint coordinates with
+    // the selected integrator (RK4 via the shared rk4_step, ABM2, DP54 sub-stepping
+    // adaptively across [t, t + dt], or the implicit SDIRK3). The state is
+    // u = [phi_0..phi_{n-1}, omega_0..omega_{n-1}]; the derivative (dphi, domega) =
+    // (omega, q-ddot) is recomputed each sub-step by writing u into the joint state,
+    // refreshing the kinematic poses + twists, and solving the coupled forward dynamics.
     void coupled_step(std::vector<size_t> const& rj, value_t dt)
     {
         size_t const n = rj.size();
         size_t const dim = 2 * n; // state = [phi_0..phi_{n-1}, omega_0..omega_{n-1}]
-        std::vector<value_t> u_mem(dim);
+        auto& u_mem = ws_.u;
+        u_mem.resize(dim);
         for (size_t k = 0; k < n; ++k) {
             u_mem[k] = joint[rj[k]].phi;
             u_mem[n + k] = joint[rj[k]].omega;
@@ -1636,7 +2713,7 @@ class dynamic_system3dp : public kinematic_system3dp {
             time_ = t;
             apply_driven_joints();
             write_u(u);
-            auto const qdd = forward_dynamics(rj);
+            auto const& qdd = forward_dynamics(rj);
             for (size_t k = 0; k < n; ++k) {
                 du[k] = u[n + k];   // dphi/dt = omega
                 du[n + k] = qdd[k]; // domega/dt = q-ddot
@@ -1648,8 +2725,24 @@ class dynamic_system3dp : public kinematic_system3dp {
             if (!abm_ || abm_->dim() != dim) abm_.emplace(dim); // (re)size the history
             abm_->step(f, u_mem, t0, dt);
         }
+        else if (integ_ == integrator_kind::dp54) {
+            if (!dp_ || dp_->dim() != dim) dp_.emplace(dim); // (re)size the stages
+            // the FSAL stage is NOT carried across step() calls: wrenches, springs or
+            // driven joints may have been edited in between, which u alone can't reveal
+            dp_->reset();
+            if (dp_dt_ <= 0.0) dp_dt_ = dt; // first call: start from the output interval
+            dp_->integrate(f, u_mem, t0, t0 + dt, dp_dt_, atol_, rtol_);
+        }
+        else if (integ_ == integrator_kind::sdirk3) {
+            if (!sd_ || sd_->dim() != dim) sd_.emplace(dim); // (re)size J + LU
+            // J + LU persist across step() calls; one gone stale (e.g. an edited spring
+            // rate) only costs a Newton retry with a fresh Jacobian
+            sd_->set_tolerances(atol_, rtol_);
+            sd_->step(f, u_mem, t0, dt);
+        }
         else {
-            rk4_integrator(dim).step(f, u_mem, t0, dt); // wraps the canonical rk4_step
+            if (!rk4_ || rk4_->dim() != dim) rk4_.emplace(dim); // (re)size the scratch
+            rk4_->step(f, u_mem, t0, dt); // wraps the canonical rk4_step
         }
 
         time_ = t0; // restore the clock (step() advances it by dt)
@@ -0,0 +1,96 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+#include "ga_pga3dp_ops_products.hpp" // scalar reference products
+
+#include "detail/ga_simd.hpp" // simd_product, simd_basis_t, simd_sign_table
+
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// provides pga3dp SIMD versions of the full multivector products (MVec3dp):
+//
+// - gpr_simd()             -> same result as operator*() for MVec3dp x MVec3dp
+// - wdg_simd()             -> wdg() for MVec3dp x MVec3dp (scalar, see below)
+// - rwdg_simd()            -> rwdg() for MVec3dp x MVec3dp (scalar, see below)
+// - rgpr_simd()            -> same result as rgpr() for MVec3dp x MVec3dp
+//
+// See detail/ga_simd.hpp for the method. The scalar products remain the reference and
+// the constexpr variant; the results agree with them to rounding.
+//
+// gpr and rgpr are dense and gain about 1.7x - 2.6x in ga_bench_simd_products. wdg and
+// rwdg are sparse and cheap in scalar form already; their SIMD versions showed no
+// consistent gain (and were slower with AVX-512), so wdg_simd() and rwdg_simd() forward
+// to the scalar products.
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace hd::ga::detail {
+
+// component c_n of MVec3dp: blade with bitmask mask[n] and orientation sign[n]
+inline constexpr simd_basis_t<16> pga3dp_simd_basis{
+    simd_mask16, {1, 1, 1, 1, 1, -1, -1, -1, 1, -1, 1, 1, -1, 1, -1, 1}};
+
+// scalar reference products the sign tables are generated from (simd_sign_table)
+struct pga3dp_simd_gpr {
+    using argument_type = MVec3dp<double>;
+    constexpr auto operator()(argument_type const& A, argument_type const& B) const
+    {
+        return pga::operator*(A, B);
+    }
+};
+struct pga3dp_simd_rgpr {
+    using argument_type = MVec3dp<double>;
+    constexpr auto operator()(argument_type const& A, argument_type const& B) const
+    {
+        return pga::rgpr(A, B);
+    }
+};
+
+} // namespace hd::ga::detail
+
+namespace hd::ga::pga {
+
+// pga3dp gpr :: gpr_simd(mv,mv) -> mv   (same result as operator*())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+inline MVec3dp<std::common_type_t<T, U>> gpr_simd(MVec3dp<T> const& A,
+                                                  MVec3dp<U> const& B)
+{
+    using ctype = std::common_type_t<T, U>;
+    return ga::detail::simd_product<ga::detail::pga3dp_simd_basis,
+                                    ga::detail::pga3dp_simd_gpr, 0>(MVec3dp<ctype>(A),
+                                                                    MVec3dp<ctype>(B));
+}
+
+// pga3dp wdg :: wdg_simd(mv,mv) -> mv   (forwards to wdg())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+inline MVec3dp<std::common_type_t<T, U>> wdg_simd(MVec3dp<T> const& A,
+                                                  MVec3dp<U> const& B)
+{
+    return wdg(A, B);
+}
+
+// pga3dp rwdg :: rwdg_simd(mv,mv) -> mv   (forwards to rwdg())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+inline MVec3dp<std::common_type_t<T, U>> rwdg_simd(MVec3dp<T> const& A,
+                                                   MVec3dp<U> const& B)
+{
+    return rwdg(A, B);
+}
+
+// pga3dp rgpr :: rgpr_simd(mv,mv) -> mv   (same result as rgpr())
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+inline MVec3dp<std::common_type_t<T, U>> rgpr_simd(MVec3dp<T> const& A,
+                                                   MVec3dp<U> const& B)
+{
+    using ctype = std::common_type_t<T, U>;
+    return ga::detail::simd_product<ga::detail::pga3dp_simd_basis,
+                                    ga::detail::pga3dp_simd_rgpr, 15>(MVec3dp<ctype>(A),
+                                                                      MVec3dp<ctype>(B));
+}
+
+} // namespace hd::ga::pga
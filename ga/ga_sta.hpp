@@ -32,5 +32,8 @@
 // STA-specific operations are in namespace hd::ga::pga
 #include "ga_sta4ds_ops.hpp" // include all STA operations for 4ds
 
+// SIMD backend for the full multivector products (scalar products remain the reference)
+#include "ga_sta4ds_ops_simd.hpp" // gpr_simd, wdg_simd, rwdg_simd for 4ds
+
 // fmt-support is defined outside of other namespaces
 #include "detail/ga_fmt_support.hpp" // printing support (fmt library)
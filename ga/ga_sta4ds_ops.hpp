@@ -198,7 +198,9 @@ namespace hd::ga::sta {
 //   - angle() / rapidity()            -> separation of two vectors (spacelike / timelike)
 //   - transform(X, R)                 -> apply a rotor via the sandwich R*X*rev(R)
 //   - transform_opt(X, R)             -> closed-form transform, vec/bivec/trivec
-//                                        (scalar + std::vector batch overloads)
+//                                        (scalar + std::vector / std::span batches)
+//   - transform_inplace(v, R)         -> closed-form transform of a std::span in place
+//   - get_xform(R)                    -> precomputed transform object (Xform4ds)
 //   - time_split() / space_split()    -> spacetime split of a vector (time + rel. space)
 //   - rel_vec_split() / rel_bivec_split() -> spacetime split of a bivector (E / B parts)
 //   - project_onto() / reject_from()  -> projection / rejection (onto vector or bivector)
@@ -660,6 +662,102 @@ transform_opt(std::vector<BiVec4ds<T>> const& bivecs, MVec4ds_E<U> const& R)
     return res;
 }
 
+// batch transformation on caller-owned storage (std::span over a std::vector, std::array,
+// a reused stream buffer, ...): same matrix as above, but nothing is allocated.
+//
+//   transform_opt(in, R, out)  out[i] = transform_opt(in[i], R); in and out must have
+//                              the same size (throws std::invalid_argument) and must be
+//                              disjoint or identical
+//   transform_inplace(v, R)    overwrites v
+//
+// T is deduced from out; a std::vector<Vec4ds<T>> converts implicitly to in, out is
+// passed as std::span(vec). The matrix is rounded to T.
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_opt(std::type_identity_t<std::span<Vec4ds<T> const>> in,
+                   MVec4ds_E<U> const& R, std::span<Vec4ds<T>> out)
+{
+    auto const k = detail::soa_matrix<Vec4ds<T>>(
+        [&R](Vec4ds<T> const& v) { return Vec4ds<T>(transform_opt(v, R)); });
+    detail::span_transform<Vec4ds<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<Vec4ds<T>> vecs, MVec4ds_E<U> const& R)
+{
+    auto const k = detail::soa_matrix<Vec4ds<T>>(
+        [&R](Vec4ds<T> const& v) { return Vec4ds<T>(transform_opt(v, R)); });
+    detail::span_transform<Vec4ds<T>>(k, vecs, vecs);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_opt(std::type_identity_t<std::span<TriVec4ds<T> const>> in,
+                   MVec4ds_E<U> const& R, std::span<TriVec4ds<T>> out)
+{
+    auto const k = detail::soa_matrix<TriVec4ds<T>>(
+        [&R](TriVec4ds<T> const& t) { return TriVec4ds<T>(transform_opt(t, R)); });
+    detail::span_transform<TriVec4ds<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<TriVec4ds<T>> tris, MVec4ds_E<U> const& R)
+{
+    auto const k = detail::soa_matrix<TriVec4ds<T>>(
+        [&R](TriVec4ds<T> const& t) { return TriVec4ds<T>(transform_opt(t, R)); });
+    detail::span_transform<TriVec4ds<T>>(k, tris, tris);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_opt(std::type_identity_t<std::span<BiVec4ds<T> const>> in,
+                   MVec4ds_E<U> const& R, std::span<BiVec4ds<T>> out)
+{
+    auto const k = detail::soa_matrix<BiVec4ds<T>>(
+        [&R](BiVec4ds<T> const& B) { return BiVec4ds<T>(transform_opt(B, R)); });
+    detail::span_transform<BiVec4ds<T>>(k, in, out);
+}
+
+template <typename T, typename U>
+    requires(numeric_type<T> && numeric_type<U>)
+void transform_inplace(std::span<BiVec4ds<T>> bivecs, MVec4ds_E<U> const& R)
+{
+    auto const k = detail::soa_matrix<BiVec4ds<T>>(
+        [&R](BiVec4ds<T> const& B) { return BiVec4ds<T>(transform_opt(B, R)); });
+    detail::span_transform<BiVec4ds<T>>(k, bivecs, bivecs);
+}
+
+// precomputed Lorentz transformation (Xform4ds, see ga_xform_t.hpp): the closed-form
+// matrices of transform_opt() (detail::sta_rotor_xf_mat_vec / _bivec) built once and
+// kept, so the rotor-to-matrix step is paid once per rotor instead of once per call.
+// Apply with xf(X), xf(in, out) or xf.apply_inplace(v); compose with operator*:
+// (xf2 * xf1)(x) == xf2(xf1(x)).
+template <typename T>
+    requires(numeric_type<T>)
+Xform4ds<T> get_xform(MVec4ds_E<T> const& R)
+{
+    auto const kv = detail::sta_rotor_xf_mat_vec<T>(R);
+    auto const kb = detail::sta_rotor_xf_mat_bivec<T>(R);
+    typename GradeXform_t<Vec4ds<T>>::matrix_type mv{};
+    typename GradeXform_t<BiVec4ds<T>>::matrix_type mb{};
+    for (size_t r = 0; r < 4; ++r) {
+        for (size_t c = 0; c < 4; ++c) {
+            mv[r][c] = kv[4 * r + c];
+        }
+    }
+    for (size_t r = 0; r < 6; ++r) {
+        for (size_t c = 0; c < 6; ++c) {
+            mb[r][c] = kb[6 * r + c];
+        }
+    }
+    // trivectors transform with the same 4x4 matrix as vectors in sta
+    return Xform4ds<T>(GradeXform_t<Vec4ds<T>>(mv), GradeXform_t<BiVec4ds<T>>(mb),
+                       GradeXform_t<TriVec4ds<T>>(mv));
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // spacetime split of a vector x relative to a unit timelike observer u (u*u = +1):
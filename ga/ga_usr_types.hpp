@@ -46,6 +46,7 @@ using vec2d = Vec2d<value_t>;
 using pscalar2d = PScalar2d<value_t>;
 using mvec2d_e = MVec2d_E<value_t>; // multivector 2d of even subalgebra
 using mvec2d = MVec2d<value_t>;     // fully populated 2d multivector
+using xform2d = Xform2d<value_t>;   // precomputed rotor transform (see get_xform)
 
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -58,6 +59,7 @@ using pscalar3d = PScalar3d<value_t>;
 using mvec3d_e = MVec3d_E<value_t>; // multivector 3d of even subalgebra
 using mvec3d_u = MVec3d_U<value_t>; // multivector 3d of odd subalgebra
 using mvec3d = MVec3d<value_t>;     // fully populated 3d multivector
+using xform3d = Xform3d<value_t>;   // precomputed rotor transform (see get_xform)
 
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +72,11 @@ using pscalar2dp = PScalar2dp<value_t>;
 using mvec2dp_e = MVec2dp_E<value_t>; // multivector 2dp of even subalgebra
 using mvec2dp_u = MVec2dp_U<value_t>; // multivector 2dp of uneven (odd) subalgebra
 using mvec2dp = MVec2dp<value_t>;     // fully populated 2dp multivector
+using xform2dp = Xform2dp<value_t>;   // precomputed motor transform (see get_xform)
+
+// structure-of-arrays batches (aligned component arrays, for move2dp on many elements)
+using vec2dp_soa = Vec2dp_SoA<value_t>;
+using bivec2dp_soa = BiVec2dp_SoA<value_t>;
 
 // dual number with s 1 + ps I_2dp (I_2dp = e321, where e321^2 = 0)
 using dualnum2dp = DualNum2dp<value_t>;
@@ -93,6 +100,12 @@ using pscalar3dp = PScalar3dp<value_t>;
 using mvec3dp_e = MVec3dp_E<value_t>; // multivector 3dp of even subalgebra
 using mvec3dp_u = MVec3dp_U<value_t>; // multivector 3dp of uneven (odd) subalgebra
 using mvec3dp = MVec3dp<value_t>;     // fully populated 3dp multivector
+using xform3dp = Xform3dp<value_t>;   // precomputed motor transform (see get_xform)
+
+// structure-of-arrays batches (aligned component arrays, for move3dp on many elements)
+using vec3dp_soa = Vec3dp_SoA<value_t>;
+using bivec3dp_soa = BiVec3dp_SoA<value_t>;
+using trivec3dp_soa = TriVec3dp_SoA<value_t>;
 
 // dual number with s 1 + ps I_3dp (I_3dp = e1234, where e1234^2 = 0)
 using dualnum3dp = DualNum3dp<value_t>;
@@ -117,6 +130,7 @@ using pscalar4ds = PScalar4ds<value_t>;
 using mvec4ds_e = MVec4ds_E<value_t>; // multivector 4ds of even subalgebra
 using mvec4ds_u = MVec4ds_U<value_t>; // multivector 4ds of uneven (odd) subalgebra
 using mvec4ds = MVec4ds<value_t>;     // fully populated 4ds multivector
+using xform4ds = Xform4ds<value_t>;   // precomputed rotor transform (see get_xform)
 
 // dual number with s 1 + ps I_4ds (I_4ds = g0123, where g0123^2 = 0)
 using dualnum4ds = DualNum4ds<value_t>;
@@ -131,6 +145,7 @@ using pscalar2dc = PScalar2dc<value_t>;
 using mvec2dc_e = MVec2dc_E<value_t>; // multivector 2dc of even subalgebra
 using mvec2dc_u = MVec2dc_U<value_t>; // multivector 2dc of uneven (odd) subalgebra
 using mvec2dc = MVec2dc<value_t>;     // fully populated 2dc multivector
+using xform2dc = Xform2dc<value_t>;   // precomputed motor transform (see get_xform)
 
 // dual number with s 1 + ps I_2dc (I_2dc = e1234)
 using dualnum2dc = DualNum2dc<value_t>;
@@ -146,6 +161,7 @@ using pscalar3dc = PScalar3dc<value_t>;
 using mvec3dc_e = MVec3dc_E<value_t>; // multivector 3dc of even subalgebra
 using mvec3dc_u = MVec3dc_U<value_t>; // multivector 3dc of uneven (odd) subalgebra
 using mvec3dc = MVec3dc<value_t>;     // fully populated 3dc multivector
+using xform3dc = Xform3dc<value_t>;   // precomputed motor transform (see get_xform)
 
 // dual number with s 1 + ps I_3dc (I_3dc = e12345)
 using dualnum3dc = DualNum3dc<value_t>;
@@ -14,12 +14,14 @@
 /////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ga_pga2dp_ops_mechanics.hpp" // Inertia2dp<T>, kinematic frame/system types
-#include "ga_pga3dp_ops_mechanics.hpp" // Inertia3dp<T>
+#include "ga_pga3dp_ops_mechanics.hpp" // Inertia3dp<T>, PrincipalInertia3dp<T>
 #include "ga_value_t.hpp"              // value_t
 
 namespace hd::ga {
 
 using inertia2dp = pga::Inertia2dp<value_t>; // 3x3 inertia matrix for 2D rigid body
 using inertia3dp = pga::Inertia3dp<value_t>; // 6x6 inertia matrix for 3D rigid body
+using principal_inertia3dp =
+    pga::PrincipalInertia3dp<value_t>; // structured (m, J, cm) form of inertia3dp
 
 } // namespace hd::ga
@@ -3,15 +3,18 @@
 // Copyright 2024-2026, Daniel Hug. All rights reserved.
 // Licensed under the terms specified in LICENSE.txt file.
 
-#include <algorithm> // std::clamp, std::max, std::min (adaptive step controller)
+#include <algorithm> // std::clamp, std::max, std::min (adaptive step controller),
+                     // std::lower_bound, std::upper_bound (frame_registry, profiles)
 #include <array>     // std::array (rk4_step vector overload)
 #include <cmath>     // std::cos, std::sin
 #include <mdspan>    // std::mdspan, std::dextents (used by rk4_step)
 #include <numbers>   // math constants like pi
-#include <stdexcept> // std::invalid_argument
+#include <stdexcept> // std::invalid_argument, std::runtime_error
+#include <string>    // std::to_string (sdirk3_integrator error message)
 #include <utility>   // std::pair, std::move (rk4_step vector overload)
 #include <vector>    // std::vector (rk4_step vector overload)
 
+#include "detail/ga_solver.hpp" // hd::ga::lu_decomp / lu_backsubs (sdirk3_integrator)
 #include "detail/type_t/ga_scalar_t.hpp"
 #include "ga_value_t.hpp"
 
@@ -393,6 +396,8 @@ class rk4_integrator {
         return t + dt;
     }
 
+    size_t dim() const { return rhs_.size(); }
+
   private:
 
     std::vector<double> uh_;  // [2 x n] RK4 scratch (flattened)
@@ -579,4 +584,725 @@ class abm2_adaptive_integrator {
     size_t accepted_{0}, rejected_{0};
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// Dormand-Prince 5(4) embedded Runge-Kutta with dense output + event location
+//
+// The explicit 7-stage pair behind MATLAB's ode45 / Hairer's DOPRI5: a 5th-order
+// solution (propagated, "local extrapolation") and an embedded 4th-order one whose
+// difference is the local error estimate. FSAL ("first same as last"): the 7th stage is
+// f(t + dt, u_{n+1}), i.e. exactly the 1st stage of the NEXT step, so an accepted step
+// costs 6 rhs evaluations, not 7. The FSAL stage is reused only when the next call
+// starts from the very (t, u) the previous one ended at; if the caller changed the state
+// in between (or a rhs parameter -- then call reset()), the 1st stage is re-evaluated.
+//
+// Three ways to drive it:
+//   step(f, u, t, dt)                    -- ONE fixed 5th-order step (rk4_integrator
+//                                           shape), no error control
+//   step(f, u, t, dt, atol, rtol)        -- one ACCEPTED adaptive step, dt in/out
+//                                           (abm2_adaptive_integrator shape)
+//   integrate(f, u, t0, t_end, dt0, ...) -- adaptive run landing exactly on t_end
+//
+// DENSE OUTPUT: every step also builds Hairer's 4th-order continuous extension
+// (coefficients d1..d7 below), so dense(t, out) evaluates the solution ANYWHERE in the
+// last step [t_prev(), t_curr()] at the cost of a few axpys -- no extra rhs evaluation.
+// integrate_dense() uses it to emit uniformly spaced output while the steps themselves
+// stay as large as the tolerance allows (instead of forcing the step to the output
+// spacing).
+//
+// EVENTS: integrate_to_event() watches a scalar g(t, u) and stops at its first sign
+// change, located on the dense output by the Illinois variant of regula falsi (root in
+// t to ~t_tol; the state there is the interpolant, accurate to the step tolerance). The
+// step controller is unchanged by an event, so events never shrink the step -- a pair of
+// crossings inside ONE step cancels out; bound dt_max below the shortest time between
+// events when that matters.
+//
+// Step controller as in abm2_adaptive_integrator (scaled infinity-norm error, h_new = h *
+// clamp(0.9 * err^(-1/5), ...)). Still an EXPLICIT method -- not a stiff solver.
+////////////////////////////////////////////////////////////////////////////////
+
+// result of dp54_integrator::integrate_to_event
+struct dp54_event {
+    bool found{false}; // g changed sign within [t0, t_end]
+    double t{0.0};     // event time if found, t_end otherwise
+};
+
+class dp54_integrator {
+
+  public:
+
+    explicit dp54_integrator(size_t n, double dt_min = 1.0e-12, double dt_max = 1.0e30) :
+        k1_(n), k2_(n), k3_(n), k4_(n), k5_(n), k6_(n), k7_(n), us_(n), u5_(n), u1_(n),
+        r1_(n), r2_(n), r3_(n), r4_(n), r5_(n), ev_(n), dt_min_(dt_min), dt_max_(dt_max)
+    {
+    }
+
+    // advance u from t to t + dt in place with ONE 5th-order step (6 rhs evaluations,
+    // FSAL-reused 1st stage when possible); no error control. Returns t + dt.
+    template <typename RHS>
+    double step(RHS&& f, std::vector<double>& u, double t, double dt)
+    {
+        attempt(f, u, t, dt);
+        accept(u, t, dt);
+        return t + dt;
+    }
+
+    // Take one ACCEPTED adaptive step from t; u is updated in place. `dt` is in/out: the
+    // step to attempt on entry, the suggested next step on exit. Rejects + retries with
+    // a smaller step until err <= 1 (or dt_min). Returns t + (accepted step).
+    template <typename RHS>
+    double step(RHS&& f, std::vector<double>& u, double t, double& dt, double atol,
+                double rtol)
+    {
+        size_t const n = u.size();
+        for (;;) {
+            attempt(f, u, t, dt);
+
+            double err = 0.0; // scaled 5(4) error estimate, infinity norm
+            for (size_t i = 0; i < n; ++i) {
+                double const e =
+                    dt * (e1 * k1_[i] + e3 * k3_[i] + e4 * k4_[i] + e5 * k5_[i] +
+                          e6 * k6_[i] + e7 * k7_[i]);
+                double const sc =
+                    atol + rtol * std::max(std::abs(u[i]), std::abs(u5_[i]));
+                err = std::max(err, std::abs(e) / sc);
+            }
+
+            if (err <= 1.0 || dt <= dt_min_ * (1.0 + 1.0e-9)) { // accept
+                accept(u, t, dt);
+                double const fac = (err > 0.0) ? 0.9 * std::pow(1.0 / err, 0.2) : 5.0;
+                double const t_new = t + dt;
+                dt = std::clamp(dt * std::clamp(fac, 0.2, 5.0), dt_min_, dt_max_);
+                return t_new;
+            }
+            ++rejected_; // reject: shrink and retry (stage 1 stays valid -> FSAL kept)
+            double const fac = 0.9 * std::pow(1.0 / err, 0.2);
+            dt = std::max(dt * std::clamp(fac, 0.1, 1.0), dt_min_);
+        }
+    }
+
+    // Integrate from t0 to t_end starting with dt0; the final step is clamped to land
+    // exactly on t_end. Returns t_end. dt0 is in/out: on exit it holds the suggested
+    // next step, so consecutive calls (e.g. one per output interval) keep the step size
+    // the controller has found instead of restarting from a guess.
+    template <typename RHS>
+    double integrate(RHS&& f, std::vector<double>& u, double t0, double t_end,
+                     double& dt0, double atol, double rtol)
+    {
+        double t = t0;
+        while (t < t_end - 1.0e-12 * std::max(1.0, std::abs(t_end))) {
+            double dt_io = std::min(dt0, t_end - t); // clamp to land on t_end
+            bool const clamped = dt_io < dt0;
+            t = step(f, u, t, dt_io, atol, rtol);
+            // keep the controller's suggestion unless the step was only cut short to
+            // land on t_end (then the pre-clamp step is still the better guess)
+            if (!clamped || dt_io < dt0) dt0 = dt_io;
+        }
+        return t;
+    }
+
+    // Adaptive run from t0 to t_end calling out(t, u) at t0, t0 + dt_out, ... (and at
+    // t_end) from the DENSE OUTPUT: the steps are chosen by the tolerance alone, the
+    // output times never constrain them. u holds the state at t_end on exit.
+    template <typename RHS, typename OUT>
+    double integrate_dense(RHS&& f, std::vector<double>& u, double t0, double t_end,
+                           double& dt0, double atol, double rtol, double dt_out,
+                           OUT&& out)
+    {
+        if (!(dt_out > 0.0)) throw std::invalid_argument("dt_out must be > 0");
+        out(t0, static_cast<std::vector<double> const&>(u));
+        size_t k = 1; // next output index (t_out = t0 + k * dt_out avoids drift)
+        double t = t0;
+        double const t_eps = 1.0e-12 * std::max(1.0, std::abs(t_end));
+        while (t < t_end - t_eps) {
+            double dt_io = std::min(dt0, t_end - t);
+            bool const clamped = dt_io < dt0;
+            t = step(f, u, t, dt_io, atol, rtol);
+            if (!clamped || dt_io < dt0) dt0 = dt_io;
+            for (double t_out = t0 + double(k) * dt_out;
+                 t_out <= t + t_eps && t_out < t_end - t_eps;
+                 t_out = t0 + double(++k) * dt_out) {
+                dense(t_out, ev_);
+                out(t_out, static_cast<std::vector<double> const&>(ev_));
+            }
+        }
+        out(t, static_cast<std::vector<double> const&>(u));
+        return t;
+    }
+
+    // Adaptive run from t0 towards t_end that STOPS at the first sign change of the
+    // scalar event function g(t, u) -> double (a zero crossing in either direction; a
+    // g that is zero at t0 -- say a restart at a bounce -- arms on leaving zero). On an
+    // event, u is the dense output at the located root and the result is
+    // {true, t_event}; otherwise u is the state at t_end and the result is
+    // {false, t_end}. dt0 is in/out as in integrate().
+    template <typename RHS, typename EVT>
+    dp54_event integrate_to_event(RHS&& f, EVT&& g, std::vector<double>& u, double t0,
+                                  double t_end, double& dt0, double atol, double rtol,
+                                  double t_tol = 1.0e-12)
+    {
+        double t = t0;
+        double g_old = g(t0, static_cast<std::vector<double> const&>(u));
+        double const t_eps = 1.0e-12 * std::max(1.0, std::abs(t_end));
+        while (t < t_end - t_eps) {
+            double dt_io = std::min(dt0, t_end - t);
+            bool const clamped = dt_io < dt0;
+            t = step(f, u, t, dt_io, atol, rtol);
+            if (!clamped || dt_io < dt0) dt0 = dt_io;
+            double const g_new = g(t, static_cast<std::vector<double> const&>(u));
+            double t_a = t_prev_;
+            if (g_old == 0.0) {
+                // started ON the surface (e.g. restarted at a bounce): take the sign
+                // from inside the step, or a crossing back within it would go unseen
+                t_a = t_prev_ + 0.5 * h_;
+                dense(t_a, ev_);
+                g_old = g(t_a, static_cast<std::vector<double> const&>(ev_));
+            }
+            if ((g_old < 0.0 && g_new >= 0.0) || (g_old > 0.0 && g_new <= 0.0)) {
+                double const t_ev = locate_root(g, t_a, g_old, t, g_new, t_tol);
+                dense(t_ev, ev_);
+                u = ev_; // hand out the interpolated state at the event (no realloc)
+                return {true, t_ev};
+            }
+            if (g_new != 0.0) g_old = g_new;
+        }
+        return {false, t};
+    }
+
+    // Dense output: the 4th-order continuous extension of the LAST step, evaluated at
+    // t in [t_prev(), t_curr()] (no rhs evaluation). out is resized to dim().
+    void dense(double t, std::vector<double>& out) const
+    {
+        size_t const n = r1_.size();
+        out.resize(n);
+        double const th = (h_ != 0.0) ? (t - t_prev_) / h_ : 0.0;
+        double const th1 = 1.0 - th;
+        for (size_t i = 0; i < n; ++i)
+            out[i] =
+                r1_[i] + th * (r2_[i] + th1 * (r3_[i] + th * (r4_[i] + th1 * r5_[i])));
+    }
+
+    // forget the FSAL stage and the counters (call after changing the rhs itself)
+    void reset()
+    {
+        k1_valid_ = false;
+        accepted_ = rejected_ = n_rhs_ = 0;
+    }
+    size_t dim() const { return k1_.size(); }
+    size_t accepted() const { return accepted_; }
+    size_t rejected() const { return rejected_; }
+    size_t rhs_evals() const { return n_rhs_; }
+    double last_dt() const { return h_; }
+    double t_prev() const { return t_prev_; } // start of the last accepted step
+    double t_curr() const { return t_prev_ + h_; }
+
+  private:
+
+    // Butcher tableau (Dormand & Prince 1980); c7 = 1, row 7 = the 5th-order weights b
+    static constexpr double c2 = 1.0 / 5.0, c3 = 3.0 / 10.0, c4 = 4.0 / 5.0,
+                            c5 = 8.0 / 9.0;
+    static constexpr double a21 = 1.0 / 5.0;
+    static constexpr double a31 = 3.0 / 40.0, a32 = 9.0 / 40.0;
+    static constexpr double a41 = 44.0 / 45.0, a42 = -56.0 / 15.0, a43 = 32.0 / 9.0;
+    static constexpr double a51 = 19372.0 / 6561.0, a52 = -25360.0 / 2187.0,
+                            a53 = 64448.0 / 6561.0, a54 = -212.0 / 729.0;
+    static constexpr double a61 = 9017.0 / 3168.0, a62 = -355.0 / 33.0,
+                            a63 = 46732.0 / 5247.0, a64 = 49.0 / 176.0,
+                            a65 = -5103.0 / 18656.0;
+    static constexpr double a71 = 35.0 / 384.0, a73 = 500.0 / 1113.0, a74 = 125.0 / 192.0,
+                            a75 = -2187.0 / 6784.0, a76 = 11.0 / 84.0;
+    // error weights e = b5 - b4
+    static constexpr double e1 = 71.0 / 57600.0, e3 = -71.0 / 16695.0, e4 = 71.0 / 1920.0,
+                            e5 = -17253.0 / 339200.0, e6 = 22.0 / 525.0, e7 = -1.0 / 40.0;
+    // dense-output weights (Hairer, Norsett & Wanner, DOPRI5 contd5)
+    static constexpr double d1 = -12715105075.0 / 11282082432.0,
+                            d3 = 87487479700.0 / 32700410799.0,
+                            d4 = -10690763975.0 / 1880347072.0,
+                            d5 = 701980252875.0 / 199316789632.0,
+                            d6 = -1453857185.0 / 822651844.0,
+                            d7 = 69997945.0 / 29380423.0;
+
+    // all 7 stages of one trial step t -> t + dt from u; the 5th-order result goes to
+    // u5_, the FSAL stage f(t + dt, u5_) to k7_. Stage 1 is re-evaluated only if k1_ does
+    // not already belong to exactly (t, u) -- it does after an accepted step (FSAL) and
+    // on the retry of a rejected one.
+    template <typename RHS>
+    void attempt(RHS&& f, std::vector<double> const& u, double t, double dt)
+    {
+        size_t const n = u.size();
+        if (!(k1_valid_ && t == t1_ && u == u1_)) {
+            f(t, u, k1_);
+            ++n_rhs_;
+            t1_ = t;
+            u1_ = u;
+            k1_valid_ = true;
+        }
+        for (size_t i = 0; i < n; ++i)
+            us_[i] = u[i] + dt * a21 * k1_[i];
+        f(t + c2 * dt, us_, k2_);
+        for (size_t i = 0; i < n; ++i)
+            us_[i] = u[i] + dt * (a31 * k1_[i] + a32 * k2_[i]);
+        f(t + c3 * dt, us_, k3_);
+        for (size_t i = 0; i < n; ++i)
+            us_[i] = u[i] + dt * (a41 * k1_[i] + a42 * k2_[i] + a43 * k3_[i]);
+        f(t + c4 * dt, us_, k4_);
+        for (size_t i = 0; i < n; ++i)
+            us_[i] =
+                u[i] + dt * (a51 * k1_[i] + a52 * k2_[i] + a53 * k3_[i] + a54 * k4_[i]);
+        f(t + c5 * dt, us_, k5_);
+        for (size_t i = 0; i < n; ++i)
+            us_[i] = u[i] + dt * (a61 * k1_[i] + a62 * k2_[i] + a63 * k3_[i] +
+                                  a64 * k4_[i] + a65 * k5_[i]);
+        f(t + dt, us_, k6_);
+        for (size_t i = 0; i < n; ++i)
+            u5_[i] = u[i] + dt * (a71 * k1_[i] + a73 * k3_[i] + a74 * k4_[i] +
+                                  a75 * k5_[i] + a76 * k6_[i]);
+        f(t + dt, u5_, k7_);
+        n_rhs_ += 6;
+    }
+
+    // commit the trial step: build the dense-output coefficients of [t, t + dt], move u
+    // to the 5th-order solution and hand the FSAL stage k7 over as the next k1
+    void accept(std::vector<double>& u, double t, double dt)
+    {
+        size_t const n = u.size();
+        for (size_t i = 0; i < n; ++i) {
+            double const ydiff = u5_[i] - u[i];
+            double const bspl = dt * k1_[i] - ydiff;
+            r1_[i] = u[i];
+            r2_[i] = ydiff;
+            r3_[i] = bspl;
+            r4_[i] = ydiff - dt * k7_[i] - bspl;
+            r5_[i] = dt * (d1 * k1_[i] + d3 * k3_[i] + d4 * k4_[i] + d5 * k5_[i] +
+                           d6 * k6_[i] + d7 * k7_[i]);
+            u[i] = u5_[i];
+        }
+        k1_.swap(k7_); // FSAL: f(t + dt, u_{n+1}) is the next step's 1st stage
+        t1_ = t + dt;
+        u1_ = u;
+        t_prev_ = t;
+        h_ = dt;
+        ++accepted_;
+    }
+
+    // Illinois (modified regula falsi) root of g on the dense output of the last step,
+    // bracketed by [a, b] within it with sign-changing end values g(a) = ga, g(b) = gb
+    template <typename EVT>
+    double locate_root(EVT&& g, double a, double ga, double b, double gb, double t_tol)
+    {
+        double tm = b;
+        int side = 0; // which end was retained last (-1: a, +1: b) -> Illinois halving
+        for (size_t it = 0; it < 100 && (b - a) > t_tol * std::max(1.0, std::abs(b));
+             ++it) {
+            tm = (a * gb - b * ga) / (gb - ga);
+            dense(tm, ev_);
+            double const gm = g(tm, static_cast<std::vector<double> const&>(ev_));
+            if (gm == 0.0) return tm;
+            if ((gm < 0.0) == (gb < 0.0)) { // root in [a, tm]
+                b = tm;
+                gb = gm;
+                if (side == -1) ga *= 0.5;
+                side = -1;
+            }
+            else { // root in [tm, b]
+                a = tm;
+                ga = gm;
+                if (side == +1) gb *= 0.5;
+                side = +1;
+            }
+        }
+        return (std::abs(ga) < std::abs(gb)) ? a : b;
+    }
+
+    std::vector<double> k1_, k2_, k3_, k4_, k5_, k6_, k7_; // stages (k7 = FSAL stage)
+    std::vector<double> us_, u5_;          // stage state / trial 5th-order solution
+    std::vector<double> u1_;               // state k1_ belongs to (FSAL validity)
+    std::vector<double> r1_, r2_, r3_, r4_, r5_; // dense-output coefficients, last step
+    std::vector<double> ev_;                     // dense-output / event scratch
+    double t1_{0.0};                             // time k1_ belongs to
+    bool k1_valid_{false};
+    double t_prev_{0.0}, h_{0.0}; // last accepted step [t_prev_, t_prev_ + h_]
+    double dt_min_, dt_max_;
+    size_t accepted_{0}, rejected_{0}, n_rhs_{0};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// SDIRK3: L-stable singly diagonally implicit Runge-Kutta, 3 stages, 3rd order
+//
+// For STIFF problems -- a stiff joint spring or grounded bushing whose period is far
+// below the step the rest of the motion needs. Every explicit method above is bounded
+// by stability (dt ~ 1/sqrt(k/m) ... 1e-6 for k = 1e7), regardless of accuracy. SDIRK3
+// (Alexander 1977) is L-STABLE: a mode far too fast for the step is DAMPED OUT rather
+// than amplified, so dt is chosen by the motion of interest (e.g. 1e-3) alone.
+//
+//   Y_i = u + dt * sum_{j<i} a_ij f(t + c_j dt, Y_j) + dt g f(t + c_i dt, Y_i),
+//   u_{n+1} = Y_3   ("stiffly accurate": the last stage is the solution)
+//
+// with the SAME diagonal g for every stage. Each implicit stage is solved by simplified
+// Newton on  (I - dt g J) dY = -G(Y),  J = df/du, so ONE LU factorization of
+// (I - dt g J) serves all three stages and all their Newton iterations. J comes from
+// forward finite differences of f (n + 1 evaluations), so any rhs works -- including
+// dynamic_system's coupled forward dynamics.
+//
+// J and its LU are also REUSED ACROSS STEPS while Newton converges quickly (<= 3
+// iterations per stage) and dt is unchanged; a slow step marks J stale for the next
+// one, and a failed Newton iteration retries the step once with a fresh J before
+// throwing std::runtime_error (dt too large even for the implicit method). atol/rtol
+// are the Newton convergence tolerances on the stage values. Fixed step, same
+// step(f, u, t, dt) shape as rk4_integrator.
+//
+// All scratch (including the row scaling of lu_decomp) is sized by the constructor, so
+// step() never allocates, also when it refreshes J and refactorizes.
+////////////////////////////////////////////////////////////////////////////////
+class sdirk3_integrator {
+
+  public:
+
+    explicit sdirk3_integrator(size_t n, double atol = 1.0e-10, double rtol = 1.0e-8) :
+        J_(n * n), M_(n * n), perm_(n), vv_(n), f0_(n), up_(n), r_(n), y_(n), dy_(n),
+        fy_(n), F_(3 * n), atol_(atol), rtol_(rtol)
+    {
+    }
+
+    // advance u from t to t + dt in place; returns t + dt. Throws std::runtime_error if
+    // Newton fails to converge even with a freshly evaluated Jacobian.
+    template <typename RHS>
+    double step(RHS&& f, std::vector<double>& u, double t, double dt)
+    {
+        bool fresh = false;
+        if (!jac_valid_) {
+            jacobian(f, u, t);
+            fresh = true;
+        }
+        if (fresh || dt != h_lu_) factor(dt);
+        while (!solve_stages(f, u, t, dt)) {
+            if (fresh)
+                throw std::runtime_error("sdirk3_integrator: Newton iteration did not "
+                                         "converge (dt too large) at t = " +
+                                         std::to_string(t));
+            jacobian(f, u, t); // stale Jacobian: refresh it and retry the step once
+            fresh = true;
+            factor(dt);
+        }
+        u = y_; // stiffly accurate: the last stage value is the solution
+        jac_valid_ = (max_iter_ <= 3); // fast convergence -> keep J + LU for next step
+        ++steps_;
+        return t + dt;
+    }
+
+    void set_tolerances(double atol, double rtol)
+    {
+        atol_ = atol;
+        rtol_ = rtol;
+    }
+    // forget J and its LU (call after changing the rhs itself)
+    void reset()
+    {
+        jac_valid_ = false;
+        h_lu_ = 0.0;
+    }
+    size_t dim() const { return f0_.size(); }
+    size_t steps() const { return steps_; }
+    size_t rhs_evals() const { return n_rhs_; }
+    size_t jacobians() const { return n_jac_; }
+    size_t factorizations() const { return n_lu_; }
+    size_t newton_iterations() const { return n_newton_; }
+
+  private:
+
+    // L-stable SDIRK3 (Alexander 1977): g is the root of g^3 - 3g^2 + 3g/2 - 1/6 in
+    // (1/6, 1/2); stiffly accurate, so b = the last row of A
+    static constexpr double g = 0.43586652150845899942;
+    static constexpr double c[3] = {g, 0.5 * (1.0 + g), 1.0};
+    static constexpr double a21 = 0.5 * (1.0 - g);
+    static constexpr double a31 = -1.5 * g * g + 4.0 * g - 0.25;
+    static constexpr double a32 = 1.5 * g * g - 5.0 * g + 1.25;
+    static constexpr size_t max_newton = 10;
+
+    // forward-difference Jacobian J = df/du at (t, u), row-major
+    template <typename RHS>
+    void jacobian(RHS&& f, std::vector<double> const& u, double t)
+    {
+        size_t const n = u.size();
+        f(t, u, f0_);
+        up_ = u;
+        for (size_t j = 0; j < n; ++j) {
+            double const h = 1.4901161193847656e-08 * std::max(std::abs(u[j]), 1.0);
+            up_[j] = u[j] + h;
+            double const dh = up_[j] - u[j]; // the increment actually representable
+            f(t, up_, fy_);
+            for (size_t i = 0; i < n; ++i)
+                J_[i * n + j] = (fy_[i] - f0_[i]) / dh;
+            up_[j] = u[j];
+        }
+        n_rhs_ += n + 1;
+        ++n_jac_;
+    }
+
+    // LU of the Newton matrix I - dt g J (shared by all stages + iterations)
+    void factor(double dt)
+    {
+        size_t const n = f0_.size();
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+                M_[i * n + j] = (i == j ? 1.0 : 0.0) - dt * g * J_[i * n + j];
+        lu_decomp(std::mdspan<double, std::dextents<size_t, 2>>(M_.data(), n, n),
+                  std::mdspan<int, std::dextents<size_t, 1>>(perm_.data(), n),
+                  std::mdspan<double, std::dextents<size_t, 1>>(vv_.data(), n));
+        h_lu_ = dt;
+        ++n_lu_;
+    }
+
+    // solve the three implicit stages by simplified Newton; the last stage value is
+    // left in y_. Returns false if an iteration diverges or does not converge.
+    template <typename RHS>
+    bool solve_stages(RHS&& f, std::vector<double> const& u, double t, double dt)
+    {
+        size_t const n = u.size();
+        auto const lu =
+            std::mdspan<double const, std::dextents<size_t, 2>>(M_.data(), n, n);
+        auto const pv = std::mdspan<int const, std::dextents<size_t, 1>>(perm_.data(), n);
+        auto const dy = std::mdspan<double, std::dextents<size_t, 1>>(dy_.data(), n);
+        max_iter_ = 0;
+        y_ = u; // initial guess of stage 1; later stages start from the previous stage
+        for (size_t s = 0; s < 3; ++s) {
+            double const* const F0 = F_.data();
+            double const* const F1 = F_.data() + n;
+            for (size_t i = 0; i < n; ++i) // explicit part r = u + dt sum_j a_sj F_j
+                r_[i] = u[i] + dt * (s == 0   ? 0.0
+                                     : s == 1 ? a21 * F0[i]
+                                              : a31 * F0[i] + a32 * F1[i]);
+            double const ts = t + c[s] * dt;
+            double prev = 0.0;
+            bool converged = false;
+            for (size_t it = 1; it <= max_newton && !converged; ++it) {
+                f(ts, y_, fy_); // G(Y) = Y - r - dt g f(Y);  (I - dt g J) dY = -G
+                ++n_rhs_;
+                ++n_newton_;
+                for (size_t i = 0; i < n; ++i)
+                    dy_[i] = r_[i] + dt * g * fy_[i] - y_[i];
+                lu_backsubs(lu, pv, dy);
+                double nrm = 0.0; // scaled infinity norm of the Newton correction
+                for (size_t i = 0; i < n; ++i) {
+                    y_[i] += dy_[i];
+                    double const sc = atol_ + rtol_ * std::abs(y_[i]);
+                    nrm = std::max(nrm, std::abs(dy_[i]) / sc);
+                }
+                if (!(nrm < 1.0e300) || (it > 1 && nrm > prev)) return false; // diverging
+                converged = (nrm <= 1.0);
+                prev = nrm;
+                max_iter_ = std::max(max_iter_, it);
+            }
+            if (!converged) return false;
+            double* const Fs = F_.data() + s * n; // f(Y_s), recovered without a rhs call
+            for (size_t i = 0; i < n; ++i)
+                Fs[i] = (y_[i] - r_[i]) / (dt * g);
+        }
+        return true;
+    }
+
+    std::vector<double> J_, M_;           // Jacobian / LU of I - dt g J (row-major)
+    std::vector<int> perm_;               // LU row permutation
+    std::vector<double> vv_;              // LU row scaling scratch
+    std::vector<double> f0_, up_;         // Jacobian scratch
+    std::vector<double> r_, y_, dy_, fy_; // stage explicit part / value / Newton step
+    std::vector<double> F_;               // [3 x n] stage derivatives
+    double atol_, rtol_;                  // Newton tolerances on the stage values
+    bool jac_valid_{false};               // J (and its LU, if h_lu_ == dt) reusable
+    double h_lu_{0.0};                    // dt the current LU was built for
+    size_t max_iter_{0};                  // max Newton iterations of a stage, last step
+    size_t steps_{0}, n_rhs_{0}, n_jac_{0}, n_lu_{0}, n_newton_{0};
+};
+
+// Time-integration scheme selectable on dynamic_system2dp / dynamic_system3dp (see
+// set_integrator):
+//   rk4  -- canonical 4th-order Runge-Kutta (default), 4 rhs evals/step
+//   abm2 -- Adams-Bashforth-Moulton 2nd-order predictor-corrector, 2 rhs evals/step
+//   dp54 -- Dormand-Prince 5(4), ERROR-CONTROLLED: step(dt) becomes an output interval
+//           covered by as few adaptive sub-steps as the tolerances allow (~6 rhs evals
+//           each, FSAL), see set_tolerances
+//   sdirk3 -- L-stable implicit SDIRK, 3rd order, fixed step: for STIFF joint springs /
+//           grounded springs, where dt no longer has to resolve the stiffest period
+// RK4 is the robust default; ABM2 trades order for fewer evaluations; DP54 trades a
+// fixed cost per step for a fixed ACCURACY per step. Those three are EXPLICIT, so on a
+// genuinely stiff system their step is bounded by stability, not accuracy -- that is
+// what SDIRK3 is for (at the price of a finite-difference Jacobian + LU now and then).
+enum class integrator_kind { rk4, abm2, dp54, sdirk3 };
+
+
+////////////////////////////////////////////////////////////////////////////////
+// frame_registry: per-frame force-element storage as ONE flat array
+//
+// A contiguous std::vector of {frame, value} entries kept sorted by frame index (entries
+// of the same frame stay in insertion order). It replaces a hash map keyed by frame on
+// the stepping hot path: the loops that fold the force elements into the dynamics (once
+// per integrator stage) walk contiguous memory in frame order, with no bucket
+// indirection, and the order of summation is deterministic. Lookup is a binary search.
+//
+// Iteration yields the entries; a structured binding names both parts:
+//
+//     for (auto const& [frame, value] : reg) { ... }
+//
+// Two insertion flavours: assign() keeps at most one entry per frame (a map), append()
+// adds one more entry for the frame (a multimap, e.g. several springs on one body).
+template <typename T> class frame_registry {
+  public:
+
+    struct entry {
+        size_t frame;
+        T value;
+    };
+
+    // the entry of `frame` (replaced if present, inserted in frame order otherwise)
+    void assign(size_t frame, T value)
+    {
+        auto it = lower(frame);
+        if (it != e_.end() && it->frame == frame) it->value = std::move(value);
+        else e_.insert(it, entry{frame, std::move(value)});
+    }
+
+    // one more entry for `frame`, after the ones it already has
+    void append(size_t frame, T value)
+    {
+        auto it = std::upper_bound(
+            e_.begin(), e_.end(), frame,
+            [](size_t f, entry const& x) { return f < x.frame; });
+        e_.insert(it, entry{frame, std::move(value)});
+    }
+
+    // remove all entries of `frame`
+    void erase(size_t frame)
+    {
+        auto const first = lower(frame);
+        auto last = first;
+        while (last != e_.end() && last->frame == frame)
+            ++last;
+        e_.erase(first, last);
+    }
+
+    // the (first) value of `frame`, or nullptr if it has none
+    T const* find(size_t frame) const
+    {
+        auto const it = std::lower_bound(
+            e_.begin(), e_.end(), frame,
+            [](entry const& x, size_t f) { return x.frame < f; });
+        return (it != e_.end() && it->frame == frame) ? &it->value : nullptr;
+    }
+
+    bool contains(size_t frame) const { return find(frame) != nullptr; }
+    bool empty() const { return e_.empty(); }
+    size_t size() const { return e_.size(); }
+    void clear() { e_.clear(); }
+    auto begin() const { return e_.begin(); }
+    auto end() const { return e_.end(); }
+
+  private:
+
+    std::vector<entry> e_; // sorted by frame (stable within a frame)
+
+    auto lower(size_t frame)
+    {
+        return std::lower_bound(e_.begin(), e_.end(), frame,
+                                [](entry const& x, size_t f) { return x.frame < f; });
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// tabulated_profile: a sampled time history y(t), interpolated
+//
+// Samples (t_k, y_k) with strictly increasing t_k; y is any GA type with + and scalar *
+// (e.g. a wrench bivec2dp / bivec3dp). Two interpolants:
+//
+//   linear -- piecewise linear between the samples (C0)
+//   cubic  -- natural cubic spline (C2, zero curvature at both ends); the second
+//             derivatives y''_k are solved once at construction (tridiagonal system),
+//             so an evaluation costs the same few axpys as the linear one
+//
+// Outside [t_0, t_n-1] the end values are held. Evaluation is a binary search for the
+// interval plus a closed-form blend: a plain, inlinable call (no type erasure), which is
+// what the dynamic systems use for their built-in applied-wrench profiles. A
+// default-constructed (empty) profile evaluates to y = 0.
+enum class profile_interp { linear, cubic };
+
+template <typename T> class tabulated_profile {
+  public:
+
+    tabulated_profile() = default;
+
+    tabulated_profile(std::vector<value_t> t, std::vector<T> y,
+                      profile_interp kind = profile_interp::linear) :
+        t_(std::move(t)), y_(std::move(y)), kind_(kind)
+    {
+        if (t_.empty() || t_.size() != y_.size()) {
+            throw std::invalid_argument(
+                std::string("tabulated_profile: need as many values as sample times "
+                            "(at least one), got ") +
+                std::to_string(t_.size()) + std::string(" times and ") +
+                std::to_string(y_.size()) + std::string(" values"));
+        }
+        for (size_t k = 1; k < t_.size(); ++k) {
+            if (!(t_[k] > t_[k - 1])) {
+                throw std::invalid_argument(
+                    std::string("tabulated_profile: sample times must be strictly "
+                                "increasing (violated at index ") +
+                    std::to_string(k) + std::string(")"));
+            }
+        }
+        if (kind_ == profile_interp::cubic) solve_spline();
+    }
+
+    T operator()(value_t t) const
+    {
+        size_t const n = t_.size();
+        if (n == 0) return T{};
+        if (t <= t_.front()) return y_.front();
+        if (t >= t_.back()) return y_.back();
+
+        // interval [t_k, t_k+1] containing t
+        size_t const k =
+            size_t(std::upper_bound(t_.begin(), t_.end(), t) - t_.begin()) - 1;
+        value_t const h = t_[k + 1] - t_[k];
+        value_t const b = (t - t_[k]) / h;
+        value_t const a = 1.0 - b;
+        T y = a * y_[k] + b * y_[k + 1];
+        if (kind_ == profile_interp::cubic)
+            y = y + (h * h / 6.0) *
+                        ((a * a * a - a) * d2_[k] + (b * b * b - b) * d2_[k + 1]);
+        return y;
+    }
+
+    size_t size() const { return t_.size(); }
+    profile_interp kind() const { return kind_; }
+
+  private:
+
+    std::vector<value_t> t_; // sample times (strictly increasing)
+    std::vector<T> y_;       // sample values
+    std::vector<T> d2_;      // spline second derivatives y''(t_k) (cubic only)
+    profile_interp kind_{profile_interp::linear};
+
+    // natural spline: y''_0 = y''_n-1 = 0 and C2 continuity at the inner samples give
+    // a tridiagonal system for y''_k, solved by forward elimination + back substitution
+    void solve_spline()
+    {
+        size_t const n = t_.size();
+        d2_.assign(n, T{});
+        if (n < 3) return; // a straight line
+        std::vector<value_t> c(n, 0.0); // eliminated super-diagonal
+        std::vector<T> r(n, T{});       // eliminated right-hand side
+        for (size_t k = 1; k + 1 < n; ++k) {
+            value_t const hl = t_[k] - t_[k - 1];
+            value_t const hr = t_[k + 1] - t_[k];
+            value_t const sig = hl / (hl + hr);
+            value_t const p = sig * c[k - 1] + 2.0;
+            c[k] = (sig - 1.0) / p;
+            T const dy =
+                (1.0 / hr) * (y_[k + 1] - y_[k]) - (1.0 / hl) * (y_[k] - y_[k - 1]);
+            r[k] = (1.0 / p) * ((6.0 / (hl + hr)) * dy - sig * r[k - 1]);
+        }
+        for (size_t k = n - 1; k-- > 0;)
+            d2_[k] = c[k] * d2_[k + 1] + r[k];
+    }
+};
+
 } // namespace hd::ga
\ No newline at end of file
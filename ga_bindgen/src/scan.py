@@ -97,7 +97,7 @@ SKIP_TYPE_SPELLINGS = {
     "grounded_spring2dp",  # add_grounded_spring component bundle (dynamic_system internal)
     "grounded_spring3dp",
     "wrench_fn",           # std::function<bivecNdp(value_t)> -- applied-wrench callback
-    "integrator_kind",     # selector for dynamic_system3dp::set_integrator (rk4 | abm2)
+    "integrator_kind",     # dynamic_systemNdp::set_integrator selector (rk4/abm2/dp54/sdirk3)
 }
 
 
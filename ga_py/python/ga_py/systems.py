@@ -413,7 +413,9 @@ class DynamicSystem3dp(KinematicSystem3dp):
     def extra_wrenches(self) -> "list[tuple[int, pga.bivec3dp]]":
         """Injection point for a subclass: return (frame_idx, world-wrench) pairs folded
         onto each frame's supporting joints, evaluated every sub-step. The generic base
-        returns none.
+        returns none. (The C++ class additionally has the appending hook
+        append_extra_wrenches(out) for allocation-free subclasses; it defaults to this
+        returning form, which is the one mirrored here.)
         """
         return []
 
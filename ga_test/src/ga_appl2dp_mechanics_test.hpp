@@ -5,6 +5,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <random>
 #include <stdexcept> // std::runtime_error
 #include <string>
 using namespace std::string_literals; // enable s-suffix for std::string literals
@@ -146,6 +147,56 @@ TEST_SUITE("PGA2DP: physics tests prep")
         CHECK(r3.z == doctest::Approx(1.0).epsilon(1e-10));
     }
 
+    TEST_CASE("pga2dp: fixed-size 3x3 LU (constexpr) and batched get_inertia_inverse")
+    {
+        fmt::println("pga2dp: fixed-size 3x3 LU (constexpr) and batched "
+                     "get_inertia_inverse");
+
+        // the fixed-size path is usable in constant expressions
+        constexpr auto det3 = [] {
+            std::array<double, 9> a{2.0, 1.0, 0.0, 1.0, 3.0, 1.0, 0.0, 1.0, 4.0};
+            return det(std::mdspan<double, std::extents<size_t, 3, 3>>(a.data()));
+        }();
+        static_assert(det3 > 17.999 && det3 < 18.001);
+        constexpr auto x0 = [] {
+            std::array<double, 9> a{0.0, 1.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0, 4.0};
+            std::array<int, 3> p{};
+            std::array<double, 3> b{1.0, 4.0, 8.0};
+            auto const A = std::mdspan<double, std::extents<size_t, 3, 3>>(a.data());
+            auto const P = std::mdspan<int, std::extents<size_t, 3>>(p.data());
+            lu_decomp(A, P); // needs a row swap (a[0][0] == 0)
+            lu_backsubs(A, P, std::mdspan<double, std::extents<size_t, 3>>(b.data()));
+            return b;
+        }();
+        static_assert(x0[0] == 2.0 && x0[1] == 1.0 && x0[2] == 2.0);
+
+        Inertia2dp<double> I{};
+        I += get_point_inertia(1.0, Vec2dp<double>{1.0, 0.0, 1.0});
+        I += get_point_inertia(2.0, Vec2dp<double>{0.0, 1.0, 1.0});
+        I += get_point_inertia(1.5, Vec2dp<double>{1.0, 1.0, 1.0});
+
+        // batched inverse == one-by-one inverse; size mismatch throws
+        Inertia2dp<double> I2 = get_point_inertia(2.0, Vec2dp<double>{0.5, 0.5, 1.0});
+        I2 += get_point_inertia(1.0, Vec2dp<double>{-1.0, 0.0, 1.0});
+        std::vector<Inertia2dp<double>> Is{I, I2};
+        std::vector<Inertia2dp<double>> Is_inv(2);
+        get_inertia_inverse(std::span<Inertia2dp<double> const>(Is),
+                            std::span<Inertia2dp<double>>(Is_inv));
+        for (size_t b = 0; b < Is.size(); ++b) {
+            auto const ref = get_inertia_inverse(Is[b]);
+            for (size_t k = 0; k < 9; ++k)
+                CHECK(Is_inv[b].data[k] == ref.data[k]);
+        }
+        auto const too_short = std::span<Inertia2dp<double>>(Is_inv).first(1);
+        CHECK_THROWS_AS(
+            get_inertia_inverse(std::span<Inertia2dp<double> const>(Is), too_short),
+            std::invalid_argument);
+
+        // singular map (a single point mass) throws
+        auto const I_sing = get_point_inertia(1.0, Vec2dp<double>{1.0, 0.0, 1.0});
+        CHECK_THROWS_AS(get_inertia_inverse(I_sing), std::invalid_argument);
+    }
+
     TEST_CASE("pga2dp: compute_omega_dot - ODE right-hand side")
     {
         fmt::println("pga2dp: compute_omega_dot - ODE right-hand side");
@@ -2442,6 +2493,139 @@ TEST_SUITE("PGA2DP: physics tests implementation")
         fmt::println("");
     }
 
+    TEST_CASE("pga2dp: static_system2dp - ancestor index and subtree ranges")
+    {
+        fmt::println("pga2dp: static_system2dp - ancestor index and subtree ranges");
+
+        // is_ancestor() is answered from pre-order intervals maintained by add_frame();
+        // it must agree with a plain walk along the parent pointers for every pair, and
+        // subtree(i) must list exactly the frames having i as ancestor, i first. Frames
+        // are attached out of pre-order (later frames branch off early ones) to exercise
+        // the interval update.
+        //
+        //              W[0]
+        //            /  |   \
+        //        A[1]  D[4]  F[6]
+        //        /  \    |     |
+        //     B[2]  C[3] E[5]  G[7] -- H[8]
+        //       \
+        //        I[9]
+        //
+        static_system2dp sys;
+        sys.add_frame(static_frame2dp("W"));
+        std::vector<std::pair<std::string, size_t>> const frames{
+            {"A", 0}, {"B", 1}, {"C", 1}, {"D", 0}, {"E", 4}, {"F", 0}, {"G", 6},
+            {"H", 7}, {"I", 2}};
+        for (auto const& [name, par] : frames) {
+            sys.add_frame(static_frame2dp(name), par);
+        }
+        size_t const n = sys.size();
+
+        auto walk = [&](size_t anc, size_t idx) {
+            for (size_t k = idx;; k = sys.parent(k)) {
+                if (k == anc) return true;
+                if (sys.parent(k) == k) return false; // reached the root
+            }
+        };
+
+        for (size_t a = 0; a < n; ++a) {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i) {
+                CHECK(sys.is_ancestor(a, i) == walk(a, i));
+                if (walk(a, i)) ++count;
+            }
+            auto const sub = sys.subtree(a);
+            CHECK(sub.size() == count);
+            CHECK(sys.subtree_size(a) == count);
+            CHECK(sub.front() == a);
+            for (size_t i : sub) {
+                CHECK(walk(a, i));
+            }
+        }
+        CHECK(sys.subtree(0).size() == n);
+        CHECK(sys.subtree(sys.index_of("B")).size() == 2); // B, I
+        CHECK(sys.subtree(sys.index_of("F")).size() == 3); // F, G, H
+
+        fmt::println("");
+    }
+
+    TEST_CASE("pga2dp: static_system2dp - cached world motors follow set_pose")
+    {
+        fmt::println("pga2dp: static_system2dp - cached world motors follow set_pose");
+
+        // get_pos_trafo(i, 0) and get_pos_trafo(0, i) are served from a forward-kinematics
+        // cache that set_pose() invalidates for the re-posed frame and its subtree. The
+        // cache must agree with a freshly built system at all times, also when interior
+        // frames of a branching tree are moved between queries.
+        //
+        //              rf[0] (root)
+        //              /          \
+        //          A[1]            D[4]
+        //          /   \             |
+        //       B[2]   C[3]         E[5]
+        //
+        auto build = [](std::vector<pose2dp> const& poses) {
+            static_system2dp s;
+            s.add_frame(static_frame2dp("W"));
+            s.add_frame(static_frame2dp("A", poses[0].origin, poses[0].phi), 0);
+            s.add_frame(static_frame2dp("B", poses[1].origin, poses[1].phi), 1);
+            s.add_frame(static_frame2dp("C", poses[2].origin, poses[2].phi), 1);
+            s.add_frame(static_frame2dp("D", poses[3].origin, poses[3].phi), 0);
+            s.add_frame(static_frame2dp("E", poses[4].origin, poses[4].phi), 4);
+            return s;
+        };
+
+        std::vector<pose2dp> poses{{vec2dp{2, 1, 1}, deg2rad(10)},
+                                   {vec2dp{1, 0.5, 1}, deg2rad(-25)},
+                                   {vec2dp{-0.5, 2, 1}, deg2rad(40)},
+                                   {vec2dp{-3, 1, 1}, deg2rad(5)},
+                                   {vec2dp{0.2, -1, 1}, deg2rad(-70)}};
+        auto sys = build(poses);
+        size_t const n = sys.size();
+
+        auto check_vs_fresh = [&]() {
+            auto fresh = build(poses);
+            for (size_t i = 1; i < n; ++i) {
+                CHECK(is_same_motion(sys.get_pos_trafo(i, 0), fresh.get_pos_trafo(i, 0),
+                                     1e-12));
+                CHECK(is_same_motion(sys.get_pos_trafo(0, i), fresh.get_pos_trafo(0, i),
+                                     1e-12));
+                // cached path composed with the general (LCA) path: i -> j -> world
+                for (size_t j = 1; j < n; ++j) {
+                    CHECK(is_same_motion(
+                        rgpr(sys.get_pos_trafo(j, 0), sys.get_pos_trafo(i, j)),
+                        sys.get_pos_trafo(i, 0), 1e-12));
+                }
+            }
+        };
+
+        check_vs_fresh(); // initial fill of the cache
+
+        // re-pose an interior frame: its whole subtree (B, C) moves, the D-branch not
+        poses[0] = pose2dp{vec2dp{-1, 2.5, 1}, deg2rad(75)};
+        sys.set_pose(1, poses[0]);
+        check_vs_fresh();
+
+        // several changes between two queries, leaf and interior in both branches
+        poses[4] = pose2dp{vec2dp{1.5, 0.5, 1}, deg2rad(33)};
+        sys.set_pose(5, poses[4]);
+        poses[3] = pose2dp{vec2dp{0, -2, 1}, deg2rad(-120)};
+        sys.set_pose(4, poses[3].origin, poses[3].phi);
+        poses[1] = pose2dp{vec2dp{0.3, 0.3, 1}, deg2rad(180)};
+        sys.set_pose(2, poses[1]);
+        check_vs_fresh();
+
+        // frames added after queries are picked up as well
+        sys.add_frame(static_frame2dp("F", vec2dp{1, 1, 1}, deg2rad(15)), 3);
+        auto const p_F = vec2dp{0.5, -0.25, 1};
+        auto const p_W = move2dp(p_F, sys.get_pos_trafo(6, 0));
+        auto const p_W_ref = move2dp(
+            move2dp(p_F, sys.get_pos_trafo(6, 3)), sys.get_pos_trafo(3, 0));
+        CHECK(is_close(unitize(p_W), unitize(p_W_ref), 1e-12));
+
+        fmt::println("");
+    }
+
     TEST_CASE("pga2dp: multibody system transformation - merry-go-round (platform + 3 "
               "turntables)")
     {
@@ -3060,6 +3244,113 @@ TEST_SUITE("PGA2DP: physics tests implementation")
         fmt::println("");
     }
 
+    TEST_CASE("pga2dp: kinematic_system2dp - world_VA_all single-pass twist sweep")
+    {
+        fmt::println(
+            "pga2dp: kinematic_system2dp - world_VA_all single-pass twist sweep");
+
+        auto constexpr cmp_eps = 1e-12;
+
+        // branched tree: a platform carrying a two-link arm and a separate turntable,
+        // every link with its own relative velocity and acceleration
+        kinematic_system2dp ks;
+        ks.add_frame(static_frame2dp{});
+        ks.add_frame(static_frame2dp("P"s, vec2dp{1, 2, 1}, 0.3),
+                     kin_state2dp{.vel = vec2dp{0.2, 0.0, 0.0}, .omega = 0.7});
+        ks.add_frame(static_frame2dp("L1"s, vec2dp{0.5, 0, 1}, -0.4),
+                     kin_state2dp{.acc = vec2dp{0.0, 0.3, 0.0}, .omega = 1.1,
+                                  .alpha = 0.5},
+                     1);
+        ks.add_frame(static_frame2dp("L2"s, vec2dp{0.8, 0.1, 1}, 0.2),
+                     kin_state2dp{.vel = vec2dp{0.0, -0.4, 0.0}, .omega = -0.6,
+                                  .alpha = -0.2});
+        ks.add_frame(static_frame2dp("T"s, vec2dp{-1, 0.5, 1}, 0.0),
+                     kin_state2dp{.omega = 1.5, .alpha = 0.1}, 1);
+
+        std::vector<kinematic_system2dp::world_va2dp> va(ks.size());
+        ks.world_VA_all(va);
+
+        auto const X = vec2dp{0.4, -0.7, 1}; // any world point
+        for (size_t i = 0; i < ks.size(); ++i) {
+            auto const V = ks.twist_world(i);
+            auto const A = ks.accel_twist_world(i);
+            CHECK(va[i].V.x == doctest::Approx(V.x).epsilon(cmp_eps));
+            CHECK(va[i].V.y == doctest::Approx(V.y).epsilon(cmp_eps));
+            CHECK(va[i].V.z == doctest::Approx(V.z).epsilon(cmp_eps));
+            CHECK(va[i].A.x == doctest::Approx(A.x).epsilon(cmp_eps));
+            CHECK(va[i].A.y == doctest::Approx(A.y).epsilon(cmp_eps));
+            CHECK(va[i].A.z == doctest::Approx(A.z).epsilon(cmp_eps));
+
+            auto const v = kinematic_system2dp::point_velocity(X, i, va);
+            auto const a = kinematic_system2dp::point_acceleration(X, i, va);
+            auto const v_ref = ks.point_velocity(X, i);
+            auto const a_ref = ks.point_acceleration(X, i);
+            CHECK(v.x == doctest::Approx(v_ref.x).epsilon(cmp_eps));
+            CHECK(v.y == doctest::Approx(v_ref.y).epsilon(cmp_eps));
+            CHECK(a.x == doctest::Approx(a_ref.x).epsilon(cmp_eps));
+            CHECK(a.y == doctest::Approx(a_ref.y).epsilon(cmp_eps));
+        }
+        // the deepest link spins with the summed relative rates
+        CHECK(va[ks.index_of("L2")].V.z == doctest::Approx(0.7 + 1.1 - 0.6));
+
+        // a buffer shorter than the frame list is rejected
+        std::vector<kinematic_system2dp::world_va2dp> short_va(ks.size() - 1);
+        CHECK_THROWS_AS(ks.world_VA_all(short_va), std::runtime_error);
+        fmt::println("");
+    }
+
+    TEST_CASE("pga2dp: kinematic_system2dp - batch point velocity / acceleration")
+    {
+        fmt::println("pga2dp: kinematic_system2dp - batch point velocity / acceleration");
+
+        // a spinning, accelerating turntable on a moving platform; a block of markers
+        kinematic_system2dp ks;
+        ks.add_frame(static_frame2dp{});
+        ks.add_frame(static_frame2dp("P"s, vec2dp{1, 2, 1}, 0.3),
+                     kin_state2dp{.vel = vec2dp{0.2, -0.1, 0.0}, .omega = 0.7});
+        ks.add_frame(static_frame2dp("T"s, vec2dp{0.5, 0, 1}, -0.4),
+                     kin_state2dp{.acc = vec2dp{0.0, 0.3, 0.0}, .omega = 1.1,
+                                  .alpha = 0.5});
+        size_t const T = ks.index_of("T");
+
+        size_t const n = 29; // odd size: exercises any vector-loop remainder
+        std::vector<vec2dp> pts(n);
+        std::vector<value_t> X_mem(3 * n), v_mem(3 * n), a_mem(3 * n);
+        auto X = vec_block2dp(X_mem.data(), 3, n);
+        for (size_t i = 0; i < n; ++i) {
+            value_t const t = 0.41 * value_t(i);
+            pts[i] = vec2dp{std::cos(t), 0.5 * std::sin(3 * t), i == 4 ? 2.0 : 1.0};
+            X[0, i] = pts[i].x;
+            X[1, i] = pts[i].y;
+            X[2, i] = pts[i].z;
+        }
+        auto v = vec_block2dp(v_mem.data(), 3, n);
+        auto a = vec_block2dp(a_mem.data(), 3, n);
+        ks.point_velocity(vec_cblock2dp(X), T, v);
+        ks.point_acceleration(vec_cblock2dp(X), T, a);
+
+        for (size_t i = 0; i < n; ++i) {
+            auto const v_ref = ks.point_velocity(pts[i], T);
+            auto const a_ref = ks.point_acceleration(pts[i], T);
+            CHECK(std::abs(v[0, i] - v_ref.x) < 1e-12);
+            CHECK(std::abs(v[1, i] - v_ref.y) < 1e-12);
+            CHECK(v[2, i] == 0.0);
+            CHECK(std::abs(a[0, i] - a_ref.x) < 1e-12);
+            CHECK(std::abs(a[1, i] - a_ref.y) < 1e-12);
+            CHECK(a[2, i] == 0.0);
+        }
+
+        // blocks of the wrong shape are rejected
+        auto v_short = vec_block2dp(v_mem.data(), 3, n - 1);
+        CHECK_THROWS_AS(ks.point_velocity(vec_cblock2dp(X), T, v_short),
+                        std::invalid_argument);
+        // ... and so is in-place use (out sharing storage with X)
+        CHECK_THROWS_AS(ks.point_velocity(vec_cblock2dp(X), T, X), std::invalid_argument);
+        CHECK_THROWS_AS(ks.point_acceleration(vec_cblock2dp(X), T, X),
+                        std::invalid_argument);
+        fmt::println("");
+    }
+
     // TODO: show more complex setups
     //
     //       - combined rotation and translation
@@ -3460,6 +3751,241 @@ TEST_SUITE("PGA2DP: physics tests implementation")
         fmt::println("");
     }
 
+    TEST_CASE("pga2dp: dynamic_system2dp - adaptive DP54 integrator (M3)")
+    {
+        fmt::println("pga2dp: dynamic_system2dp - adaptive DP54 integrator (M3)");
+
+        // The same double pendulum as above, once with RK4 at a small fixed dt (the
+        // reference) and once with the error-controlled DP54: there step(dt) is only the
+        // OUTPUT interval, so a coarse dt = 0.05 must reproduce the fine RK4 trajectory
+        // sample by sample, with the energy conserved to the same level.
+        value_t const m = 1.0, w = 2.0, h = 2.0;
+        vec2dp const Q{1.0, 1.0, 1.0};
+        auto build = [&](integrator_kind k) {
+            dynamic_system2dp sys;
+            sys.set_integrator(k);
+            sys.add_frame(static_frame2dp("W"));
+            sys.add_revolute_body(static_frame2dp("B1", vec2dp{0.0, 0.0, 1.0}, 0.0),
+                                  make_plate_body(m, w, h), Q, 2.0, 1.0);
+            sys.add_revolute_body(static_frame2dp("B2", vec2dp{-2.0, -2.0, 1.0}, 0.0),
+                                  make_plate_body(m, w, h), Q, -1.5, -2.0,
+                                  sys.index_of("B1"));
+            return sys;
+        };
+        auto ref = build(integrator_kind::rk4);
+        auto dp = build(integrator_kind::dp54);
+        CHECK(dp.get_integrator() == integrator_kind::dp54);
+        dp.set_tolerances(1.0e-11, 1.0e-10);
+        CHECK_THROWS_AS(dp.set_tolerances(0.0, 0.0), std::invalid_argument);
+        size_t const B1 = ref.index_of("B1"), B2 = ref.index_of("B2");
+
+        value_t const dt_out = 0.05, dt_ref = 0.0002;
+        size_t const n_sub = size_t(dt_out / dt_ref + 0.5);
+        value_t const E0 = dp.total_energy();
+        value_t max_dphi = 0.0, max_dE = 0.0;
+        for (size_t n = 0; n < 20; ++n) { // 1 s
+            for (size_t i = 0; i < n_sub; ++i)
+                ref.step(dt_ref);
+            dp.step(dt_out);
+            max_dphi = std::max({max_dphi, std::abs(dp.joint_phi(B1) - ref.joint_phi(B1)),
+                                 std::abs(dp.joint_phi(B2) - ref.joint_phi(B2))});
+            max_dE = std::max(max_dE, std::abs(dp.total_energy() - E0));
+        }
+        fmt::println("  max |phi_dp54 - phi_rk4| = {:.2e}, max |E - E0| = {:.2e}",
+                     max_dphi, max_dE);
+        CHECK(max_dphi < 1.0e-8);
+        CHECK(max_dE < 1.0e-6 * std::abs(E0));
+        fmt::println("");
+    }
+
+    TEST_CASE("pga2dp: dynamic_system2dp - implicit SDIRK3 on a stiff joint spring (M3)")
+    {
+        fmt::println(
+            "pga2dp: dynamic_system2dp - implicit SDIRK3 on a stiff joint spring (M3)");
+
+        // The double pendulum again, but the second hinge is a stiff bushing
+        // (k = 1e7, lightly damped): a ~4000 rad/s mode riding on the slow swing.
+        // Explicit RK4 must resolve that mode (stable only for dt < ~7e-4); the L-stable
+        // SDIRK3 runs at dt = 1e-3, damps the unresolved mode and follows the slow
+        // motion of a fine-dt RK4 reference.
+        value_t const m = 1.0, w = 2.0, h = 2.0;
+        vec2dp const Q{1.0, 1.0, 1.0};
+        auto build = [&](integrator_kind k) {
+            dynamic_system2dp sys;
+            sys.set_integrator(k);
+            sys.add_frame(static_frame2dp("W"));
+            sys.add_revolute_body(static_frame2dp("B1", vec2dp{0.0, 0.0, 1.0}, 0.0),
+                                  make_plate_body(m, w, h), Q, 0.5, 0.0);
+            sys.add_revolute_body(static_frame2dp("B2", vec2dp{-2.0, -2.0, 1.0}, 0.0),
+                                  make_plate_body(m, w, h), Q, 0.0, 0.0,
+                                  sys.index_of("B1"));
+            sys.set_joint_spring_damper(sys.index_of("B2"), 1.0e7, 10.0);
+            return sys;
+        };
+        auto ref = build(integrator_kind::rk4);
+        auto sd = build(integrator_kind::sdirk3);
+        auto rk = build(integrator_kind::rk4);
+        size_t const B1 = ref.index_of("B1"), B2 = ref.index_of("B2");
+
+        value_t const dt = 1.0e-3, dt_ref = 1.0e-5;
+        size_t const n_sub = size_t(dt / dt_ref + 0.5);
+        value_t max_dphi = 0.0;
+        for (size_t n = 0; n < 500; ++n) { // 0.5 s
+            for (size_t i = 0; i < n_sub; ++i)
+                ref.step(dt_ref);
+            sd.step(dt);
+            max_dphi = std::max(max_dphi, std::abs(sd.joint_phi(B1) - ref.joint_phi(B1)));
+            if (n < 50 && std::abs(rk.joint_phi(B2)) < 1.0) rk.step(dt); // until blow-up
+        }
+        fmt::println(
+            "  SDIRK3 @ dt = 1e-3: max |phi1 - phi1_ref| = {:.2e}, phi2 = {:.2e}",
+            max_dphi, sd.joint_phi(B2));
+        fmt::println("  RK4    @ dt = 1e-3: |phi2| = {:.2e} within 0.05 s",
+                     std::abs(rk.joint_phi(B2)));
+        CHECK(max_dphi < 1.0e-6);                   // the slow swing is reproduced
+        CHECK(std::abs(sd.joint_phi(B2)) < 1.0e-5); // the bushing only deflects slightly
+        CHECK(!(std::abs(rk.joint_phi(B2)) < 1.0)); // RK4 at the same dt diverges
+        fmt::println("");
+    }
+
+    TEST_CASE("pga2dp: dynamic_system2dp - articulated-body forward dynamics (M3)")
+    {
+        fmt::println("pga2dp: dynamic_system2dp - articulated-body forward dynamics (M3)");
+
+        // The O(n) articulated-body algorithm (fd_method2dp::aba) must reproduce the
+        // joint accelerations of the dense mass-matrix path on a branched tree with all
+        // force elements: gravity, revolute + prismatic joints, a driven (moving-base)
+        // joint, a joint spring/damper, an applied wrench on a massless frame and a
+        // grounded spring.
+        //
+        //   W -- A (rev) -- B (rev) -- C (prism)
+        //        |          +-- T (plain frame, applied wrench)
+        //        +-- D (driven rev) -- E (rev, spring/damper, grounded spring)
+        //
+        auto build = [](fd_method2dp m) {
+            dynamic_system2dp sys;
+            sys.set_forward_dynamics(m);
+            sys.add_frame(static_frame2dp("W"));
+            auto const plate = make_plate_body(1.0, 0.6, 0.3);
+            vec2dp const Q{-0.5, 0.0, 1.0}; // hinge point at the link's left end
+            sys.add_revolute_body(static_frame2dp("A", vec2dp{0.5, 0.0, 1.0}, 0.0), plate,
+                                  Q, 0.3, 0.8, 0);
+            sys.add_revolute_body(static_frame2dp("B", vec2dp{1.0, 0.0, 1.0}, 0.0), plate,
+                                  Q, -0.7, 1.5, sys.index_of("A"));
+            sys.add_prismatic_body(static_frame2dp("C", vec2dp{0.0, 0.6, 1.0}, 0.0), plate,
+                                   vec2dp{0.0, 1.0, 0.0}, 0.1, -0.4, sys.index_of("B"));
+            sys.add_frame(static_frame2dp("T", vec2dp{0.2, 0.3, 1.0}, 0.0),
+                          sys.index_of("B"));
+            sys.add_revolute_body(static_frame2dp("D", vec2dp{0.0, -0.5, 1.0}, 0.0),
+                                  make_plate_body(0.5, 0.2, 0.2), O_2dp, 0.0, 0.0, 0);
+            sys.add_revolute_body(static_frame2dp("E", vec2dp{0.8, 0.0, 1.0}, 0.0), plate,
+                                  vec2dp{-0.4, 0.0, 1.0}, 0.9, -1.1, sys.index_of("D"));
+            sys.set_driven_rate(sys.index_of("D"), 2.5);
+            sys.set_joint_spring_damper(sys.index_of("E"), 15.0, 0.3, 0.2);
+            sys.set_applied_wrench(sys.index_of("T"), [](value_t t) {
+                return wdg(vec2dp{0.3, 0.2, 1.0}, vec2dp{std::sin(t), 0.5, 0.0});
+            });
+            sys.add_grounded_spring(sys.index_of("E"), vec2dp{0.4, 0.0, 1.0},
+                                    vec2dp{30.0, 10.0, 0.0}, 0.5);
+            return sys;
+        };
+
+        auto dense = build(fd_method2dp::dense);
+        auto aba = build(fd_method2dp::aba);
+        CHECK(aba.get_forward_dynamics() == fd_method2dp::aba);
+
+        std::vector<size_t> const dofs{aba.index_of("A"), aba.index_of("B"),
+                                       aba.index_of("C"), aba.index_of("E")};
+
+        // identical accelerations at the initial state, and along a common trajectory
+        value_t max_diff = 0.0;
+        for (int n = 0; n < 200; ++n) {
+            for (size_t j : dofs) {
+                value_t const qdd_d = dense.joint_accel(j);
+                value_t const qdd_a = aba.joint_accel(j);
+                max_diff = std::max(max_diff, std::abs(qdd_d - qdd_a) /
+                                                  std::max(1.0, std::abs(qdd_d)));
+            }
+            dense.step(1.0e-3);
+            aba.step(1.0e-3);
+        }
+        value_t max_dq = 0.0;
+        for (size_t j : dofs)
+            max_dq = std::max(max_dq, std::abs(dense.joint_phi(j) - aba.joint_phi(j)));
+        fmt::println("  max rel. q-ddot diff = {:.2e}, max q diff after 0.2 s = {:.2e}",
+                     max_diff, max_dq);
+        CHECK(max_diff < 1e-10);
+        CHECK(max_dq < 1e-10);
+
+        fmt::println("");
+    }
+
+    TEST_CASE("pga2dp: dynamic_system2dp - CRBA mass matrix + tree-sparse LTDL (M3)")
+    {
+        fmt::println("pga2dp: dynamic_system2dp - CRBA mass matrix + tree-sparse LTDL (M3)");
+
+        // The composite-rigid-body mass matrix has the sparsity of the joint tree: the
+        // coordinates of different branches do not couple. The tree-sparse LTDL
+        // factorization exploits exactly that and must agree with the dense LU solve.
+        //
+        //   W -- A (rev) -- B (rev) -- C (prism)
+        //   +--- E (rev)
+        //
+        dynamic_system2dp sys;
+        sys.add_frame(static_frame2dp("W"));
+        auto const plate = make_plate_body(1.0, 0.6, 0.3);
+        vec2dp const Q{-0.5, 0.0, 1.0};
+        sys.add_revolute_body(static_frame2dp("A", vec2dp{0.5, 0.0, 1.0}, 0.0), plate, Q,
+                              0.3, 0.8, 0);
+        sys.add_revolute_body(static_frame2dp("B", vec2dp{1.0, 0.0, 1.0}, 0.0), plate, Q,
+                              -0.7, 1.5, sys.index_of("A"));
+        sys.add_prismatic_body(static_frame2dp("C", vec2dp{0.0, 0.6, 1.0}, 0.0), plate,
+                               vec2dp{0.0, 1.0, 0.0}, 0.1, -0.4, sys.index_of("B"));
+        sys.add_revolute_body(static_frame2dp("E", vec2dp{0.0, -1.0, 1.0}, 0.0), plate,
+                              Q, 0.9, -1.1, 0);
+
+        std::vector<size_t> const dofs{sys.index_of("A"), sys.index_of("B"),
+                                       sys.index_of("C"), sys.index_of("E")};
+        size_t const n = dofs.size();
+        REQUIRE(sys.mass_matrix().size() == n * n);
+        auto const M = sys.mass_matrix();
+
+        // 1. symmetric, and no coupling between the branches {A, B, C} and {E}
+        for (size_t j = 0; j < n; ++j) {
+            for (size_t k = 0; k < n; ++k) {
+                CHECK(M[j * n + k] == doctest::Approx(M[k * n + j]).epsilon(1e-14));
+            }
+        }
+        for (size_t j = 0; j < 3; ++j) {
+            CHECK(M[j * n + 3] == 0.0);
+        }
+
+        // 2. kinetic energy identity  1/2 qdot^T M qdot == T
+        value_t qMq = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            for (size_t k = 0; k < n; ++k) {
+                qMq += sys.joint_omega(dofs[j]) * M[j * n + k] * sys.joint_omega(dofs[k]);
+            }
+        }
+        CHECK(0.5 * qMq == doctest::Approx(sys.kinetic_energy()).epsilon(1e-12));
+
+        // 3. tree-sparse LTDL == dense LU (dof parents: A root, B <- A, C <- B, E root)
+        std::vector<size_t> const lambda{0, 0, 1, 3};
+        std::vector<value_t> const b{1.0, -2.0, 0.5, 3.0};
+        auto const x_ltdl = hd::ga::ltdl_solve(M, lambda, b);
+        auto const x_lu = hd::ga::lu_solve(M, b, n);
+        for (size_t k = 0; k < n; ++k) {
+            CHECK(x_ltdl[k] == doctest::Approx(x_lu[k]).epsilon(1e-12));
+        }
+
+        // 4. a non-positive pivot is rejected (M must be SPD)
+        std::vector<value_t> bad{1.0, 2.0, 2.0, 1.0};
+        CHECK_THROWS_AS(hd::ga::ltdl_decomp(bad, std::vector<size_t>{0, 0}),
+                        hd::ga::Solver_error);
+
+        fmt::println("");
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////
     // dynamic_system2dp -- PRISMATIC joint: the translational DoF, to show the PGA
     // unification. A prismatic slider runs through the SAME machinery as the revolute
@@ -3651,6 +4177,57 @@ TEST_SUITE("PGA2DP: physics tests implementation")
         fmt::println("");
     }
 
+    TEST_CASE("pga2dp: tabulated wrench profiles (built-in, callback-free)")
+    {
+        fmt::println("pga2dp: dynamic_system2dp - tabulated wrench profiles");
+
+        // 2D twin of the 3D check: the forced slider driven once by the closed-form
+        // force F0 cos(Omega t) (callback) and once by a cubic-spline table of it
+        // (built-in profile). The spline error is O(h^4), so both trajectories agree
+        // closely.
+        value_t const mt = 7.35, K = 2000.0, R = 5.0, F0 = 3.0, Om = 12.0;
+        vec2dp const e1{1.0, 0.0, 0.0};
+        auto make = [&]() {
+            dynamic_system2dp s;
+            s.set_gravity(vec2dp{0.0, 0.0, 0.0});
+            s.add_frame(static_frame2dp("W"));
+            s.add_prismatic_body(static_frame2dp("B", vec2dp{0.0, 0.0, 1.0}, 0.0),
+                                 make_plate_body(mt, 1.0, 1.0), e1);
+            s.set_joint_spring_damper(1, K, R);
+            return s;
+        };
+        auto sf = make();
+        sf.set_applied_wrench(1, [=](value_t t) {
+            return wdg(O_2dp, vec2dp{F0 * std::cos(Om * t), 0.0, 0.0});
+        });
+        std::vector<value_t> tk;
+        std::vector<bivec2dp> Wk;
+        for (size_t k = 0; k <= 200; ++k) {
+            tk.push_back(0.01 * value_t(k));
+            Wk.push_back(wdg(O_2dp, vec2dp{F0 * std::cos(Om * tk.back()), 0.0, 0.0}));
+        }
+        auto sp = make();
+        sp.set_applied_wrench(1, wrench_profile2dp(tk, Wk, profile_interp::cubic));
+        value_t max_dq = 0.0, max_q = 0.0;
+        for (size_t n = 0; n < 2000; ++n) {
+            sf.step(1.0e-3);
+            sp.step(1.0e-3);
+            max_dq = std::max(max_dq, std::abs(sf.joint_phi(1) - sp.joint_phi(1)));
+            max_q = std::max(max_q, std::abs(sf.joint_phi(1)));
+        }
+        fmt::println("  cubic table (h = 0.01) vs. callback: max |dq| / max |q| = {:.2e}",
+                     max_dq / max_q);
+        CHECK(max_dq < 1.0e-4 * max_q);
+
+        // a later wrench replaces the earlier one; clearing removes it
+        sp.set_applied_wrench(1, wrench_profile2dp({0.0}, {wdg(O_2dp, e1)}));
+        sp.set_joint_spring_damper(1, 0.0, 0.0);
+        CHECK(sp.joint_accel(1) == doctest::Approx(1.0 / mt));
+        sp.clear_applied_wrench(1);
+        CHECK(sp.joint_accel(1) == 0.0);
+        fmt::println("");
+    }
+
     TEST_CASE(
         "pga2dp: driven joint - spinning radial slider (centrifugal eq., Phase A.3)")
     {
@@ -3746,6 +4323,153 @@ TEST_SUITE("PGA2DP: physics tests implementation")
         fmt::println("");
     }
 
+    TEST_CASE("pga2dp: contact_system2dp - circle broadphase and a bouncing pendulum")
+    {
+        fmt::println("pga2dp: contact_system2dp - broadphase and bouncing pendulum");
+
+        // Gate 1: the sorted-cell-key grid finds exactly the pairs of the O(N^2) check
+        // (600 circles of mixed radii, each on its own frame of a kinematic system).
+        {
+            kinematic_system2dp sys;
+            sys.add_frame(static_frame2dp("W"));
+            penalty_contact2dp pc(1.0e4);
+            std::mt19937 gen(20261016u);
+            std::uniform_real_distribution<value_t> pos(-1.0, 1.0);
+            std::uniform_real_distribution<value_t> rad(0.01, 0.05);
+            size_t const ns = 600;
+            for (size_t s = 0; s < ns; ++s) {
+                vec2dp const p{pos(gen), pos(gen), 1.0};
+                sys.add_frame(static_frame2dp("C" + std::to_string(s), p), 0);
+                pc.add_circle(s + 1, O_2dp, rad(gen));
+            }
+            std::vector<std::pair<size_t, bivec2dp>> out;
+            pc.wrenches(sys, out);
+
+            std::vector<std::pair<size_t, size_t>> brute;
+            for (size_t a = 0; a < ns; ++a) {
+                for (size_t b = a + 1; b < ns; ++b) {
+                    auto const Ca = move2dp(O_2dp, sys.get_pos_trafo(a + 1, 0));
+                    auto const Cb = move2dp(O_2dp, sys.get_pos_trafo(b + 1, 0));
+                    vec2dp const d = Cb - Ca;
+                    value_t const rs = pc.circle(a).radius + pc.circle(b).radius;
+                    if (d.x * d.x + d.y * d.y < rs * rs) brute.emplace_back(a, b);
+                }
+            }
+            fmt::println("  Gate1: {} circles, {} overlapping pairs (grid h = {:.3f})",
+                         ns, pc.contact_pairs().size(), pc.cell_size());
+            CHECK(brute.size() > 10);
+            CHECK(pc.contact_pairs() == brute);
+            CHECK(out.size() == 2 * brute.size()); // at rest: every contact is loaded
+
+            // the cell size is validated like the constructor arguments (0: automatic)
+            pc.set_cell_size(0.5);
+            CHECK_THROWS_AS(pc.set_cell_size(-0.5), std::invalid_argument);
+            CHECK_THROWS_AS(pc.set_cell_size(std::numeric_limits<value_t>::quiet_NaN()),
+                            std::invalid_argument);
+            CHECK_THROWS_AS(pc.set_cell_size(std::numeric_limits<value_t>::infinity()),
+                            std::invalid_argument);
+            CHECK(pc.cell_size() == 0.5);
+            CHECK_NOTHROW(pc.set_cell_size(0.0));
+        }
+
+        // Gate 1b: circles far outside the grid range are clamped into the border cells;
+        // the neighbour probes stay within the grid there, so the pairs remain exact.
+        {
+            kinematic_system2dp sys;
+            sys.add_frame(static_frame2dp("W"));
+            penalty_contact2dp pc(1.0e4);
+            value_t const far = 1.0e10; // ~5e10 cells of h = 0.2 > 2^30
+            vec2dp const p[] = {{far, far, 1.0},
+                                {far + 0.1, far, 1.0},
+                                {-far, -far, 1.0},
+                                {-far, -far - 0.1, 1.0},
+                                {far, -far, 1.0}};
+            for (size_t s = 0; s < std::size(p); ++s) {
+                sys.add_frame(static_frame2dp("C" + std::to_string(s), p[s]), 0);
+                pc.add_circle(s + 1, O_2dp, 0.1);
+            }
+            std::vector<std::pair<size_t, bivec2dp>> out;
+            pc.wrenches(sys, out);
+            std::vector<std::pair<size_t, size_t>> const expected{{0, 1}, {2, 3}};
+            CHECK(pc.contact_pairs() == expected);
+        }
+
+        // Gate 2: a pendulum released horizontally hits a static circle (attached to
+        // the root, frame 0) just past the bottom of its swing. The contact enters the
+        // jointed dynamics through the extra_wrenches() seam at every RK4 stage: the bob
+        // bounces back, and with c = 0 the energy is restored after separation.
+        {
+            value_t const L = 1.0, r = 0.05, R = 0.1;
+            contact_system2dp sys(1.0e5);
+            sys.add_frame(static_frame2dp("W"));
+            // rest pose: the bob (centre = frame origin) at (L, 0), pivot at the origin
+            sys.add_revolute_body(static_frame2dp("B", vec2dp{L, 0.0, 1.0}, 0.0),
+                                  make_disc_body(1.0, r), vec2dp{-L, 0.0, 1.0});
+            sys.add_contact_circle(1, O_2dp, r);
+            sys.add_contact_circle(0, vec2dp{-0.2, -L, 1.0}, R);
+            CHECK_THROWS_AS(penalty_contact2dp(0.0), std::invalid_argument);
+
+            value_t const E0 = sys.total_energy();
+            value_t const dt = 1.0e-4;
+            bool touched = false;
+            value_t omega_min = 0.0, omega_max = 0.0;
+            for (size_t n = 0; n < 8000; ++n) {
+                sys.step(dt);
+                touched = touched || !sys.contacts().contact_pairs().empty();
+                omega_min = std::min(omega_min, sys.joint_omega(1));
+                omega_max = std::max(omega_max, sys.joint_omega(1));
+            }
+            value_t const E1 = sys.total_energy();
+            fmt::println("  Gate2: omega in [{:.4f}, {:.4f}], |E1 - E0| = {:.2e}",
+                         omega_min, omega_max, std::abs(E1 - E0));
+            CHECK(touched);
+            CHECK(omega_min < -1.0); // the downswing (clockwise)
+            CHECK(omega_max > 1.0);  // ... and the rebound
+            CHECK(std::abs(E1 - E0) < 1.0e-3 * 9.81 * L); // vs. the swing energy m g L
+        }
+
+        // Gate 3: an extra wrench on a free body under a jointed parent acts on that body
+        // alone -- a free joint transmits no force to its parent. The hinge must swing
+        // exactly as without the push (dense and ABA paths), while the body moves off.
+        {
+            struct push_child : dynamic_system2dp {
+                bool on{false};
+                std::vector<std::pair<size_t, bivec2dp>> extra_wrenches() override
+                {
+                    if (!on) return {};
+                    auto const X = move2dp(O_2dp, get_pos_trafo(2, 0));
+                    return {{2, wdg(X, vec2dp{2.0, 0.0, 0.0})}};
+                }
+            };
+            auto const disc = make_disc_body(1.0, 0.05);
+            for (auto const fd : {fd_method2dp::dense, fd_method2dp::aba}) {
+                push_child pushed, idle;
+                pushed.on = true;
+                auto const B = static_frame2dp("B", vec2dp{0.0, -1.0, 1.0}, 0.0);
+                for (push_child* s : {&pushed, &idle}) {
+                    s->set_forward_dynamics(fd);
+                    s->add_frame(static_frame2dp("W"));
+                    s->add_revolute_body(B, disc, vec2dp{0.0, 1.0, 1.0}, 0.3, 0.0);
+                    s->add_body(static_frame2dp("C", vec2dp{0.0, -0.5, 1.0}, 0.0), disc,
+                                kin_state2dp{}, 1);
+                }
+                for (size_t n = 0; n < 500; ++n) {
+                    pushed.step(1.0e-3);
+                    idle.step(1.0e-3);
+                }
+                auto const Xp = move2dp(O_2dp, pushed.get_pos_trafo(2, 0));
+                auto const Xi = move2dp(O_2dp, idle.get_pos_trafo(2, 0));
+                fmt::println("  Gate3: phi = {:.6f} (pushed), {:.6f} (idle), "
+                             "|dX| = {:.4f}",
+                             pushed.joint_phi(1), idle.joint_phi(1), Xp.x - Xi.x);
+                CHECK(pushed.joint_phi(1) == idle.joint_phi(1));
+                CHECK(Xp.x - Xi.x > 0.1);
+            }
+        }
+
+        fmt::println("");
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////
     // closed_loop_system2dp -- Phase 1 (position-level assembly): the planar FOUR-BAR
     // linkage, the canonical 1-DOF closed loop. As a spanning tree it is two branches off
@@ -4007,6 +4731,80 @@ TEST_SUITE("PGA2DP: physics tests implementation")
         fmt::println("");
     }
 
+    TEST_CASE("pga2dp: closed_loop_system2dp - chord projection with warm start")
+    {
+        fmt::println("pga2dp: closed_loop_system2dp - chord projection with warm start");
+
+        // the Phase 3 four-bar, stepped twice: once with the full-Newton projection
+        // (reference) and once with the warm-started chord projection
+        value_t const a = 2.0, b = 3.0, c = std::sqrt(5.0), d = 4.0;
+        auto const link = make_plate_body(1.0, 1.0, 1.0);
+        auto build = [&](closed_loop_system2dp& cl) {
+            cl.add_frame(static_frame2dp("W"));
+            cl.add_revolute_body(static_frame2dp("CR", vec2dp{0.0, 0.0, 1.0}, 0.0), link,
+                                 vec2dp{0.0, 0.0, 1.0}, 1.2, 0.0, cl.index_of("W"));
+            cl.add_revolute_body(static_frame2dp("CO", vec2dp{a, 0.0, 1.0}, 0.0), link,
+                                 vec2dp{0.0, 0.0, 1.0}, -1.4, 0.0, cl.index_of("CR"));
+            cl.add_revolute_body(static_frame2dp("RO", vec2dp{d, 0.0, 1.0}, 0.0), link,
+                                 vec2dp{0.0, 0.0, 1.0}, 2.2, 0.0, cl.index_of("W"));
+            cl.add_loop_constraint(loop_constraint2dp{
+                cl.index_of("CO"), vec2dp{b, 0.0, 1.0}, cl.index_of("RO"),
+                vec2dp{c, 0.0, 1.0}, constraint2dp::coincidence});
+            cl.assemble(/*driven*/ {cl.index_of("CR")});
+        };
+        closed_loop_system2dp cn, cc;
+        build(cn);
+        build(cc);
+        CHECK(cn.get_projection_method() == projection_method2dp::newton); // default
+        cc.set_projection_method(projection_method2dp::chord);
+
+        value_t const dt = 0.002;
+        size_t const N = 1500; // 3 s
+        value_t const E0 = cc.system().total_energy();
+        value_t dEn = 0.0, dEc = 0.0, gmax = 0.0;
+        size_t warm = 0;
+        for (size_t n = 0; n < N; ++n) {
+            cn.step(dt);
+            cc.step(dt);
+            dEn = std::max(dEn, std::abs(cn.system().total_energy() - E0));
+            dEc = std::max(dEc, std::abs(cc.system().total_energy() - E0));
+            gmax = std::max(gmax, cc.residual_norm());
+            auto const& st = cc.projection_stats();
+            REQUIRE(!st.residual.empty());
+            CHECK(st.residual.back() < 1e-12); // converged in every step
+            if (st.warm_start) ++warm;
+        }
+        auto const& sn = cn.projection_stats();
+        auto const& sc = cc.projection_stats();
+        CHECK(sn.steps == N);
+        CHECK(sc.steps == N);
+
+        // the chord lands on a slightly different point of the constraint manifold than
+        // the min-norm Newton, so the motions agree to the projection tolerance class
+        // only -- with the same energy behaviour and the loop closed
+        value_t dphi = 0.0;
+        for (char const* name : {"CR", "CO", "RO"}) {
+            size_t const j = cc.index_of(name);
+            dphi = std::max(dphi, std::abs(cc.joint_phi(j) - cn.joint_phi(j)));
+        }
+        CHECK(dphi < 1e-3);
+        CHECK(dEc < 2.0 * dEn + 1e-9);
+        CHECK(gmax < 1e-11);
+
+        // the point of the chord: (almost) no Jacobians in the position projection (the
+        // velocity projection's factorization is reused) and fewer iterations
+        CHECK(10 * sc.total_jacobian_evals < sn.total_jacobian_evals);
+        CHECK(sc.total_iterations <= sn.total_iterations);
+        CHECK(warm > 0);
+
+        fmt::println("  newton: {} iterations, {} Jacobians; chord: {} iterations, {} "
+                     "Jacobians, warm start in {} of {} steps; |dphi| = {:.2e}, "
+                     "max|dE| = {:.2e} / {:.2e}",
+                     sn.total_iterations, sn.total_jacobian_evals, sc.total_iterations,
+                     sc.total_jacobian_evals, warm, N, dphi, dEn, dEc);
+        fmt::println("");
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////
     // closed_loop_system2dp -- planar 5-bar (2-RRR) parallel manipulator: the 2D analogue
     // of a delta / Stewart-Gough robot, and the mechanism behind the active_planar_delta
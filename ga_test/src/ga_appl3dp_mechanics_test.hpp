@@ -3,9 +3,13 @@
 
 #include "doctest/doctest.h"
 
+#include <atomic>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <new>
+#include <random>
 
 #include "fmt/format.h"  // formatting
 #include "fmt/ostream.h" // ostream support
@@ -22,6 +26,31 @@ using namespace hd::ga;      // use ga types, constants, etc.
 using namespace hd::ga::ega; // use specific operations of EGA (Euclidean GA)
 using namespace hd::ga::pga; // use specific operations of PGA (Projective GA)
 
+// Allocation-counting test hook: replaces the global operator new of this test
+// executable so a test can assert that a code region performs no heap allocation
+// (see "allocation-free step()" below). Counting only -- allocation itself is malloc.
+namespace {
+std::atomic<size_t> heap_allocations{0};
+}
+
+void* operator new(std::size_t sz)
+{
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(sz == 0 ? 1 : sz)) return p;
+    throw std::bad_alloc();
+}
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC pairs the inlined free() below with the replaced (malloc-based) operator new
+// only by name and reports a false mismatch
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 // PGA3DP physics tests preparation - Inertia matrix for rigid body dynamics
@@ -199,6 +228,74 @@ TEST_SUITE("PGA3DP: physics tests prep")
         CHECK(r6.mz == doctest::Approx(1.0).epsilon(tol));
     }
 
+    TEST_CASE("pga3dp: fixed-size 6x6 LU / LDLT and batched get_inertia_inverse")
+    {
+        fmt::println("pga3dp: fixed-size 6x6 LU / LDLT and batched get_inertia_inverse");
+
+        Inertia3dp<double> I{};
+        I += get_point_inertia(1.0, Vec3dp<double>{1.0, 0.0, 0.0, 1.0});
+        I += get_point_inertia(2.0, Vec3dp<double>{0.0, 1.0, 0.0, 1.0});
+        I += get_point_inertia(1.5, Vec3dp<double>{0.0, 0.0, 1.0, 1.0});
+        I += get_point_inertia(0.5, Vec3dp<double>{1.0, 1.0, 1.0, 1.0});
+
+        // fixed-size LU agrees with the runtime (dextents) LU on the same right-hand side
+        std::array<double, 36> af{};
+        std::vector<double> ad(36);
+        for (size_t k = 0; k < 36; ++k)
+            af[k] = ad[k] = I.data[k];
+        std::array<int, 6> pf{};
+        std::vector<int> pd(6);
+        std::array<double, 6> bf{1.0, -2.0, 0.5, 3.0, 0.25, -1.0};
+        std::vector<double> bd(bf.begin(), bf.end());
+        auto const Af = std::mdspan<double, std::extents<size_t, 6, 6>>(af.data());
+        auto const Pf = std::mdspan<int, std::extents<size_t, 6>>(pf.data());
+        lu_decomp(Af, Pf);
+        lu_backsubs(Af, Pf, std::mdspan<double, std::extents<size_t, 6>>(bf.data()));
+        auto const Ad = std::mdspan<double, std::dextents<size_t, 2>>(ad.data(), 6, 6);
+        auto const Pd = std::mdspan<int, std::dextents<size_t, 1>>(pd.data(), 6);
+        lu_decomp(Ad, Pd);
+        lu_backsubs(Ad, Pd, std::mdspan<double, std::dextents<size_t, 1>>(bd.data(), 6));
+        for (size_t k = 0; k < 6; ++k)
+            CHECK(bf[k] == doctest::Approx(bd[k]).epsilon(1e-12));
+
+        // LDLT on the block-swapped (symmetric) map reproduces the same solution
+        std::array<double, 36> as{};
+        for (size_t r = 0; r < 6; ++r)
+            for (size_t c = 0; c < 6; ++c)
+                as[r * 6 + c] = I.data[((r + 3) % 6) * 6 + c];
+        std::array<double, 6> bs{3.0, 0.25, -1.0, 1.0, -2.0, 0.5}; // P b
+        auto const As = std::mdspan<double, std::extents<size_t, 6, 6>>(as.data());
+        ldlt_decomp(As);
+        ldlt_backsubs(As, std::mdspan<double, std::extents<size_t, 6>>(bs.data()));
+        for (size_t k = 0; k < 6; ++k)
+            CHECK(bs[k] == doctest::Approx(bd[k]).epsilon(1e-10));
+
+        // fixed-size det (static extents) matches the runtime det
+        std::vector<double> dd(I.data.begin(), I.data.end());
+        CHECK(det(I.view()) == doctest::Approx(det(std::mdspan<double, std::dextents<
+                                                       size_t, 2>>(dd.data(), 6, 6)))
+                                   .epsilon(1e-12));
+
+        // batched inverse == one-by-one inverse; size mismatch throws
+        std::vector<Inertia3dp<double>> Is{I, get_cuboid_inertia(2.0, 1.0, 0.5, 0.25)};
+        std::vector<Inertia3dp<double>> Is_inv(2);
+        get_inertia_inverse(std::span<Inertia3dp<double> const>(Is),
+                            std::span<Inertia3dp<double>>(Is_inv));
+        for (size_t b = 0; b < Is.size(); ++b) {
+            auto const ref = get_inertia_inverse(Is[b]);
+            for (size_t k = 0; k < 36; ++k)
+                CHECK(Is_inv[b].data[k] == ref.data[k]);
+        }
+        auto const too_short = std::span<Inertia3dp<double>>(Is_inv).first(1);
+        CHECK_THROWS_AS(
+            get_inertia_inverse(std::span<Inertia3dp<double> const>(Is), too_short),
+            std::invalid_argument);
+
+        // singular map (a single point mass) throws
+        auto const I_sing = get_point_inertia(1.0, Vec3dp<double>{1.0, 0.0, 0.0, 1.0});
+        CHECK_THROWS_AS(get_inertia_inverse(I_sing), std::invalid_argument);
+    }
+
     TEST_CASE("pga3dp: compute_omega_dot - ODE right-hand side")
     {
         fmt::println("pga3dp: compute_omega_dot - ODE right-hand side");
@@ -486,6 +583,53 @@ TEST_SUITE("PGA3DP: physics tests prep")
         fmt::println("");
     }
 
+    TEST_CASE("pga3dp: PrincipalInertia3dp - structured vs dense inertia map")
+    {
+        fmt::println("pga3dp: PrincipalInertia3dp - structured vs dense inertia map");
+
+        auto constexpr eps = 1e-12;
+        auto close = [&](bivec3dp const& a, bivec3dp const& b) {
+            return std::abs(a.vx - b.vx) < eps && std::abs(a.vy - b.vy) < eps &&
+                   std::abs(a.vz - b.vz) < eps && std::abs(a.mx - b.mx) < eps &&
+                   std::abs(a.my - b.my) < eps && std::abs(a.mz - b.mz) < eps;
+        };
+
+        bivec3dp const Om{0.3, -1.2, 0.7, 0.4, 0.1, -0.9}; // (omega | v)
+        bivec3dp const F{0.2, 0.5, -0.1, 1.3, -0.4, 0.6};  // a body-frame wrench
+
+        // with and without the cm offset
+        for (auto const& cm : {O_3dp, vec3dp{0.3, -0.2, 0.5, 1.0}}) {
+            auto const Ip = get_principal_inertia(2.0, 0.4, 0.7, 0.9, cm);
+            auto const I = Ip.dense();
+            auto const I_inv = get_inertia_inverse(I);
+
+            // apply and inverse-apply match the dense 6x6 path ...
+            CHECK(close(Ip(Om), I(Om)));
+            CHECK(close(Ip.inverse(F), I_inv(F)));
+            // ... are inverse to each other ...
+            CHECK(close(Ip.inverse(Ip(Om)), Om));
+            // ... and give the same Euler right-hand side
+            CHECK(close(compute_omega_dot(Ip, F, Om),
+                        compute_omega_dot(I_inv, F, Om, I)));
+        }
+
+        // the cuboid / disc factories carry the structured form of the same map
+        auto const cub = make_cuboid_body(1.5, 1.0, 2.0, 3.0);
+        REQUIRE(cub.Ip.has_value());
+        auto const I_ref = get_cuboid_inertia(1.5, 1.0, 2.0, 3.0);
+        for (size_t k = 0; k < 36; ++k)
+            CHECK(cub.I.data[k] == doctest::Approx(I_ref.data[k]));
+        CHECK(close((*cub.Ip)(Om), I_ref(Om)));
+        CHECK(make_disc_body(3.0, 2.0, 0.5).Ip.has_value());
+
+        // maps without an inverse are rejected
+        CHECK_THROWS_AS(get_principal_inertia(0.0, 1.0, 1.0, 1.0), std::invalid_argument);
+        CHECK_THROWS_AS(get_principal_inertia(1.0, 1.0, 0.0, 1.0), std::invalid_argument);
+        CHECK_THROWS_AS(get_principal_inertia(1.0, 1.0, 1.0, 1.0, vec3dp{1, 0, 0, 0}),
+                        std::invalid_argument);
+        fmt::println("");
+    }
+
 } // TEST_SUITE("PGA3DP: physics tests prep")
 
 
@@ -1221,6 +1365,121 @@ TEST_SUITE("PGA3DP: dynamic_system3dp (M2)")
         fmt::println("");
     }
 
+    TEST_CASE("pga3dp: tabulated wrench profiles + flat force-element registry")
+    {
+        fmt::println("pga3dp: dynamic_system3dp - tabulated wrench profiles");
+
+        auto dist = [](bivec3dp const& a, bivec3dp const& b) {
+            return std::abs(a.vx - b.vx) + std::abs(a.vy - b.vy) + std::abs(a.vz - b.vz) +
+                   std::abs(a.mx - b.mx) + std::abs(a.my - b.my) + std::abs(a.mz - b.mz);
+        };
+
+        // the interpolants: linear between the samples, held outside the table; the
+        // natural cubic spline is exact for a straight line and C2 in between
+        std::vector<value_t> const ts{0.0, 0.5, 1.0, 2.0};
+        std::vector<bivec3dp> Ws;
+        for (value_t t : ts)
+            Ws.push_back(bivec3dp{t, 2.0 * t, 0.0, 1.0 - t, 0.0, 0.5});
+        wrench_profile3dp const lin(ts, Ws);
+        wrench_profile3dp const cub(ts, Ws, profile_interp::cubic);
+        for (value_t t : {-1.0, 0.0, 0.25, 0.7, 1.5, 2.0, 3.0}) {
+            value_t const tc = std::clamp(t, 0.0, 2.0);
+            bivec3dp const ref{tc, 2.0 * tc, 0.0, 1.0 - tc, 0.0, 0.5};
+            CHECK(dist(lin(t), ref) < 1.0e-14);
+            CHECK(dist(cub(t), ref) < 1.0e-14);
+        }
+        std::vector<value_t> tk;
+        std::vector<bivec3dp> sk;
+        for (size_t k = 0; k <= 40; ++k) {
+            tk.push_back(0.05 * value_t(k));
+            sk.push_back(std::sin(tk.back()) * bivec3dp{1.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+        }
+        wrench_profile3dp const sin_lin(tk, sk);
+        wrench_profile3dp const sin_cub(tk, sk, profile_interp::cubic);
+        value_t err_lin = 0.0, err_cub = 0.0;
+        for (value_t t = 0.2; t < 1.8; t += 0.0123) { // away from the natural ends
+            err_lin = std::max(err_lin, std::abs(sin_lin(t).vx - std::sin(t)));
+            err_cub = std::max(err_cub, std::abs(sin_cub(t).vx - std::sin(t)));
+        }
+        fmt::println("  sin(t), h = 0.05: max err linear = {:.2e}, cubic = {:.2e}",
+                     err_lin, err_cub);
+        CHECK(err_lin < 4.0e-4);
+        CHECK(err_cub < 1.0e-6);
+        CHECK_THROWS_AS(wrench_profile3dp(ts, {Ws[0]}), std::invalid_argument);
+        CHECK_THROWS_AS(wrench_profile3dp({0.0, 1.0, 1.0}, {Ws[0], Ws[1], Ws[2]}),
+                        std::invalid_argument);
+        CHECK(dist(wrench_profile3dp{}(1.0), bivec3dp{}) == 0.0);
+
+        // Many loaded pendulums (one per frame, attached in scrambled order), driven by
+        // a wrench ramp: once as built-in linear profiles, once as callbacks evaluating
+        // the same ramp in closed form. A linear profile reproduces a ramp exactly, so
+        // both runs agree to rounding.
+        size_t const nb = 60;
+        auto build = [&](bool use_profile) {
+            dynamic_system3dp s;
+            s.add_frame(static_frame3dp("W"));
+            for (size_t k = 0; k < nb; ++k) {
+                s.add_revolute_body(
+                    static_frame3dp("P" + std::to_string(k), vec3dp{0.0, -0.5, 0.0, 1.0}),
+                    make_cuboid_body(1.0 + 0.01 * value_t(k), 0.1, 1.0, 0.1),
+                    vec3dp{0.0, 0.5, 0.0, 1.0}, vec3dp{0.0, 0.0, 1.0, 0.0},
+                    0.01 * value_t(k), 0.0, 0);
+            }
+            for (size_t m = 0; m < nb; ++m) {
+                size_t const fi = 1 + (m * 37) % nb; // scrambled registration order
+                value_t const F = 0.5 + 0.01 * value_t(fi);
+                vec3dp const P{0.0, -1.0, 0.0, 1.0};
+                if (use_profile) {
+                    s.set_applied_wrench(
+                        fi, wrench_profile3dp(
+                                {0.0, 10.0},
+                                {bivec3dp{}, wdg(P, vec3dp{10.0 * F, 0.0, 0.0, 0.0})}));
+                }
+                else {
+                    s.set_applied_wrench(fi, [F, P](value_t t) {
+                        return wdg(P, vec3dp{F * t, 0.0, 0.0, 0.0});
+                    });
+                }
+            }
+            // grounded springs on every 7th frame, two per frame, added interleaved
+            for (size_t fi = 7; fi < nb; fi += 7)
+                s.add_grounded_spring(fi, vec3dp{0.0, -0.5, 0.0, 1.0},
+                                      vec3dp{20.0, 20.0, 20.0, 0.0}, 0.1);
+            for (size_t fi = 7; fi < nb; fi += 7)
+                s.add_grounded_spring(fi, vec3dp{0.0, 0.0, 0.0, 1.0},
+                                      vec3dp{5.0, 5.0, 5.0, 0.0}, 0.0);
+            return s;
+        };
+        auto sp = build(true);
+        auto sf = build(false);
+        for (size_t n = 0; n < 200; ++n) {
+            sp.step(1.0e-3);
+            sf.step(1.0e-3);
+        }
+        value_t max_dq = 0.0;
+        for (size_t i = 1; i <= nb; ++i)
+            max_dq = std::max(max_dq, std::abs(sp.joint_phi(i) - sf.joint_phi(i)));
+        fmt::println("  {} wrench frames, profile vs. callback: max |dq| = {:.2e}", nb,
+                     max_dq);
+        CHECK(max_dq < 1.0e-12);
+        CHECK(std::abs(sp.joint_omega(nb)) > 1.0e-3); // the ramp acts
+
+        // one wrench per frame: a later one (callback or profile) replaces the earlier
+        dynamic_system3dp s1;
+        s1.set_gravity(vec3dp{0.0, 0.0, 0.0, 0.0});
+        s1.add_frame(static_frame3dp("W"));
+        s1.add_prismatic_body(static_frame3dp("B"), make_cuboid_body(2.0, 1.0, 1.0, 1.0),
+                              vec3dp{1.0, 0.0, 0.0, 0.0});
+        s1.set_applied_wrench(
+            1, [](value_t) { return wdg(O_3dp, vec3dp{4.0, 0.0, 0.0, 0.0}); });
+        s1.set_applied_wrench(
+            1, wrench_profile3dp({0.0}, {wdg(O_3dp, vec3dp{1.0, 0.0, 0.0, 0.0})}));
+        CHECK(s1.joint_accel(1) == doctest::Approx(0.5));
+        s1.clear_applied_wrench(1);
+        CHECK(s1.joint_accel(1) == 0.0);
+        fmt::println("");
+    }
+
     TEST_CASE("pga3dp: driven joint - constant-rate spin kinematics (Phase A.3)")
     {
         fmt::println("pga3dp: dynamic_system3dp - driven joint kinematics (Phase A.3)");
@@ -1254,6 +1513,129 @@ TEST_SUITE("PGA3DP: dynamic_system3dp (M2)")
         fmt::println("");
     }
 
+    TEST_CASE("pga3dp: kinematic_system3dp - world_VA_all single-pass twist sweep")
+    {
+        fmt::println(
+            "pga3dp: kinematic_system3dp - world_VA_all single-pass twist sweep");
+
+        // A branched tree (two arms off one base, one arm three links deep) with
+        // non-zero relative velocity AND acceleration on every link: the single sweep
+        // must reproduce the per-frame queries (twist_world, accel_twist_world,
+        // point_velocity, point_acceleration) for every frame.
+        kinematic_system3dp ks;
+        ks.add_frame(static_frame3dp("W"));
+        ks.add_frame(static_frame3dp("B", vec3dp{0.5, 0.0, 0.2, 1.0},
+                                     vec3dp{0.0, 0.0, 0.3, 0.0}),
+                     kin_state3dp{.vel = vec3dp{0.2, 0.0, 0.0, 0.0},
+                                  .omega = vec3dp{0.0, 0.0, 0.7, 0.0}});
+        ks.add_frame(static_frame3dp("A1", vec3dp{0.0, 1.0, 0.0, 1.0},
+                                     vec3dp{0.4, 0.0, 0.0, 0.0}),
+                     kin_state3dp{.acc = vec3dp{0.0, 0.1, 0.0, 0.0},
+                                  .omega = vec3dp{1.1, 0.0, 0.0, 0.0},
+                                  .alpha = vec3dp{0.0, 0.3, 0.0, 0.0}},
+                     1);
+        ks.add_frame(static_frame3dp("A2", vec3dp{0.0, 0.8, 0.1, 1.0}),
+                     kin_state3dp{.vel = vec3dp{0.0, 0.0, 0.4, 0.0},
+                                  .omega = vec3dp{0.0, -0.6, 0.2, 0.0},
+                                  .alpha = vec3dp{0.5, 0.0, 0.0, 0.0}});
+        ks.add_frame(static_frame3dp("C1", vec3dp{-0.7, 0.0, 0.0, 1.0},
+                                     vec3dp{0.0, 0.2, 0.0, 0.0}),
+                     kin_state3dp{.vel = vec3dp{0.0, 0.3, 0.0, 0.0},
+                                  .omega = vec3dp{0.0, 0.9, 0.0, 0.0}},
+                     1);
+        ks.add_frame(static_frame3dp("A3", vec3dp{0.3, 0.3, 0.0, 1.0}),
+                     kin_state3dp{.omega = vec3dp{0.0, 0.0, -1.3, 0.0}}, 3);
+
+        std::vector<kinematic_system3dp::world_va3dp> va(ks.size());
+        ks.world_VA_all(va);
+
+        auto const X = vec3dp{0.4, -0.2, 0.9, 1.0}; // any world point
+        for (size_t i = 0; i < ks.size(); ++i) {
+            auto const V = ks.twist_world(i);
+            auto const A = ks.accel_twist_world(i);
+            CHECK(to_val(bulk_nrm(va[i].V - V)) < 1e-12);
+            CHECK(to_val(bulk_nrm(va[i].A - A)) < 1e-12);
+            CHECK(to_val(weight_nrm(va[i].V - V)) < 1e-12);
+            CHECK(to_val(weight_nrm(va[i].A - A)) < 1e-12);
+
+            auto const dv = kinematic_system3dp::point_velocity(X, i, va) -
+                            ks.point_velocity(X, i);
+            auto const da = kinematic_system3dp::point_acceleration(X, i, va) -
+                            ks.point_acceleration(X, i);
+            CHECK(to_val(bulk_nrm(dv)) < 1e-12);
+            CHECK(to_val(bulk_nrm(da)) < 1e-12);
+        }
+        // the root is at rest; a deep leaf picks up the whole chain's motion
+        CHECK(to_val(bulk_nrm(va[0].V)) == 0.0);
+        CHECK(to_val(bulk_nrm(va[ks.index_of("A3")].A)) > 0.1);
+
+        // a buffer shorter than the frame list is rejected
+        std::vector<kinematic_system3dp::world_va3dp> short_va(ks.size() - 1);
+        CHECK_THROWS_AS(ks.world_VA_all(short_va), std::runtime_error);
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: kinematic_system3dp - batch point velocity / acceleration")
+    {
+        fmt::println("pga3dp: kinematic_system3dp - batch point velocity / acceleration");
+
+        // a spinning, accelerating arm on a moving base; a block of body-fixed markers
+        kinematic_system3dp ks;
+        ks.add_frame(static_frame3dp("W"));
+        ks.add_frame(static_frame3dp("B", vec3dp{0.5, 0.0, 0.2, 1.0}),
+                     kin_state3dp{.vel = vec3dp{0.2, 0.1, 0.0, 0.0},
+                                  .omega = vec3dp{0.0, 0.3, 0.7, 0.0}});
+        ks.add_frame(static_frame3dp("A", vec3dp{0.0, 1.0, 0.0, 1.0},
+                                     vec3dp{0.4, 0.0, 0.0, 0.0}),
+                     kin_state3dp{.acc = vec3dp{0.0, 0.1, -0.2, 0.0},
+                                  .omega = vec3dp{1.1, 0.0, 0.4, 0.0},
+                                  .alpha = vec3dp{0.0, 0.3, 0.0, 0.0}});
+        size_t const A = ks.index_of("A");
+
+        size_t const n = 37; // odd size: exercises any vector-loop remainder
+        std::vector<vec3dp> pts(n);
+        std::vector<value_t> X_mem(4 * n), v_mem(4 * n), a_mem(4 * n);
+        auto X = vec_block3dp(X_mem.data(), 4, n);
+        for (size_t i = 0; i < n; ++i) {
+            value_t const t = 0.37 * value_t(i);
+            // mixed weights: unitized points and one non-unit weight
+            pts[i] = vec3dp{std::cos(t), std::sin(2 * t), 0.1 * t, i == 5 ? 2.0 : 1.0};
+            X[0, i] = pts[i].x;
+            X[1, i] = pts[i].y;
+            X[2, i] = pts[i].z;
+            X[3, i] = pts[i].w;
+        }
+        auto v = vec_block3dp(v_mem.data(), 4, n);
+        auto a = vec_block3dp(a_mem.data(), 4, n);
+        ks.point_velocity(vec_cblock3dp(X), A, v);
+        ks.point_acceleration(vec_cblock3dp(X), A, a);
+
+        for (size_t i = 0; i < n; ++i) {
+            auto const v_ref = ks.point_velocity(pts[i], A);
+            auto const a_ref = ks.point_acceleration(pts[i], A);
+            CHECK(std::abs(v[0, i] - v_ref.x) < 1e-12);
+            CHECK(std::abs(v[1, i] - v_ref.y) < 1e-12);
+            CHECK(std::abs(v[2, i] - v_ref.z) < 1e-12);
+            CHECK(v[3, i] == 0.0);
+            CHECK(std::abs(a[0, i] - a_ref.x) < 1e-12);
+            CHECK(std::abs(a[1, i] - a_ref.y) < 1e-12);
+            CHECK(std::abs(a[2, i] - a_ref.z) < 1e-12);
+            CHECK(a[3, i] == 0.0);
+        }
+
+        // blocks of the wrong shape are rejected
+        auto v_short = vec_block3dp(v_mem.data(), 4, n - 1);
+        auto X_3row = vec_cblock3dp(X_mem.data(), 3, n);
+        CHECK_THROWS_AS(ks.point_velocity(vec_cblock3dp(X), A, v_short),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(ks.point_acceleration(X_3row, A, v), std::invalid_argument);
+        // ... and so is in-place use (out sharing storage with X)
+        CHECK_THROWS_AS(ks.point_velocity(vec_cblock3dp(X), A, X), std::invalid_argument);
+        CHECK_THROWS_AS(ks.point_acceleration(vec_cblock3dp(X), A, X),
+                        std::invalid_argument);
+        fmt::println("");
+    }
+
     TEST_CASE(
         "pga3dp: driven joint - spinning radial slider (centrifugal eq., Phase A.3)")
     {
@@ -1441,6 +1823,829 @@ TEST_SUITE("PGA3DP: dynamic_system3dp (M3)")
         fmt::println("");
     }
 
+    TEST_CASE("pga3dp: articulated-body forward dynamics matches the dense path (M3)")
+    {
+        fmt::println(
+            "pga3dp: articulated-body forward dynamics matches the dense path (M3)");
+
+        // The O(n) articulated-body algorithm (fd_method3dp::aba) must reproduce the
+        // joint accelerations of the dense mass-matrix path on a branched tree using
+        // every force element: gravity, non-parallel revolute axes, a prismatic slider,
+        // a driven (moving-base) joint, a joint spring/damper, an applied wrench on a
+        // massless frame and a grounded spring.
+        //
+        //   W -- A (rev e3) -- B (rev e1) -- C (prism e2)
+        //        |             +-- T (plain frame, applied wrench)
+        //        +-- D (driven rev e2) -- E (rev e3, spring/damper, grounded spring)
+        //
+        auto build = [](fd_method3dp m) {
+            dynamic_system3dp sys;
+            sys.set_forward_dynamics(m);
+            sys.add_frame(static_frame3dp("W"));
+            auto const cube = make_cuboid_body(1.0, 0.4, 0.3, 0.2);
+            auto const disc = make_disc_body(0.7, 0.3, 0.1);
+            sys.add_revolute_body(static_frame3dp("A", vec3dp{0.5, 0.0, 0.0, 1.0}), cube,
+                                  vec3dp{-0.5, 0.0, 0.0, 1.0}, vec3dp{0, 0, 1, 0}, 0.3,
+                                  0.8, 0);
+            sys.add_revolute_body(static_frame3dp("B", vec3dp{1.0, 0.0, 0.0, 1.0}), disc,
+                                  vec3dp{-0.5, 0.0, 0.0, 1.0}, vec3dp{1, 0, 0, 0}, -0.7,
+                                  1.5, sys.index_of("A"));
+            sys.add_prismatic_body(static_frame3dp("C", vec3dp{0.0, 0.6, 0.0, 1.0}),
+                                   cube, vec3dp{0, 1, 0, 0}, 0.1, -0.4,
+                                   sys.index_of("B"));
+            sys.add_frame(static_frame3dp("T", vec3dp{0.2, 0.0, 0.3, 1.0}),
+                          sys.index_of("B"));
+            sys.add_revolute_body(static_frame3dp("D", vec3dp{0.0, -0.5, 0.0, 1.0}), disc,
+                                  O_3dp, vec3dp{0, 1, 0, 0}, 0.0, 0.0, 0);
+            sys.add_revolute_body(static_frame3dp("E", vec3dp{0.8, 0.0, 0.0, 1.0}), cube,
+                                  vec3dp{-0.4, 0.0, 0.0, 1.0}, vec3dp{0, 0, 1, 0}, 0.9,
+                                  -1.1, sys.index_of("D"));
+            sys.set_driven_rate(sys.index_of("D"), 2.5);
+            sys.set_joint_spring_damper(sys.index_of("E"), 15.0, 0.3, 0.2);
+            sys.set_applied_wrench(sys.index_of("T"), [](value_t t) {
+                return wdg(vec3dp{0.3, 0.2, 0.1, 1.0},
+                           vec3dp{std::sin(t), 0.5, -0.2, 0.0});
+            });
+            sys.add_grounded_spring(sys.index_of("E"), vec3dp{0.4, 0.0, 0.0, 1.0},
+                                    vec3dp{30.0, 10.0, 20.0, 0.0}, 0.5);
+            return sys;
+        };
+
+        auto dense = build(fd_method3dp::dense);
+        auto aba = build(fd_method3dp::aba);
+        CHECK(aba.get_forward_dynamics() == fd_method3dp::aba);
+
+        std::vector<size_t> const dofs{aba.index_of("A"), aba.index_of("B"),
+                                       aba.index_of("C"), aba.index_of("E")};
+
+        // identical accelerations at the initial state, and along a common trajectory
+        value_t max_diff = 0.0;
+        for (int n = 0; n < 200; ++n) {
+            for (size_t j : dofs) {
+                value_t const qdd_d = dense.joint_accel(j);
+                value_t const qdd_a = aba.joint_accel(j);
+                max_diff = std::max(max_diff, std::abs(qdd_d - qdd_a) /
+                                                  std::max(1.0, std::abs(qdd_d)));
+            }
+            dense.step(1.0e-3);
+            aba.step(1.0e-3);
+        }
+        value_t max_dq = 0.0;
+        for (size_t j : dofs)
+            max_dq = std::max(max_dq, std::abs(dense.joint_phi(j) - aba.joint_phi(j)));
+        fmt::println("  max rel. q-ddot diff = {:.2e}, max q diff after 0.2 s = {:.2e}",
+                     max_diff, max_dq);
+        CHECK(max_diff < 1e-10);
+        CHECK(max_dq < 1e-10);
+
+        // a long serial chain (the use case: many revolute links): both paths agree
+        // and the articulated-body path conserves energy on its own
+        auto chain = [](fd_method3dp m, size_t nlinks) {
+            dynamic_system3dp sys;
+            sys.set_forward_dynamics(m);
+            sys.add_frame(static_frame3dp("W"));
+            auto const link = make_cuboid_body(0.1, 0.2, 0.02, 0.02);
+            for (size_t k = 0; k < nlinks; ++k) {
+                vec3dp const axis = (k % 2 == 0) ? vec3dp{0, 0, 1, 0} : vec3dp{1, 0, 0, 0};
+                sys.add_revolute_body(
+                    static_frame3dp("L" + std::to_string(k),
+                                    vec3dp{(k == 0) ? 0.1 : 0.2, 0.0, 0.0, 1.0}),
+                    link, vec3dp{-0.1, 0.0, 0.0, 1.0}, axis, 0.05, 0.0);
+            }
+            return sys;
+        };
+        size_t const nlinks = 40;
+        auto ch_dense = chain(fd_method3dp::dense, nlinks);
+        auto ch_aba = chain(fd_method3dp::aba, nlinks);
+        value_t max_chain = 0.0;
+        for (size_t k = 1; k <= nlinks; ++k) {
+            value_t const qdd_d = ch_dense.joint_accel(k);
+            max_chain = std::max(max_chain, std::abs(qdd_d - ch_aba.joint_accel(k)) /
+                                                std::max(1.0, std::abs(qdd_d)));
+        }
+        // (looser than the tree: the condition number of the dense 40x40 M(q) grows with
+        // the chain length and the LU solve loses digits accordingly; ABA does not)
+        CHECK(max_chain < 1e-6);
+
+        value_t const E0 = ch_aba.total_energy();
+        for (int n = 0; n < 500; ++n)
+            ch_aba.step(2.0e-4);
+        value_t const dE = std::abs(ch_aba.total_energy() - E0);
+        fmt::println("  {}-link chain: max rel. q-ddot diff = {:.2e}, |dE| after 0.1 s = {:.2e}",
+                     nlinks, max_chain, dE);
+        CHECK(dE < 1e-6);
+
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: recursive Newton-Euler inverse dynamics (M3)")
+    {
+        fmt::println("pga3dp: recursive Newton-Euler inverse dynamics (M3)");
+
+        // inverse_dynamics(qdd) returns the joint forces needed on top of the present
+        // force elements to realise qdd. Consistency with the forward dynamics and the
+        // mass matrix: tau(qdd_fd) == 0 and tau(e_k) - tau(0) == column k of M(q).
+        dynamic_system3dp sys;
+        sys.add_frame(static_frame3dp("W"));
+        auto const cube = make_cuboid_body(1.0, 0.4, 0.3, 0.2);
+        sys.add_revolute_body(static_frame3dp("A", vec3dp{0.5, 0.0, 0.0, 1.0}), cube,
+                              vec3dp{-0.5, 0.0, 0.0, 1.0}, vec3dp{0, 0, 1, 0}, 0.4, 1.2);
+        sys.add_revolute_body(static_frame3dp("B", vec3dp{1.0, 0.0, 0.0, 1.0}), cube,
+                              vec3dp{-0.5, 0.0, 0.0, 1.0}, vec3dp{1, 0, 0, 0}, -0.6, 0.7);
+        sys.add_prismatic_body(static_frame3dp("C", vec3dp{0.0, 0.6, 0.0, 1.0}),
+                               make_disc_body(0.5, 0.2, 0.05), vec3dp{0, 1, 0, 0}, 0.2,
+                               -0.3, sys.index_of("A"));
+        sys.set_joint_spring_damper(sys.index_of("C"), 12.0, 0.4);
+        sys.set_applied_wrench(sys.index_of("B"), [](value_t) {
+            return wdg(vec3dp{0.2, 0.1, 0.0, 1.0}, vec3dp{0.0, 0.0, 2.0, 0.0});
+        });
+        sys.add_grounded_spring(sys.index_of("B"), vec3dp{0.5, 0.0, 0.0, 1.0},
+                                vec3dp{5.0, 5.0, 5.0, 0.0}, 0.2);
+        size_t const n = 3;
+
+        // accelerations of the free motion need no additional joint forces
+        std::vector<value_t> qdd_fd(n);
+        for (size_t k = 0; k < n; ++k)
+            qdd_fd[k] = sys.joint_accel(k + 1);
+        auto const tau_fd = sys.inverse_dynamics(qdd_fd);
+        for (size_t k = 0; k < n; ++k)
+            CHECK(std::abs(tau_fd[k]) < 1e-10);
+
+        // unit accelerations recover the columns of the joint-space mass matrix
+        auto const M = sys.mass_matrix();
+        auto const tau0 = sys.inverse_dynamics(std::vector<value_t>(n, 0.0));
+        for (size_t k = 0; k < n; ++k) {
+            std::vector<value_t> e(n, 0.0);
+            e[k] = 1.0;
+            auto const tau_k = sys.inverse_dynamics(e);
+            for (size_t j = 0; j < n; ++j)
+                CHECK(tau_k[j] - tau0[j] == doctest::Approx(M[j * n + k]).epsilon(1e-12));
+        }
+
+        // one acceleration per dof joint is required
+        CHECK_THROWS_AS(sys.inverse_dynamics(std::vector<value_t>(n + 1, 0.0)),
+                        std::runtime_error);
+
+        fmt::println("  tau(0) = ({:.4f}, {:.4f}, {:.4f})", tau0[0], tau0[1], tau0[2]);
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: allocation-free step() (M3)")
+    {
+        fmt::println("pga3dp: allocation-free step() (M3)");
+
+        // All scratch of the stepping hot path lives in a workspace owned by the system:
+        // after the first step has sized it, step() must not touch the heap -- for both
+        // integrators and both forward-dynamics algorithms, on a branched tree with every
+        // force element and a free body.
+        //
+        //   W -- A (rev e3) -- B (rev e1) -- T (plain frame, applied wrench)
+        //   +--- D (driven rev e2) -- E (rev e3, spring/damper, grounded spring)
+        //   +--- F (free body)
+        //
+        auto build = [](fd_method3dp m, integrator_kind k) {
+            dynamic_system3dp sys;
+            sys.set_forward_dynamics(m);
+            sys.set_integrator(k);
+            sys.add_frame(static_frame3dp("W"));
+            auto const cube = make_cuboid_body(1.0, 0.4, 0.3, 0.2);
+            auto const disc = make_disc_body(0.7, 0.3, 0.1);
+            sys.add_revolute_body(static_frame3dp("A", vec3dp{0.5, 0.0, 0.0, 1.0}), cube,
+                                  vec3dp{-0.5, 0.0, 0.0, 1.0}, vec3dp{0, 0, 1, 0}, 0.3,
+                                  0.8, 0);
+            sys.add_revolute_body(static_frame3dp("B", vec3dp{1.0, 0.0, 0.0, 1.0}), disc,
+                                  vec3dp{-0.5, 0.0, 0.0, 1.0}, vec3dp{1, 0, 0, 0}, -0.7,
+                                  1.5, sys.index_of("A"));
+            sys.add_frame(static_frame3dp("T", vec3dp{0.2, 0.0, 0.3, 1.0}),
+                          sys.index_of("B"));
+            sys.add_revolute_body(static_frame3dp("D", vec3dp{0.0, -0.5, 0.0, 1.0}), disc,
+                                  O_3dp, vec3dp{0, 1, 0, 0}, 0.0, 0.0, 0);
+            sys.add_revolute_body(static_frame3dp("E", vec3dp{0.8, 0.0, 0.0, 1.0}), cube,
+                                  vec3dp{-0.4, 0.0, 0.0, 1.0}, vec3dp{0, 0, 1, 0}, 0.9,
+                                  -1.1, sys.index_of("D"));
+            sys.add_body(static_frame3dp("F", vec3dp{0.0, 2.0, 0.0, 1.0}), disc,
+                         kin_state3dp{}, 0);
+            sys.set_driven_rate(sys.index_of("D"), 2.5);
+            sys.set_joint_spring_damper(sys.index_of("E"), 15.0, 0.3, 0.2);
+            sys.set_applied_wrench(sys.index_of("T"), [](value_t t) {
+                return wdg(vec3dp{0.3, 0.2, 0.1, 1.0},
+                           vec3dp{std::sin(t), 0.5, -0.2, 0.0});
+            });
+            sys.add_grounded_spring(sys.index_of("E"), vec3dp{0.4, 0.0, 0.0, 1.0},
+                                    vec3dp{30.0, 10.0, 20.0, 0.0}, 0.5);
+            return sys;
+        };
+
+        for (auto m : {fd_method3dp::dense, fd_method3dp::aba}) {
+            for (auto k : {integrator_kind::rk4, integrator_kind::abm2,
+                           integrator_kind::dp54, integrator_kind::sdirk3}) {
+                auto sys = build(m, k);
+                sys.step(1.0e-3); // first step: sizes the workspace (+ integrator state)
+                sys.step(1.0e-3);
+
+                // SDIRK3 refactorizes its Newton matrix on every change of dt: alternate
+                // dt so that path is measured too
+                value_t const dt2 = (k == integrator_kind::sdirk3) ? 0.9e-3 : 1.0e-3;
+                size_t const before = heap_allocations.load();
+                for (int n = 0; n < 100; ++n)
+                    sys.step(n % 2 == 0 ? dt2 : 1.0e-3);
+                size_t const allocs = heap_allocations.load() - before;
+
+                fmt::println("  fd = {}, integrator = {}: {} allocations in 100 steps",
+                             m == fd_method3dp::aba ? "aba" : "dense",
+                             k == integrator_kind::abm2     ? "abm2"
+                             : k == integrator_kind::dp54   ? "dp54"
+                             : k == integrator_kind::sdirk3 ? "sdirk3"
+                                                            : "rk4",
+                             allocs);
+                CHECK(allocs == 0);
+            }
+        }
+
+        // the parallel free-body mode (set_free_body_threads) keeps its workers in a
+        // persistent pool, so its steady-state step() is allocation-free as well
+        {
+            auto sys = build(fd_method3dp::dense, integrator_kind::rk4);
+            for (size_t k = 0; k < 100; ++k) {
+                value_t const t = value_t(k);
+                sys.add_body(static_frame3dp("P" + std::to_string(k),
+                                             vec3dp{std::cos(t), std::sin(t), 0.0, 1.0}),
+                             make_cuboid_body(0.5, 0.1, 0.2, 0.3),
+                             kin_state3dp{.omega = vec3dp{0.3, 3.0, 0.1, 0.0}}, 0);
+            }
+            sys.set_free_body_threads(4);
+            sys.step(1.0e-3); // first step: sizes the workspace, starts the workers
+            sys.step(1.0e-3);
+
+            size_t const before = heap_allocations.load();
+            for (int n = 0; n < 100; ++n)
+                sys.step(1.0e-3);
+            size_t const allocs = heap_allocations.load() - before;
+
+            fmt::println("  101 free bodies on 4 threads: {} allocations in 100 steps",
+                         allocs);
+            CHECK(allocs == 0);
+        }
+
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: implicit SDIRK3 on a stiff grounded spring (M3)")
+    {
+        fmt::println("pga3dp: implicit SDIRK3 on a stiff grounded spring (M3)");
+
+        // A cuboid pendulum (hinge e3 at the world origin, cm 0.5 along e1) whose far end
+        // is held by a stiff grounded bushing (k = 1e7) and kicked with omega0 = 1. The
+        // bushing mode (~5000 rad/s) is far beyond dt = 1e-3: explicit RK4 blows up,
+        // the L-stable SDIRK3 damps the mode out and settles at the static deflection
+        //   phi_eq = -m g r_cm / (k l^2)   (gravity -e2, small angle).
+        value_t const m = 1.0, k = 1.0e7, l = 1.0, r_cm = 0.5, g = 9.81;
+        auto build = [&](integrator_kind kind) {
+            dynamic_system3dp sys;
+            sys.set_integrator(kind);
+            sys.add_frame(static_frame3dp("W"));
+            sys.add_revolute_body(static_frame3dp("A", vec3dp{r_cm, 0.0, 0.0, 1.0}),
+                                  make_cuboid_body(m, 0.4, 0.3, 0.2),
+                                  vec3dp{-r_cm, 0.0, 0.0, 1.0}, vec3dp{0, 0, 1, 0}, 0.0,
+                                  1.0, 0);
+            sys.add_grounded_spring(sys.index_of("A"), vec3dp{l - r_cm, 0.0, 0.0, 1.0},
+                                    vec3dp{k, k, k, 0.0}, 1.0);
+            return sys;
+        };
+        auto sd = build(integrator_kind::sdirk3);
+        auto rk = build(integrator_kind::rk4);
+        size_t const A = sd.index_of("A");
+        value_t const E0 = sd.total_energy();
+        for (size_t n = 0; n < 500; ++n) { // 0.5 s at dt = 1e-3
+            sd.step(1.0e-3);
+            if (n < 50 && std::abs(rk.joint_phi(A)) < 1.0) rk.step(1.0e-3);
+        }
+        value_t const phi_eq = -m * g * r_cm / (k * l * l);
+        fmt::println("  SDIRK3: phi = {:.6e} (static {:.6e}), omega = {:.2e}",
+                     sd.joint_phi(A), phi_eq, sd.joint_omega(A));
+        fmt::println("  RK4   : |phi| = {:.2e} within 0.05 s", std::abs(rk.joint_phi(A)));
+        CHECK(sd.joint_phi(A) == doctest::Approx(phi_eq).epsilon(1.0e-3));
+        CHECK(std::abs(sd.joint_omega(A)) < 1.0e-6);
+        CHECK(sd.total_energy() < E0);            // damped, never amplified
+        CHECK(!(std::abs(rk.joint_phi(A)) < 1.0)); // RK4 at the same dt diverges
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: ensemble3dp - parallel perturbed instances (M3)")
+    {
+        fmt::println("pga3dp: ensemble3dp - parallel perturbed instances (M3)");
+
+        // Monte-Carlo setup: one spatial double pendulum with a joint spring as the
+        // shared model, 100 instances with perturbed initial angle, spring constant and
+        // mass. Every instance must reproduce a standalone dynamic_system3dp with the same
+        // parameters exactly, independent of the number of worker threads.
+        auto build = [](value_t q0, value_t k, value_t s) {
+            dynamic_system3dp sys;
+            sys.add_frame(static_frame3dp("W"));
+            auto const rod = make_cuboid_body(1.0, 1.0, 0.1, 0.1);
+            sys.add_revolute_body(static_frame3dp("A", vec3dp{0.5, 0.0, 0.0, 1.0}),
+                                  scale_body3dp(rod, s), vec3dp{-0.5, 0.0, 0.0, 1.0},
+                                  vec3dp{0, 0, 1, 0}, q0, 0.0, 0);
+            sys.add_revolute_body(static_frame3dp("B", vec3dp{1.0, 0.0, 0.0, 1.0}), rod,
+                                  vec3dp{-0.5, 0.0, 0.0, 1.0}, vec3dp{1, 0, 0, 0}, 0.4,
+                                  0.0, sys.index_of("A"));
+            sys.set_joint_spring_damper(sys.index_of("B"), k, 0.0);
+            return sys;
+        };
+        auto const model = build(0.3, 5.0, 1.0);
+        size_t const A = model.index_of("A");
+        size_t const B = model.index_of("B");
+
+        size_t const n = 100;
+        auto q0 = [](size_t i) { return 0.3 + 0.01 * static_cast<value_t>(i); };
+        auto k = [](size_t i) { return 5.0 + 0.1 * static_cast<value_t>(i % 7); };
+        auto s = [](size_t i) { return 1.0 + 0.02 * static_cast<value_t>(i % 5); };
+        auto perturbed = [&]() {
+            ensemble3dp ens(model, n);
+            for (size_t i = 0; i < n; ++i) {
+                ens.set_joint_state(i, A, q0(i), 0.0);
+                ens.set_joint_stiffness(i, B, k(i));
+                ens.set_mass_scale(i, A, s(i));
+            }
+            return ens;
+        };
+
+        auto ens1 = perturbed();
+        auto ens4 = perturbed();
+        CHECK(ens1.size() == n);
+        CHECK(ens1.dof_count() == 2);
+        ens1.step(1.0e-3, 200, 1);
+        ens4.step(1.0e-3, 200, 4);
+        CHECK(ens4.time() == doctest::Approx(0.2).epsilon(1e-12));
+
+        // 1. deterministic: identical per instance for 1 and 4 worker threads
+        bool same = true;
+        for (size_t i = 0; i < n; ++i) {
+            same = same && ens1.joint_phi(i, A) == ens4.joint_phi(i, A) &&
+                   ens1.joint_phi(i, B) == ens4.joint_phi(i, B) &&
+                   ens1.joint_omega(i, A) == ens4.joint_omega(i, A);
+        }
+        CHECK(same);
+
+        // the worker threads and their model copies persist across calls: a repeated
+        // serial step() allocates nothing (its model copy is reused), and 20 repeated
+        // 4-thread calls allocate less than the first call alone (no thread start or model
+        // copy per call; a worker that got no instance yet still sizes its workspace)
+        {
+            auto ens = perturbed();
+            ens.step(1.0e-3, 1, 1);
+            size_t before = heap_allocations.load();
+            ens.step(1.0e-3, 10, 1);
+            size_t const serial = heap_allocations.load() - before;
+            before = heap_allocations.load();
+            ens.step(1.0e-3, 1, 4);
+            size_t const first = heap_allocations.load() - before;
+            before = heap_allocations.load();
+            for (int c = 0; c < 20; ++c)
+                ens.step(1.0e-3, 1, 4);
+            size_t const repeated = heap_allocations.load() - before;
+            fmt::println("  allocations: serial repeat {}, first 4-thread call {}, "
+                         "20 repeats {}",
+                         serial, first, repeated);
+            CHECK(serial == 0);
+            CHECK(repeated < first);
+        }
+
+        // 2. an instance equals the standalone system with its parameters
+        for (size_t i : {size_t(0), size_t(37), size_t(99)}) {
+            auto sys = build(q0(i), k(i), s(i));
+            for (int m = 0; m < 200; ++m)
+                sys.step(1.0e-3);
+            CHECK(ens4.joint_phi(i, A) == sys.joint_phi(A));
+            CHECK(ens4.joint_phi(i, B) == sys.joint_phi(B));
+            CHECK(ens4.joint_omega(i, B) == sys.joint_omega(B));
+        }
+
+        // 3. aggregated statistics, reduced in instance order (thread-count independent)
+        auto const e1 = ens1.energy_stats(1);
+        auto const e4 = ens4.energy_stats(4);
+        CHECK(e1.mean == e4.mean);
+        CHECK(e1.stddev == e4.stddev);
+        CHECK(e1.min <= e1.mean);
+        CHECK(e1.mean <= e1.max);
+
+        auto const col = ens4.joint_phi_column(A); // SoA view, no copy
+        REQUIRE(col.size() == n);
+        value_t sum = 0.0;
+        for (value_t x : col)
+            sum += x;
+        CHECK(ens4.joint_stats(A).mean == doctest::Approx(sum / n).epsilon(1e-14));
+
+        auto const pos = ens4.position_stats(B, 4);
+        auto sys0 = build(q0(0), k(0), s(0));
+        for (int m = 0; m < 200; ++m)
+            sys0.step(1.0e-3);
+        vec3dp const P0 = move3dp(O_3dp, sys0.get_pos_trafo(B, 0));
+        CHECK(pos[0].min <= P0.x);
+        CHECK(P0.x <= pos[0].max);
+        CHECK(pos[2].stddev > 0.0); // the instances really diverge
+
+        // 4. free bodies are not carried per instance
+        dynamic_system3dp with_free;
+        with_free.add_frame(static_frame3dp("W"));
+        with_free.add_body(static_frame3dp("F"), make_disc_body(1.0, 0.3, 0.1));
+        CHECK_THROWS_AS(ensemble3dp(with_free, 4), std::runtime_error);
+
+        // 5. neither is integrator state that carries over between steps: only RK4 models
+        for (auto kind :
+             {integrator_kind::abm2, integrator_kind::dp54, integrator_kind::sdirk3}) {
+            auto other = model;
+            other.set_integrator(kind);
+            CHECK_THROWS_AS(ensemble3dp(other, 4), std::invalid_argument);
+        }
+
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: parallel free-body integration in step() (M3)")
+    {
+        fmt::println("pga3dp: dynamic_system3dp - parallel free-body integration (M3)");
+
+        // A debris scene: one articulated pendulum plus many free tumbling cuboids (one
+        // of them riding on the pendulum link). The free bodies are integrated on worker
+        // threads from a contiguous state block; the result must be BIT-identical to
+        // the serial loop, whatever the thread count.
+        auto build = [](size_t n_threads) {
+            dynamic_system3dp sys;
+            sys.add_frame(static_frame3dp("W"));
+            sys.add_revolute_body(static_frame3dp("A", vec3dp{0.5, 0.0, 0.0, 1.0}),
+                                  make_cuboid_body(1.0, 1.0, 0.1, 0.1),
+                                  vec3dp{-0.5, 0.0, 0.0, 1.0},
+                                  vec3dp{0.0, 1.0, 0.0, 0.0}, 0.4);
+            sys.add_body(static_frame3dp("rider", vec3dp{0.2, 0.0, 0.3, 1.0}),
+                         make_cuboid_body(0.2, 0.1, 0.2, 0.3),
+                         kin_state3dp{.omega = vec3dp{0.5, -1.0, 2.0, 0.0}},
+                         sys.index_of("A"));
+            for (size_t k = 0; k < 150; ++k) {
+                value_t const t = value_t(k);
+                sys.add_body(
+                    static_frame3dp("D" + std::to_string(k),
+                                    vec3dp{std::cos(t), std::sin(t), 0.01 * t, 1.0}),
+                    make_cuboid_body(0.5 + 0.01 * t, 0.1, 0.2 + 0.001 * t, 0.3),
+                    kin_state3dp{.vel = vec3dp{0.1 * std::sin(t), 0.2, 1.0, 0.0},
+                                 .omega = vec3dp{0.3, 3.0 + std::cos(t), 0.1, 0.0}},
+                    0);
+            }
+            sys.set_free_body_threads(n_threads);
+            return sys;
+        };
+
+        auto serial = build(1);
+        auto two = build(2);
+        auto hw = build(0); // one worker per hardware thread
+        CHECK(serial.get_free_body_threads() == 1);
+        CHECK(hw.get_free_body_threads() == 0);
+
+        value_t const dt = 1.0e-3;
+        for (size_t n = 0; n < 100; ++n) {
+            serial.step(dt);
+            two.step(dt);
+            hw.step(dt);
+        }
+
+        size_t mismatches = 0;
+        for (size_t i = 1; i < serial.size(); ++i) {
+            auto const Ms = serial.get_pos_trafo(i, 0);
+            auto const Vs = serial.relative_twist(i);
+            for (auto* other : {&two, &hw}) {
+                auto const Mo = other->get_pos_trafo(i, 0);
+                auto const Vo = other->relative_twist(i);
+                if (Ms != Mo || Vs.vx != Vo.vx || Vs.vy != Vo.vy || Vs.vz != Vo.vz ||
+                    Vs.mx != Vo.mx || Vs.my != Vo.my || Vs.mz != Vo.mz)
+                    ++mismatches;
+            }
+        }
+        fmt::println("  {} frames, serial vs. 2 / hw threads: {} mismatches",
+                     serial.size(), mismatches);
+        CHECK(mismatches == 0);
+        // the debris actually moved (started at (1, 0, 0) with v = (0, 0.2, 1))
+        auto const D0 = move3dp(O_3dp, serial.get_pos_trafo("D0", "W"));
+        CHECK(std::abs(D0.x - 1.0) + std::abs(D0.y) + std::abs(D0.z) > 0.05);
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: fixed_dynamic_system3dp - compile-time 6-DOF arm (M3)")
+    {
+        fmt::println("pga3dp: fixed_dynamic_system3dp - compile-time 6-DOF arm (M3)");
+
+        // A 6-DOF arm (base yaw, shoulder, elbow, telescopic slider, wrist roll, wrist
+        // pitch) built once as a dynamic_system3dp model, then mirrored by the
+        // fixed-topology system whose tree is the template argument list. Both must give
+        // the same mass matrix, joint accelerations and trajectory (to rounding).
+        dynamic_system3dp model;
+        model.add_frame(static_frame3dp("W"));
+        vec3dp const ex{1.0, 0.0, 0.0, 0.0};
+        vec3dp const ey{0.0, 1.0, 0.0, 0.0};
+        vec3dp const ez{0.0, 0.0, 1.0, 0.0};
+        model.add_revolute_body(static_frame3dp("base", vec3dp{0.0, 0.2, 0.0, 1.0}),
+                                make_cuboid_body(3.0, 0.3, 0.4, 0.3),
+                                vec3dp{0.0, -0.2, 0.0, 1.0}, ey, 0.1, 0.5);
+        model.add_revolute_body(static_frame3dp("upper", vec3dp{0.4, 0.2, 0.0, 1.0}),
+                                make_cuboid_body(2.0, 0.8, 0.1, 0.1),
+                                vec3dp{-0.4, 0.0, 0.0, 1.0}, ez, 0.3, -0.2);
+        model.add_revolute_body(static_frame3dp("fore", vec3dp{0.8, 0.0, 0.0, 1.0}),
+                                make_cuboid_body(1.2, 0.8, 0.08, 0.08),
+                                vec3dp{-0.4, 0.0, 0.0, 1.0}, ez, -0.6, 0.1);
+        model.add_prismatic_body(static_frame3dp("slide", vec3dp{0.5, 0.0, 0.0, 1.0}),
+                                 make_cuboid_body(0.5, 0.3, 0.05, 0.05), ex, 0.05, 0.0);
+        model.add_revolute_body(static_frame3dp("roll", vec3dp{0.2, 0.0, 0.0, 1.0}),
+                                make_cuboid_body(0.3, 0.1, 0.1, 0.2),
+                                vec3dp{0.0, 0.0, 0.0, 1.0}, ex, 0.0, 2.0);
+        model.add_revolute_body(static_frame3dp("pitch", vec3dp{0.15, 0.0, 0.0, 1.0}),
+                                make_cuboid_body(0.2, 0.1, 0.05, 0.1),
+                                vec3dp{-0.05, 0.0, 0.0, 1.0}, ez, 0.2, 0.0);
+        model.set_joint_spring_damper(2, 40.0, 0.5, 0.2);  // shoulder
+        model.set_joint_spring_damper(4, 200.0, 1.0, 0.1); // slider
+
+        fixed_dynamic_system3dp<6, 0, 1, 2, 3, 4, 5> arm(model);
+        static_assert(arm.dof_count() == 6 && arm.parent(4) == 3);
+
+        // same mass matrix, accelerations and kinetic energy in the initial state
+        auto const Md = model.mass_matrix();
+        auto const Mf = arm.mass_matrix();
+        value_t max_dM = 0.0;
+        for (size_t k = 0; k < 36; ++k)
+            max_dM = std::max(max_dM, std::abs(Md[k] - Mf[k]));
+        auto const qdd = arm.joint_accel();
+        value_t max_dqdd = 0.0;
+        for (size_t j = 1; j <= 6; ++j)
+            max_dqdd = std::max(max_dqdd, std::abs(model.joint_accel(j) - qdd[j - 1]));
+        fmt::println("  initial state: max |dM| = {:.3e}, max |dq-ddot| = {:.3e}", max_dM,
+                     max_dqdd);
+        CHECK(max_dM < 1.0e-12);
+        CHECK(max_dqdd < 1.0e-10);
+        CHECK(arm.kinetic_energy() == doctest::Approx(model.kinetic_energy()));
+
+        // same trajectory over 0.5 s (coupled, with springs, dampers and a slider)
+        value_t const dt = 1.0e-3;
+        for (size_t n = 0; n < 500; ++n) {
+            model.step(dt);
+            arm.step(dt);
+        }
+        value_t max_dq = 0.0;
+        value_t max_dqd = 0.0;
+        for (size_t j = 1; j <= 6; ++j) {
+            max_dq = std::max(max_dq, std::abs(model.joint_phi(j) - arm.joint_phi(j)));
+            max_dqd =
+                std::max(max_dqd, std::abs(model.joint_omega(j) - arm.joint_omega(j)));
+        }
+        auto const tip_d = move3dp(O_3dp, model.get_pos_trafo(6, 0));
+        auto const tip_f = move3dp(O_3dp, arm.world_motor(6));
+        fmt::println("  after 500 steps: max |dq| = {:.3e}, max |dq-dot| = {:.3e}",
+                     max_dq, max_dqd);
+        CHECK(arm.time() == doctest::Approx(model.time()));
+        CHECK(max_dq < 1.0e-9);
+        CHECK(max_dqd < 1.0e-9);
+        CHECK(std::abs(tip_d.x - tip_f.x) + std::abs(tip_d.y - tip_f.y) +
+                  std::abs(tip_d.z - tip_f.z) <
+              1.0e-9);
+        CHECK(std::abs(model.joint_phi(1) - 0.1) > 0.1); // the arm actually moved
+
+        // a joint torque is a generalised force: a holding torque on the slider against
+        // its spring changes exactly that joint's acceleration by M^-1 tau
+        arm.set_joint_state(4, 0.3, 0.0);
+        auto const a0 = arm.joint_accel();
+        arm.set_joint_torque(4, 200.0 * (0.3 - 0.1));
+        auto const a1 = arm.joint_accel();
+        CHECK(std::abs(a1[3] - a0[3]) > 1.0);
+        arm.set_joint_torque(4, 0.0);
+        CHECK(arm.joint_accel()[3] == doctest::Approx(a0[3]));
+
+        // topology mismatch with the template arguments (a branch, not a chain)
+        CHECK_THROWS_AS((fixed_dynamic_system3dp<6, 0, 1, 2, 3, 4, 3>(model)),
+                        std::runtime_error);
+        CHECK_THROWS_AS((fixed_dynamic_system3dp<5, 0, 1, 2, 3, 4>(model)),
+                        std::runtime_error);
+
+        // joint indices are 1..N (frame 0 is the root, it has no joint)
+        CHECK_THROWS_AS(arm.joint_phi(0), std::runtime_error);
+        CHECK_THROWS_AS(arm.joint_omega(7), std::runtime_error);
+        CHECK_THROWS_AS(arm.set_joint_state(0, 0.0, 0.0), std::runtime_error);
+        CHECK_THROWS_AS(arm.set_joint_spring_damper(7, 1.0, 0.0), std::runtime_error);
+        CHECK_THROWS_AS(arm.set_joint_torque(0, 1.0), std::runtime_error);
+        CHECK_THROWS_AS(arm.joint_torque(7), std::runtime_error);
+        CHECK_NOTHROW(arm.joint_torque(6));
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: contact_system3dp - sphere broadphase and head-on collision (M3)")
+    {
+        fmt::println("pga3dp: contact_system3dp - broadphase and head-on collision");
+
+        // Gate 1: the sorted-cell-key grid finds exactly the pairs of the O(N^2) check.
+        // 400 spheres of mixed radii on 400 frames of a kinematic system, packed densely
+        // enough that a few hundred pairs overlap.
+        {
+            kinematic_system3dp sys;
+            sys.add_frame(static_frame3dp("W"));
+            penalty_contact3dp pc(1.0e4);
+            std::mt19937 gen(20261016u);
+            std::uniform_real_distribution<value_t> pos(-1.0, 1.0);
+            std::uniform_real_distribution<value_t> rad(0.02, 0.1);
+            size_t const ns = 400;
+            for (size_t s = 0; s < ns; ++s) {
+                vec3dp const p{pos(gen), pos(gen), pos(gen), 1.0};
+                sys.add_frame(static_frame3dp("S" + std::to_string(s), p), 0);
+                pc.add_sphere(s + 1, O_3dp, rad(gen));
+            }
+            std::vector<std::pair<size_t, bivec3dp>> out;
+            pc.wrenches(sys, out);
+
+            std::vector<std::pair<size_t, size_t>> brute;
+            for (size_t a = 0; a < ns; ++a) {
+                for (size_t b = a + 1; b < ns; ++b) {
+                    auto const Ca = move3dp(O_3dp, sys.get_pos_trafo(a + 1, 0));
+                    auto const Cb = move3dp(O_3dp, sys.get_pos_trafo(b + 1, 0));
+                    vec3dp const d = Cb - Ca;
+                    value_t const rs = pc.sphere(a).radius + pc.sphere(b).radius;
+                    if (d.x * d.x + d.y * d.y + d.z * d.z < rs * rs) {
+                        brute.emplace_back(a, b);
+                    }
+                }
+            }
+            fmt::println("  Gate1: {} spheres, {} overlapping pairs (grid h = {:.3f})",
+                         ns, pc.contact_pairs().size(), pc.cell_size());
+            CHECK(brute.size() > 10);
+            CHECK(pc.contact_pairs() == brute);
+            CHECK(out.size() == 2 * brute.size()); // at rest: every contact is loaded
+
+            // a coarser grid changes the work, not the result
+            pc.set_cell_size(0.5);
+            out.clear();
+            pc.wrenches(sys, out);
+            CHECK(pc.contact_pairs() == brute);
+
+            // the cell size is validated like the constructor arguments (0: automatic)
+            CHECK_THROWS_AS(pc.set_cell_size(-0.5), std::invalid_argument);
+            CHECK_THROWS_AS(pc.set_cell_size(std::numeric_limits<value_t>::quiet_NaN()),
+                            std::invalid_argument);
+            CHECK_THROWS_AS(pc.set_cell_size(std::numeric_limits<value_t>::infinity()),
+                            std::invalid_argument);
+            CHECK(pc.cell_size() == 0.5);
+            CHECK_NOTHROW(pc.set_cell_size(0.0));
+        }
+
+        // Gate 1b: spheres far outside the grid range are clamped into the border cells;
+        // the neighbour probes stay within the grid there, so the pairs remain exact.
+        {
+            kinematic_system3dp sys;
+            sys.add_frame(static_frame3dp("W"));
+            penalty_contact3dp pc(1.0e4);
+            value_t const far = 1.0e7; // ~5e7 cells of h = 0.2 > 2^20
+            vec3dp const p[] = {{far, far, far, 1.0},      {far + 0.1, far, far, 1.0},
+                                {-far, -far, -far, 1.0},   {-far, -far - 0.1, -far, 1.0},
+                                {far, -far, far + 0.5, 1.0}};
+            for (size_t s = 0; s < std::size(p); ++s) {
+                sys.add_frame(static_frame3dp("S" + std::to_string(s), p[s]), 0);
+                pc.add_sphere(s + 1, O_3dp, 0.1);
+            }
+            std::vector<std::pair<size_t, bivec3dp>> out;
+            pc.wrenches(sys, out);
+            std::vector<std::pair<size_t, size_t>> const expected{{0, 1}, {2, 3}};
+            CHECK(pc.contact_pairs() == expected);
+        }
+
+        // Gate 2: two free spheres collide head-on without gravity. The contact wrenches
+        // are equal and opposite, so the linear momentum is conserved (to rounding); with
+        // c = 0 the contact is elastic and the equal masses swap their velocities. Free
+        // bodies hold the contact wrench over each step (first-order splitting), so the
+        // restitution is only exact to O(omega_c dt) -- about 1% here.
+        {
+            value_t const m = 1.0, r = 0.1, v0 = 1.0;
+            contact_system3dp sys(1.0e4);
+            sys.set_gravity(vec3dp{0.0, 0.0, 0.0, 0.0});
+            sys.add_frame(static_frame3dp("W"));
+            auto const ball = make_cuboid_body(m, 0.1, 0.1, 0.1);
+            sys.add_body(static_frame3dp("A", vec3dp{-0.3, 0.0, 0.0, 1.0}), ball,
+                         kin_state3dp{.vel = vec3dp{v0, 0.0, 0.0, 0.0}}, 0);
+            sys.add_body(static_frame3dp("B", vec3dp{0.3, 0.0, 0.0, 1.0}), ball,
+                         kin_state3dp{.vel = vec3dp{-v0, 0.0, 0.0, 0.0}}, 0);
+            sys.add_contact_sphere(1, O_3dp, r);
+            sys.add_contact_sphere(2, O_3dp, r);
+            CHECK_THROWS_AS(sys.add_contact_sphere(1, O_3dp, 0.0), std::invalid_argument);
+
+            value_t const dt = 1.0e-4;
+            bool touched = false;
+            value_t max_dp = 0.0;
+            for (size_t n = 0; n < 6000; ++n) {
+                sys.step(dt);
+                touched = touched || !sys.contacts().contact_pairs().empty();
+                auto const XA = move3dp(O_3dp, sys.get_pos_trafo(1, 0));
+                auto const XB = move3dp(O_3dp, sys.get_pos_trafo(2, 0));
+                vec3dp const p =
+                    m * sys.point_velocity(XA, 1) + m * sys.point_velocity(XB, 2);
+                max_dp = std::max(max_dp, std::abs(p.x) + std::abs(p.y) + std::abs(p.z));
+            }
+            auto const XA = move3dp(O_3dp, sys.get_pos_trafo(1, 0));
+            auto const XB = move3dp(O_3dp, sys.get_pos_trafo(2, 0));
+            value_t const vA = sys.point_velocity(XA, 1).x;
+            value_t const vB = sys.point_velocity(XB, 2).x;
+            fmt::println("  Gate2: at 0.6 s vA = {:.6f}, vB = {:.6f}, max |p| = {:.2e}",
+                         vA, vB, max_dp);
+            CHECK(touched);
+            CHECK(sys.contacts().contact_pairs().empty()); // separated again
+            CHECK(XB.x - XA.x > 2.0 * r);
+            CHECK(max_dp < 1.0e-10);
+            CHECK(vA == doctest::Approx(-v0).epsilon(0.02));
+            CHECK(vB == doctest::Approx(v0).epsilon(0.02));
+        }
+
+        // Gate 3: both forms of the seam. A subclass overriding only the vector-returning
+        // extra_wrenches() (reached through the default append_extra_wrenches()) and one
+        // overriding append_extra_wrenches() drive the same hinge identically.
+        {
+            bivec3dp const Wp =
+                wdg(vec3dp{0.0, -1.0, 0.0, 1.0}, vec3dp{0.5, 0.0, 0.0, 0.0});
+            struct push_returning : dynamic_system3dp {
+                bivec3dp W;
+                std::vector<std::pair<size_t, bivec3dp>> extra_wrenches() override
+                {
+                    return {{1, W}};
+                }
+            };
+            struct push_appending : dynamic_system3dp {
+                using wrench_list = std::vector<std::pair<size_t, bivec3dp>>;
+                bivec3dp W;
+                void append_extra_wrenches(wrench_list& out) override
+                {
+                    out.emplace_back(1, W);
+                }
+            };
+            auto const cube = make_cuboid_body(1.0, 0.1, 0.1, 0.1);
+            auto build = [&](dynamic_system3dp& s) {
+                s.add_frame(static_frame3dp("W"));
+                s.add_revolute_body(static_frame3dp("B", vec3dp{0.0, -1.0, 0.0, 1.0}),
+                                    cube, vec3dp{0.0, 1.0, 0.0, 1.0},
+                                    vec3dp{0.0, 0.0, 1.0, 0.0}, 0.3, 0.0);
+            };
+            dynamic_system3dp plain;
+            push_returning ret;
+            push_appending app;
+            ret.W = Wp;
+            app.W = Wp;
+            build(plain);
+            build(ret);
+            build(app);
+            for (size_t n = 0; n < 1000; ++n) {
+                plain.step(1.0e-3);
+                ret.step(1.0e-3);
+                app.step(1.0e-3);
+            }
+            fmt::println("  Gate3: phi = {:.6f} (returning), {:.6f} (appending), "
+                         "{:.6f} (no push)",
+                         ret.joint_phi(1), app.joint_phi(1), plain.joint_phi(1));
+            CHECK(ret.joint_phi(1) == app.joint_phi(1));
+            CHECK(std::abs(ret.joint_phi(1) - plain.joint_phi(1)) > 1.0e-3);
+        }
+
+        // Gate 4: an extra wrench on a free body under a jointed parent acts on that body
+        // alone -- a free joint transmits no force to its parent. The hinge must swing
+        // exactly as without the push (dense and ABA paths), while the body moves off.
+        {
+            struct push_child : dynamic_system3dp {
+                bool on{false};
+                std::vector<std::pair<size_t, bivec3dp>> extra_wrenches() override
+                {
+                    if (!on) return {};
+                    auto const X = move3dp(O_3dp, get_pos_trafo(2, 0));
+                    return {{2, wdg(X, vec3dp{2.0, 0.0, 0.0, 0.0})}};
+                }
+            };
+            auto const cube = make_cuboid_body(1.0, 0.1, 0.1, 0.1);
+            for (auto const fd : {fd_method3dp::dense, fd_method3dp::aba}) {
+                push_child pushed, idle;
+                pushed.on = true;
+                auto const B = static_frame3dp("B", vec3dp{0.0, -1.0, 0.0, 1.0});
+                for (push_child* s : {&pushed, &idle}) {
+                    s->set_forward_dynamics(fd);
+                    s->add_frame(static_frame3dp("W"));
+                    s->add_revolute_body(B, cube, vec3dp{0.0, 1.0, 0.0, 1.0},
+                                         vec3dp{0.0, 0.0, 1.0, 0.0}, 0.3, 0.0);
+                    s->add_body(static_frame3dp("C", vec3dp{0.0, -0.5, 0.0, 1.0}), cube,
+                                kin_state3dp{}, 1);
+                }
+                for (size_t n = 0; n < 500; ++n) {
+                    pushed.step(1.0e-3);
+                    idle.step(1.0e-3);
+                }
+                auto const Xp = move3dp(O_3dp, pushed.get_pos_trafo(2, 0));
+                auto const Xi = move3dp(O_3dp, idle.get_pos_trafo(2, 0));
+                fmt::println("  Gate4: phi = {:.6f} (pushed), {:.6f} (idle), "
+                             "|dX| = {:.4f}",
+                             pushed.joint_phi(1), idle.joint_phi(1), Xp.x - Xi.x);
+                CHECK(pushed.joint_phi(1) == idle.joint_phi(1));
+                CHECK(Xp.x - Xi.x > 0.1);
+            }
+        }
+
+        fmt::println("");
+    }
+
 } // TEST_SUITE("PGA3DP: dynamic_system3dp (M3)")
 
 
@@ -1599,6 +2804,180 @@ TEST_SUITE("PGA3DP: closed_loop_system3dp")
         fmt::println("");
     }
 
+    TEST_CASE("pga3dp: closed_loop_system3dp - Schur-complement KKT vs bordered KKT")
+    {
+        fmt::println("pga3dp: closed_loop_system3dp - Schur-complement KKT vs bordered");
+
+        // TWO independent copies of the two-arm loop above, side by side (offset along
+        // e2): 8 revolute joints, 2 loops = 6 constraint rows on disjoint sub-chains, so
+        // the Schur complement is block diagonal. The structured solve must reproduce
+        // the bordered LU's joint accelerations and leg forces, and the same trajectory.
+        value_t const m = 1.0, sgeo = 0.4, L = 1.0;
+        auto const link = make_cuboid_body(m, sgeo, sgeo, sgeo);
+
+        auto build = [&](closed_loop_system3dp& cl) {
+            cl.add_frame(static_frame3dp("W"));
+            for (size_t r = 0; r < 2; ++r) {
+                value_t const y0 = 3.0 * static_cast<value_t>(r);
+                std::string const sfx = std::to_string(r);
+                cl.add_revolute_body(static_frame3dp("S1" + sfx,
+                                                     vec3dp{-1.2, y0, 0.0, 1.0}),
+                                     link, vec3dp{0.0, 0.0, 0.0, 1.0},
+                                     vec3dp{0.0, 0.0, 1.0, 0.0}, 0.8, 0.0,
+                                     cl.index_of("W"));
+                cl.add_revolute_body(static_frame3dp("E1" + sfx,
+                                                     vec3dp{L, 0.0, 0.0, 1.0}),
+                                     link, vec3dp{0.0, 0.0, 0.0, 1.0},
+                                     vec3dp{0.0, 1.0, 0.0, 0.0}, 0.0, 0.0,
+                                     cl.index_of("S1" + sfx));
+                cl.add_revolute_body(static_frame3dp("S2" + sfx,
+                                                     vec3dp{1.2, y0, 0.0, 1.0}),
+                                     link, vec3dp{0.0, 0.0, 0.0, 1.0},
+                                     vec3dp{0.0, 0.0, 1.0, 0.0}, 2.34, 0.0,
+                                     cl.index_of("W"));
+                cl.add_revolute_body(static_frame3dp("E2" + sfx,
+                                                     vec3dp{L, 0.0, 0.0, 1.0}),
+                                     link, vec3dp{0.0, 0.0, 0.0, 1.0},
+                                     vec3dp{0.0, 1.0, 0.0, 0.0}, 0.0, 0.0,
+                                     cl.index_of("S2" + sfx));
+                cl.add_loop_constraint(loop_constraint3dp{
+                    cl.index_of("E1" + sfx), vec3dp{L, 0.0, 0.0, 1.0},
+                    cl.index_of("E2" + sfx), vec3dp{L, 0.0, 0.0, 1.0},
+                    constraint3dp::coincidence});
+            }
+            size_t const E10 = cl.index_of("E10"), E11 = cl.index_of("E11");
+            cl.assemble(/*driven*/ {E10, E11});
+            cl.set_joint_rate(E10, 1.5);
+            cl.set_joint_rate(E11, -0.7);
+            cl.solve_velocities(/*driven*/ {E10, E11});
+        };
+
+        closed_loop_system3dp cs, cb;
+        build(cs);
+        build(cb);
+        CHECK(cs.get_kkt_method() == kkt_method3dp::schur); // the default
+        cb.set_kkt_method(kkt_method3dp::bordered);
+
+        std::vector<value_t> ls, lb;
+        auto const qs = cs.joint_accelerations(&ls);
+        auto const qb = cb.joint_accelerations(&lb);
+        REQUIRE(qs.size() == 8);
+        REQUIRE(ls.size() == 6);
+        REQUIRE(lb.size() == 6);
+        value_t qerr = 0.0, lerr = 0.0, lmax = 0.0;
+        for (size_t k = 0; k < qs.size(); ++k)
+            qerr = std::max(qerr, std::abs(qs[k] - qb[k]));
+        for (size_t c = 0; c < ls.size(); ++c) {
+            lerr = std::max(lerr, std::abs(ls[c] - lb[c]));
+            lmax = std::max(lmax, std::abs(lb[c]));
+        }
+        CHECK(qerr < 1e-10);
+        CHECK(lerr < 1e-10 * std::max(1.0, lmax));
+        CHECK(lmax > 0.1); // the legs genuinely carry load (gravity + spin)
+
+        // the symbolic analysis is reused across steps; trajectories stay together
+        value_t const dt = 1.0e-3;
+        for (size_t n = 0; n < 500; ++n) {
+            cs.step(dt);
+            cb.step(dt);
+        }
+        value_t perr = 0.0;
+        for (std::string const rn : {"S1", "E1", "S2", "E2"}) {
+            for (std::string const sfx : {"0", "1"}) {
+                size_t const j = cs.index_of(rn + sfx);
+                perr = std::max(perr, std::abs(cs.joint_phi(j) - cb.joint_phi(j)));
+            }
+        }
+        CHECK(perr < 1e-8);
+        CHECK(cs.residual_norm() < 1e-9);
+
+        fmt::println("  |dq-ddot| = {:.2e}, |dlambda| = {:.2e} (max |lambda| = {:.3f}), "
+                     "|dphi| after 0.5 s = {:.2e}",
+                     qerr, lerr, lmax, perr);
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: closed_loop_system3dp - chord projection with warm start")
+    {
+        fmt::println("pga3dp: closed_loop_system3dp - chord projection with warm start");
+
+        // the spatial two-arm loop, stepped with the full-Newton position projection
+        // (reference) and with the warm-started chord projection
+        value_t const m = 1.0, sgeo = 0.4, L = 1.0;
+        auto const link = make_cuboid_body(m, sgeo, sgeo, sgeo);
+        auto build = [&](closed_loop_system3dp& cl) {
+            cl.add_frame(static_frame3dp("W"));
+            cl.add_revolute_body(static_frame3dp("S1", vec3dp{-1.2, 0.0, 0.0, 1.0}), link,
+                                 vec3dp{0.0, 0.0, 0.0, 1.0}, vec3dp{0.0, 0.0, 1.0, 0.0},
+                                 0.8, 0.0, cl.index_of("W"));
+            cl.add_revolute_body(static_frame3dp("E1", vec3dp{L, 0.0, 0.0, 1.0}), link,
+                                 vec3dp{0.0, 0.0, 0.0, 1.0}, vec3dp{0.0, 1.0, 0.0, 0.0},
+                                 0.0, 0.0, cl.index_of("S1"));
+            cl.add_revolute_body(static_frame3dp("S2", vec3dp{1.2, 0.0, 0.0, 1.0}), link,
+                                 vec3dp{0.0, 0.0, 0.0, 1.0}, vec3dp{0.0, 0.0, 1.0, 0.0},
+                                 2.34, 0.0, cl.index_of("W"));
+            cl.add_revolute_body(static_frame3dp("E2", vec3dp{L, 0.0, 0.0, 1.0}), link,
+                                 vec3dp{0.0, 0.0, 0.0, 1.0}, vec3dp{0.0, 1.0, 0.0, 0.0},
+                                 0.0, 0.0, cl.index_of("S2"));
+            size_t const E1 = cl.index_of("E1");
+            cl.add_loop_constraint(loop_constraint3dp{E1, vec3dp{L, 0.0, 0.0, 1.0},
+                                                      cl.index_of("E2"),
+                                                      vec3dp{L, 0.0, 0.0, 1.0},
+                                                      constraint3dp::coincidence});
+            cl.assemble(/*driven*/ {E1});
+            cl.set_joint_rate(E1, 1.5);
+            cl.solve_velocities(/*driven*/ {E1});
+        };
+        closed_loop_system3dp cn, cc;
+        build(cn);
+        build(cc);
+        CHECK(cn.get_projection_method() == projection_method3dp::newton); // default
+        cc.set_projection_method(projection_method3dp::chord);
+
+        value_t const dt = 1.0e-3;
+        size_t const N = 2000; // 2 s
+        value_t const E0 = cc.system().total_energy();
+        value_t dEn = 0.0, dEc = 0.0, gmax = 0.0;
+        size_t warm = 0;
+        for (size_t n = 0; n < N; ++n) {
+            cn.step(dt);
+            cc.step(dt);
+            dEn = std::max(dEn, std::abs(cn.system().total_energy() - E0));
+            dEc = std::max(dEc, std::abs(cc.system().total_energy() - E0));
+            gmax = std::max(gmax, cc.residual_norm());
+            auto const& st = cc.projection_stats();
+            REQUIRE(!st.residual.empty());
+            CHECK(st.residual.back() < 1e-12); // converged in every step
+            if (st.warm_start) ++warm;
+        }
+        auto const& sn = cn.projection_stats();
+        auto const& sc = cc.projection_stats();
+        CHECK(sc.steps == N);
+
+        value_t dphi = 0.0;
+        for (char const* name : {"S1", "E1", "S2", "E2"}) {
+            size_t const j = cc.index_of(name);
+            dphi = std::max(dphi, std::abs(cc.joint_phi(j) - cn.joint_phi(j)));
+        }
+        CHECK(dphi < 1e-3);
+        CHECK(dEc < 2.0 * dEn + 1e-9);
+        CHECK(gmax < 1e-11);
+        CHECK(10 * sc.total_jacobian_evals < sn.total_jacobian_evals);
+        CHECK(sc.total_iterations <= sn.total_iterations);
+        CHECK(warm > 0);
+
+        // the per-step report is reset by reset_projection_stats()
+        cc.reset_projection_stats();
+        CHECK(cc.projection_stats().steps == 0);
+
+        fmt::println("  newton: {} iterations, {} Jacobians; chord: {} iterations, {} "
+                     "Jacobians, warm start in {} of {} steps; |dphi| = {:.2e}, "
+                     "max|dE| = {:.2e} / {:.2e}",
+                     sn.total_iterations, sn.total_jacobian_evals, sc.total_iterations,
+                     sc.total_jacobian_evals, warm, N, dphi, dEn, dEc);
+        fmt::println("");
+    }
+
 } // TEST_SUITE("PGA3DP: closed_loop_system3dp")
 
 TEST_SUITE("PGA3DP: coordinate transformation")
@@ -2803,6 +4182,205 @@ TEST_SUITE("PGA3DP: coordinate transformation")
     }
 
 
+    TEST_CASE("pga3dp: static_system3dp - ancestor index and subtree ranges")
+    {
+        fmt::println("pga3dp: static_system3dp - ancestor index and subtree ranges");
+
+        // is_ancestor() is answered from pre-order intervals maintained by add_frame();
+        // it must agree with a plain walk along the parent pointers for every pair, and
+        // subtree(i) must list exactly the frames having i as ancestor, i first. Frames
+        // are attached out of pre-order (later frames branch off early ones) to exercise
+        // the interval update.
+        //
+        //              W[0]
+        //            /  |   \
+        //        A[1]  D[4]  F[6]
+        //        /  \    |     |
+        //     B[2]  C[3] E[5]  G[7] -- H[8]
+        //       \
+        //        I[9]
+        //
+        static_system3dp sys;
+        sys.add_frame(static_frame3dp("W"));
+        std::vector<std::pair<std::string, size_t>> const frames{
+            {"A", 0}, {"B", 1}, {"C", 1}, {"D", 0}, {"E", 4}, {"F", 0}, {"G", 6},
+            {"H", 7}, {"I", 2}};
+        for (auto const& [name, par] : frames) {
+            sys.add_frame(static_frame3dp(name), par);
+        }
+        size_t const n = sys.size();
+
+        auto walk = [&](size_t anc, size_t idx) {
+            for (size_t k = idx;; k = sys.parent(k)) {
+                if (k == anc) return true;
+                if (sys.parent(k) == k) return false; // reached the root
+            }
+        };
+
+        for (size_t a = 0; a < n; ++a) {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i) {
+                CHECK(sys.is_ancestor(a, i) == walk(a, i));
+                if (walk(a, i)) ++count;
+            }
+            auto const sub = sys.subtree(a);
+            CHECK(sub.size() == count);
+            CHECK(sys.subtree_size(a) == count);
+            CHECK(sub.front() == a);
+            for (size_t i : sub) {
+                CHECK(walk(a, i));
+            }
+        }
+        CHECK(sys.subtree(0).size() == n);
+        CHECK(sys.subtree(sys.index_of("B")).size() == 2); // B, I
+        CHECK(sys.subtree(sys.index_of("F")).size() == 3); // F, G, H
+
+        fmt::println("");
+    }
+
+    TEST_CASE("pga3dp: static_system3dp - cached world motors follow set_pose")
+    {
+        fmt::println("pga3dp: static_system3dp - cached world motors follow set_pose");
+
+        // 3D twin of the pga2dp test: the world motors get_pos_trafo(i, 0) and
+        // get_pos_trafo(0, i) come from a cache that set_pose() invalidates for the
+        // re-posed frame and its subtree; it must agree with a freshly built system.
+        //
+        //              rf[0] (root)
+        //              /          \
+        //          A[1]            D[4]
+        //          /   \             |
+        //       B[2]   C[3]         E[5]
+        //
+        auto build = [](std::vector<pose3dp> const& poses) {
+            static_system3dp s;
+            s.add_frame(static_frame3dp("W"));
+            s.add_frame(static_frame3dp("A", poses[0].origin, poses[0].rot), 0);
+            s.add_frame(static_frame3dp("B", poses[1].origin, poses[1].rot), 1);
+            s.add_frame(static_frame3dp("C", poses[2].origin, poses[2].rot), 1);
+            s.add_frame(static_frame3dp("D", poses[3].origin, poses[3].rot), 0);
+            s.add_frame(static_frame3dp("E", poses[4].origin, poses[4].rot), 4);
+            return s;
+        };
+
+        std::vector<pose3dp> poses{{vec3dp{2, 1, -1, 1}, vec3dp{0.1, 0.2, -0.3, 0}},
+                                   {vec3dp{1, 0.5, 2, 1}, vec3dp{-0.4, 0.0, 0.5, 0}},
+                                   {vec3dp{-0.5, 2, 0, 1}, vec3dp{0.0, 0.7, 0.0, 0}},
+                                   {vec3dp{-3, 1, 1, 1}, vec3dp{0.3, -0.3, 0.3, 0}},
+                                   {vec3dp{0.2, -1, 0.5, 1}, vec3dp{1.1, 0.2, 0.0, 0}}};
+        auto sys = build(poses);
+        size_t const n = sys.size();
+
+        auto check_vs_fresh = [&]() {
+            auto fresh = build(poses);
+            for (size_t i = 1; i < n; ++i) {
+                CHECK(is_same_motion(sys.get_pos_trafo(i, 0), fresh.get_pos_trafo(i, 0),
+                                     1e-12));
+                CHECK(is_same_motion(sys.get_pos_trafo(0, i), fresh.get_pos_trafo(0, i),
+                                     1e-12));
+                // cached path composed with the general (LCA) path: i -> j -> world
+                for (size_t j = 1; j < n; ++j) {
+                    CHECK(is_same_motion(
+                        rgpr(sys.get_pos_trafo(j, 0), sys.get_pos_trafo(i, j)),
+                        sys.get_pos_trafo(i, 0), 1e-12));
+                }
+            }
+        };
+
+        check_vs_fresh(); // initial fill of the cache
+
+        // re-pose an interior frame: its whole subtree (B, C) moves, the D-branch not
+        poses[0] = pose3dp{vec3dp{-1, 2.5, 0.5, 1}, vec3dp{0.0, 0.0, 1.3, 0}};
+        sys.set_pose(1, poses[0]);
+        check_vs_fresh();
+
+        // several changes between two queries, leaf and interior in both branches
+        poses[4] = pose3dp{vec3dp{1.5, 0.5, -2, 1}, vec3dp{0.5, 0.5, 0.0, 0}};
+        sys.set_pose(5, poses[4]);
+        poses[3] = pose3dp{vec3dp{0, -2, 1, 1}, vec3dp{-2.0, 0.1, 0.4, 0}};
+        sys.set_pose(4, poses[3]);
+        poses[1] = pose3dp{vec3dp{0.3, 0.3, 0.3, 1}, vec3dp{0.0, 3.0, 0.0, 0}};
+        sys.set_pose(2, poses[1]);
+        check_vs_fresh();
+
+        fmt::println("");
+    }
+
+
+    TEST_CASE("pga3dp: static_system3dp - segment tree of link motors (snake arm)")
+    {
+        fmt::println(
+            "pga3dp: static_system3dp - segment tree of link motors (snake arm)");
+
+        // a 200-segment snake arm (serial chain) with a side branch off segment 50;
+        // one copy answers from the segment tree, the other from the plain cache
+        size_t const nseg = 200;
+        auto pose_of = [](size_t i, value_t q) {
+            value_t const a = 0.05 * static_cast<value_t>(i % 7) + q;
+            return pose3dp{vec3dp{0.1, 0.02 * static_cast<value_t>(i % 3), 0.0, 1.0},
+                           vec3dp{0.3 * a, -0.2 * a, 0.1, 0.0}};
+        };
+        auto build = [&]() {
+            static_system3dp s;
+            s.add_frame(static_frame3dp("W"));
+            for (size_t i = 1; i <= nseg; ++i) {
+                auto const p = pose_of(i, 0.0);
+                s.add_frame(static_frame3dp("L" + std::to_string(i), p.origin, p.rot));
+            }
+            s.add_frame(static_frame3dp("side", vec3dp{0.0, 0.5, 0.0, 1.0},
+                                        vec3dp{0.0, 0.0, 0.2, 0.0}),
+                        s.index_of("L50"));
+            return s;
+        };
+        auto st = build();
+        auto sc = build();
+        size_t const tip = st.index_of("L200");
+        size_t const side = st.index_of("side");
+        st.enable_segment_tree(tip);
+        REQUIRE(st.has_segment_tree());
+        CHECK(st.segment_tree_path().size() == nseg + 1);
+        CHECK(st.segment_tree_path().front() == 0);
+        CHECK(st.segment_tree_path().back() == tip);
+        CHECK(is_same_motion(st.get_pos_trafo(tip, 0), sc.get_pos_trafo(tip, 0), 1e-9));
+
+        // IK-style loop: perturb ONE joint, ask for the tip pose (and a mid-chain pair)
+        for (size_t it = 0; it < 300; ++it) {
+            size_t const j = 1 + (it * 37) % nseg;
+            auto const p = pose_of(j, 0.01 * static_cast<value_t>(it));
+            st.set_pose(j, p);
+            sc.set_pose(j, p);
+            CHECK(is_same_motion(st.get_pos_trafo(tip, 0), sc.get_pos_trafo(tip, 0),
+                                 1e-9));
+            if (it % 50 == 0) {
+                size_t const a = st.index_of("L120"), b = st.index_of("L30");
+                CHECK(is_same_motion(st.get_pos_trafo(a, b), sc.get_pos_trafo(a, b),
+                                     1e-9));
+                CHECK(is_same_motion(st.get_pos_trafo(b, a), sc.get_pos_trafo(b, a),
+                                     1e-9));
+                CHECK(is_same_motion(st.get_pos_trafo(0, tip), sc.get_pos_trafo(0, tip),
+                                     1e-9));
+                // off the path: served by the cache, consistent with the tree
+                CHECK(is_same_motion(st.get_pos_trafo(side, 0),
+                                     sc.get_pos_trafo(side, 0), 1e-9));
+                CHECK(is_same_motion(st.get_pos_trafo(side, tip),
+                                     sc.get_pos_trafo(side, tip), 1e-9));
+            }
+        }
+
+        // a frame added later is off the path; disabling falls back to the cache
+        st.add_frame(static_frame3dp("tool", vec3dp{0.2, 0.0, 0.0, 1.0}), tip);
+        sc.add_frame(static_frame3dp("tool", vec3dp{0.2, 0.0, 0.0, 1.0}), tip);
+        size_t const tool = st.index_of("tool");
+        CHECK(is_same_motion(st.get_pos_trafo(tool, 0), sc.get_pos_trafo(tool, 0), 1e-9));
+        st.disable_segment_tree();
+        CHECK(!st.has_segment_tree());
+        CHECK(is_same_motion(st.get_pos_trafo(tip, 0), sc.get_pos_trafo(tip, 0), 1e-9));
+
+        CHECK_THROWS_AS(st.enable_segment_tree(st.size()), std::runtime_error);
+        fmt::println("");
+    }
+
+
     TEST_CASE("pga3dp: is_close and is_same_motion")
     {
         fmt::println("pga3dp: is_close and is_same_motion");
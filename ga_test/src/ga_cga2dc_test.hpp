@@ -1001,6 +1001,82 @@ TEST_SUITE("CGA 2dc Tests")
         CHECK(is_same_transform(Rc, mvec2dc_e(Rc2)));
     }
 
+    TEST_CASE("cga2dc: batch transformations on spans (caller-owned storage)")
+    {
+        fmt::println("cga2dc: batch transformations on spans (caller-owned storage)");
+
+        // one motor mixing rotation, dilation and translation
+        auto const M = mvec2dc_e(rgpr(rgpr(get_rotation(0.5, -1.0, 0.8),
+                                           get_dilation(1.0, 2.0, 1.5)),
+                                      get_translation(-0.3, 0.7)));
+        std::vector<vec2dc> ps;
+        std::vector<bivec2dc> ds;
+        std::vector<trivec2dc> cs;
+        for (int i = 0; i < 12; ++i) {
+            value_t const a = 0.4 * i;
+            ps.push_back(round_point2dc(std::cos(a), std::sin(a), 0.1 * i));
+            ds.push_back(dipole2dc(0.2 * i, -1.0, 0.5, std::cos(a), std::sin(a)));
+            cs.push_back(circle2dc(1.0 - 0.1 * i, 0.3 * i, 2.0));
+        }
+
+        // out-parameter form agrees with the single-object sandwich
+        std::vector<vec2dc> ps_out(ps.size());
+        transform(ps, M, std::span(ps_out));
+        for (size_t i = 0; i < ps.size(); ++i) {
+            CHECK(is_close(ps_out[i], transform(ps[i], M)));
+        }
+
+        // in-place form
+        auto ds_in = ds;
+        auto cs_in = cs;
+        transform_inplace(std::span(ds_in), M);
+        transform_inplace(std::span(cs_in), M);
+        for (size_t i = 0; i < ds.size(); ++i) {
+            CHECK(is_close(ds_in[i], transform(ds[i], M)));
+            CHECK(is_close(cs_in[i], transform(cs[i], M)));
+        }
+
+        CHECK_THROWS_AS(transform(ps, M, std::span(ps_out).first(5)),
+                        std::invalid_argument);
+    }
+
+    TEST_CASE("cga2dc: closed-form transform_opt (all grades)")
+    {
+        fmt::println("cga2dc: closed-form transform_opt (all grades)");
+
+        // a unit motor mixing rotation, dilation and translation, and an arbitrary
+        // (non-unit) even multivector: the closed form is the exact quadratic map of
+        // the sandwich, so both must agree with transform()
+        auto const M1 = mvec2dc_e(rgpr(rgpr(get_rotation(0.5, -1.0, 0.8),
+                                            get_dilation(1.0, 2.0, 1.5)),
+                                       get_translation(-0.3, 0.7)));
+        auto const M2 = mvec2dc_e(0.3, -1.2, 0.7, 0.25, -0.4, 1.1, -0.6, 0.9);
+        std::vector<vec2dc> ps;
+        std::vector<bivec2dc> ds;
+        std::vector<trivec2dc> cs;
+        for (int i = 0; i < 12; ++i) {
+            value_t const a = 0.4 * i;
+            ps.push_back(round_point2dc(std::cos(a), std::sin(a), 0.1 * i));
+            ds.push_back(dipole2dc(0.2 * i, -1.0, 0.5, std::cos(a), std::sin(a)));
+            cs.push_back(circle2dc(1.0 - 0.1 * i, 0.3 * i, 2.0));
+        }
+
+        for (auto const& M : {M1, M2}) {
+            auto const ps_opt = transform_opt(ps, M);
+            auto const ds_opt = transform_opt(ds, M);
+            auto const cs_opt = transform_opt(cs, M);
+            REQUIRE(ps_opt.size() == ps.size());
+            for (size_t i = 0; i < ps.size(); ++i) {
+                CHECK(is_close(transform_opt(ps[i], M), transform(ps[i], M)));
+                CHECK(is_close(transform_opt(ds[i], M), transform(ds[i], M)));
+                CHECK(is_close(transform_opt(cs[i], M), transform(cs[i], M)));
+                CHECK(is_close(ps_opt[i], transform(ps[i], M)));
+                CHECK(is_close(ds_opt[i], transform(ds[i], M)));
+                CHECK(is_close(cs_opt[i], transform(cs[i], M)));
+            }
+        }
+    }
+
     TEST_CASE("cga2dc: exported extended metric arrays")
     {
         fmt::println("cga2dc: exported extended metric arrays");
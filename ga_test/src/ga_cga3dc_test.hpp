@@ -7,6 +7,7 @@
 
 // include functions to be tested
 #include "ga/ga_cga.hpp"
+#include "ga_simd_test_helpers.hpp" // simd_test::check_product (SIMD backend tests)
 
 using namespace hd::ga;      // use ga types, constants, etc.
 using namespace hd::ga::cga; // use specific operations of CGA (Conformal Algebra)
@@ -693,6 +694,140 @@ TEST_SUITE("CGA 3dc Tests")
         CHECK(is_same_transform(Mc, Rsh));
     }
 
+    TEST_CASE("cga3dc: batch transformations on spans (caller-owned storage)")
+    {
+        fmt::println("cga3dc: batch transformations on spans (caller-owned storage)");
+
+        // one motor mixing rotation, dilation and translation
+        auto const M = rgpr(rgpr(get_rotation(0.0, 1.0, 0.0, 0.6, 0.0, 0.8, 0.9),
+                                 get_dilation(1.0, 0.0, -1.0, 1.5)),
+                            get_translation(0.3, -0.2, 0.5));
+        std::vector<vec3dc> ps;
+        std::vector<bivec3dc> ds;
+        std::vector<trivec3dc> cs;
+        std::vector<quadvec3dc> ss;
+        for (int i = 0; i < 12; ++i) {
+            value_t const a = 0.4 * i;
+            ps.push_back(round_point3dc(std::cos(a), std::sin(a), 0.2 * i, 0.1 * i));
+            ds.push_back(
+                dipole3dc(0.2 * i, -1.0, 0.3, 0.5, 0.0, std::cos(a), std::sin(a)));
+            cs.push_back(
+                circle3dc(1.0, 0.3 * i, -0.5, 2.0, std::sin(a), 0.0, std::cos(a)));
+            ss.push_back(sphere3dc(1.0 - 0.1 * i, 0.5, 0.3 * i, 1.0 + 0.1 * i));
+        }
+
+        // out-parameter form agrees with the single-object sandwich
+        std::vector<vec3dc> ps_out(ps.size());
+        std::vector<quadvec3dc> ss_out(ss.size());
+        transform(ps, M, std::span(ps_out));
+        transform(ss, M, std::span(ss_out));
+        for (size_t i = 0; i < ps.size(); ++i) {
+            CHECK(is_close(ps_out[i], transform(ps[i], M)));
+            CHECK(is_close(ss_out[i], transform(ss[i], M)));
+        }
+
+        // in-place form
+        auto ds_in = ds;
+        auto cs_in = cs;
+        transform_inplace(std::span(ds_in), M);
+        transform_inplace(std::span(cs_in), M);
+        for (size_t i = 0; i < ds.size(); ++i) {
+            CHECK(is_close(ds_in[i], transform(ds[i], M)));
+            CHECK(is_close(cs_in[i], transform(cs[i], M)));
+        }
+
+        CHECK_THROWS_AS(transform(ss, M, std::span(ss_out).first(4)),
+                        std::invalid_argument);
+
+        // precomputed transform object: the matrices are kept for reuse; composition
+        // (xf2 * xf1)(x) == xf2(xf1(x))
+        auto const xf = get_xform(M);
+        auto const T2 = get_translation(-1.0, 0.5, 2.0);
+        for (size_t i = 0; i < ps.size(); ++i) {
+            CHECK(is_close(xf(ps[i]), transform(ps[i], M)));
+            CHECK(is_close(xf(ds[i]), transform(ds[i], M)));
+            CHECK(is_close(xf(cs[i]), transform(cs[i], M)));
+            CHECK(is_close(xf(ss[i]), transform(ss[i], M)));
+            CHECK(is_close((get_xform(T2) * xf)(ps[i]),
+                           transform(transform(ps[i], M), T2)));
+        }
+    }
+
+    TEST_CASE("cga3dc: closed-form transform_opt (all grades)")
+    {
+        fmt::println("cga3dc: closed-form transform_opt (all grades)");
+
+        // a unit motor mixing rotation, dilation and translation, and an arbitrary
+        // (non-unit) odd multivector: the closed form is the exact quadratic map of
+        // the sandwich, so both must agree with transform()
+        auto const M1 = rgpr(rgpr(get_rotation(0.0, 1.0, 0.0, 0.6, 0.0, 0.8, 0.9),
+                                  get_dilation(1.0, 0.0, -1.0, 1.5)),
+                             get_translation(0.3, -0.2, 0.5));
+        auto const M2 = mvec3dc_u(0.3, -1.2, 0.7, 0.25, -0.4, 1.1, -0.6, 0.9, 0.15, -0.8,
+                                  0.45, 1.3, -0.35, 0.6, -1.0, 0.2);
+        std::vector<vec3dc> ps;
+        std::vector<bivec3dc> ds;
+        std::vector<trivec3dc> cs;
+        std::vector<quadvec3dc> ss;
+        for (int i = 0; i < 12; ++i) {
+            value_t const a = 0.4 * i;
+            ps.push_back(round_point3dc(std::cos(a), std::sin(a), 0.2 * i, 0.1 * i));
+            ds.push_back(
+                dipole3dc(0.2 * i, -1.0, 0.3, 0.5, 0.0, std::cos(a), std::sin(a)));
+            cs.push_back(
+                circle3dc(1.0, 0.3 * i, -0.5, 2.0, std::sin(a), 0.0, std::cos(a)));
+            ss.push_back(sphere3dc(1.0 - 0.1 * i, 0.5, 0.3 * i, 1.0 + 0.1 * i));
+        }
+
+        for (auto const& M : {M1, M2}) {
+            auto const ps_opt = transform_opt(ps, M);
+            auto const ds_opt = transform_opt(ds, M);
+            auto const cs_opt = transform_opt(cs, M);
+            auto const ss_opt = transform_opt(ss, M);
+            REQUIRE(ss_opt.size() == ss.size());
+            for (size_t i = 0; i < ps.size(); ++i) {
+                CHECK(is_close(transform_opt(ps[i], M), transform(ps[i], M)));
+                CHECK(is_close(transform_opt(ds[i], M), transform(ds[i], M)));
+                CHECK(is_close(transform_opt(cs[i], M), transform(cs[i], M)));
+                CHECK(is_close(transform_opt(ss[i], M), transform(ss[i], M)));
+                CHECK(is_close(ps_opt[i], transform(ps[i], M)));
+                CHECK(is_close(ds_opt[i], transform(ds[i], M)));
+                CHECK(is_close(cs_opt[i], transform(cs[i], M)));
+                CHECK(is_close(ss_opt[i], transform(ss[i], M)));
+            }
+        }
+    }
+
+    TEST_CASE("cga3dc: SIMD backend for the full multivector products")
+    {
+        fmt::println("cga3dc: SIMD backend for the full multivector products");
+
+        // each SIMD product against its scalar reference (see ga_simd_test_helpers.hpp)
+        simd_test::check_product<MVec3dc>(
+            [](auto const& A, auto const& B) { return gpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return A * B; });
+        simd_test::check_product<MVec3dc>(
+            [](auto const& A, auto const& B) { return wdg_simd(A, B); },
+            [](auto const& A, auto const& B) { return wdg(A, B); });
+        simd_test::check_product<MVec3dc>(
+            [](auto const& A, auto const& B) { return rwdg_simd(A, B); },
+            [](auto const& A, auto const& B) { return rwdg(A, B); });
+        simd_test::check_product<MVec3dc>(
+            [](auto const& A, auto const& B) { return rgpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return rgpr(A, B); });
+
+        // the change of basis of cga3dc halves coefficients: integral value types are
+        // rejected by the requires-clause (they would be truncated), mixed ones are fine
+        auto const has_gpr_simd = [](auto t, auto u) {
+            using T = decltype(t);
+            using U = decltype(u);
+            return requires(MVec3dc<T> const& A, MVec3dc<U> const& B) { gpr_simd(A, B); };
+        };
+        CHECK(has_gpr_simd(0.0, 0.0));
+        CHECK(has_gpr_simd(0.0f, 0));
+        CHECK_FALSE(has_gpr_simd(0, 0));
+    }
+
     TEST_CASE("cga3dc: fmt printing")
     {
         fmt::println("cga3dc: fmt printing");
@@ -790,6 +790,50 @@ TEST_SUITE("EGA 3D Tests")
         // fmt::println("");
     }
 
+    TEST_CASE("Vec3d: operations - rotations on spans (caller-owned storage)")
+    {
+        fmt::println("Vec3d: operations - rotations on spans (caller-owned storage)");
+
+        auto const R = get_rotor(bivec3d{1.0, -2.0, 0.5}, deg2rad(40.0));
+        std::vector<Vec3d<double>> vs;
+        std::vector<BiVec3d<double>> bs;
+        for (int i = 0; i < 20; ++i) {
+            vs.push_back(vec3d(std::cos(i), 0.1 * i, std::sin(2.0 * i)));
+            bs.push_back(bivec3d(0.3 * i, std::sin(i), -1.0));
+        }
+        auto const vs_ref = rotate_opt(vs, R);
+        auto const bs_ref = rotate_opt(bs, R);
+
+        // out-parameter form writes into an existing buffer
+        std::vector<Vec3d<double>> vs_out(vs.size());
+        std::vector<BiVec3d<double>> bs_out(bs.size());
+        rotate_opt(vs, R, std::span(vs_out));
+        rotate_opt(bs, R, std::span(bs_out));
+
+        // in-place form
+        rotate_inplace(std::span(vs), R);
+        rotate_inplace(std::span(bs), R);
+        for (size_t i = 0; i < vs.size(); ++i) {
+            CHECK(vs_out[i] == vs_ref[i]);
+            CHECK(bs_out[i] == bs_ref[i]);
+            CHECK(vs[i] == vs_ref[i]);
+            CHECK(bs[i] == bs_ref[i]);
+        }
+
+        CHECK_THROWS_AS(rotate_opt(vs, R, std::span(vs_out).first(3)),
+                        std::invalid_argument);
+
+        // precomputed transform object: rotation matrices built once, composable
+        auto const xf = get_xform(R);
+        auto const R2 = get_rotor(e12_3d, deg2rad(25.0));
+        CHECK(xf(vs_ref[0]) == rotate_opt(vs_ref[0], R));
+        CHECK(xf(bs_ref[0]) == rotate_opt(bs_ref[0], R));
+        CHECK((get_xform(R2) * xf)(vs_ref[1]) ==
+              rotate_opt(rotate_opt(vs_ref[1], R), R2));
+        xf.apply_inplace(vs_out);
+        CHECK(vs_out[5] == rotate_opt(vs_ref[5], R));
+    }
+
     TEST_CASE("Vec3d: operations - simple rotation")
     {
         fmt::println("Vec3d: operations - simple rotation");
@@ -3,7 +3,8 @@
 
 // Standalone test/benchmark target for the ODE integrators (ga/ga_usr_utilities.hpp):
 // RK4 (canonical 4th-order) vs ABM2 (Adams-Bashforth-Moulton 2nd-order
-// predictor-corrector).
+// predictor-corrector), plus the adaptive DP54 (Dormand-Prince 5(4)) with dense output
+// and event location, and the implicit L-stable SDIRK3 for stiff problems.
 //
 // This is a NORMAL doctest executable -- it respects CMAKE_BUILD_TYPE, so the timing
 // cases are meaningful in Debug AND Release (unlike the forced-O3 benchmarks in
@@ -22,6 +23,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <numbers>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -32,7 +34,9 @@
 
 using hd::ga::abm2_adaptive_integrator;
 using hd::ga::abm2_integrator;
+using hd::ga::dp54_integrator;
 using hd::ga::rk4_integrator;
+using hd::ga::sdirk3_integrator;
 
 // ---------------------------------------------------------------------------------
 // Reference problem: the damped harmonic oscillator  m x'' + c x' + k x = 0,
@@ -363,3 +367,264 @@ TEST_SUITE("integrators: ABM2 adaptive (variable dt)")
     }
 
 } // TEST_SUITE("integrators: ABM2 adaptive (variable dt)")
+
+// =================================================================================
+// Adaptive Dormand-Prince 5(4) with dense output + event location.
+//
+// (1) the fixed-step form is 5th order; (2) under error control it reaches a given
+// accuracy on the damped oscillator in an order of magnitude fewer rhs evaluations than
+// fixed-dt RK4; (3) the dense output is as accurate as the steps themselves, so
+// uniformly spaced output no longer dictates the step; (4) zero crossings are located
+// on the dense output to ~roundoff in t.
+// =================================================================================
+TEST_SUITE("integrators: DP54 adaptive (dense output + events)")
+{
+
+    TEST_CASE("DP54: convergence order (fixed dt) ~ 5th")
+    {
+        fmt::println("");
+        fmt::println("integrators: DP54 convergence order (error ratio on dt halving)");
+        fmt::println("");
+
+        oscillator const osc{1.0, 100.0, 1.0};
+        double const x0 = 1.0, T = 2.0;
+        double prev = 0.0;
+        for (double dt : {8.0e-3, 4.0e-3, 2.0e-3}) {
+            dp54_integrator dp(2);
+            auto const [err, xf] = run(osc, dp, dt, T, x0);
+            if (prev > 0.0) {
+                double const order = std::log2(prev / err);
+                fmt::println("  dt = {:.0e}: max err = {:.3e}, observed order = {:.2f}",
+                             dt, err, order);
+                CHECK(order > 4.5);
+            }
+            else fmt::println("  dt = {:.0e}: max err = {:.3e}", dt, err);
+            prev = err;
+        }
+        fmt::println("");
+    }
+
+    TEST_CASE("DP54: error control + rhs evaluations vs fixed-dt RK4")
+    {
+        fmt::println("");
+        fmt::println("integrators: DP54 adaptive vs fixed RK4 (damped oscillator)");
+        fmt::println("");
+
+        oscillator const osc{1.0, 100.0, 1.0};
+        double const x0 = 1.0, T = 10.0;
+
+        dp54_integrator dp(2);
+        std::vector<double> u{x0, 0.0};
+        double t = 0.0, dt = 1.0e-3, maxerr = 0.0;
+        while (t < T - 1.0e-12) {
+            double dt_io = std::min(dt, T - t);
+            t = dp.step(osc, u, t, dt_io, 1.0e-10, 1.0e-8);
+            dt = dt_io;
+            maxerr = std::max(maxerr, std::abs(u[0] - osc.x_exact(t, x0)));
+        }
+        size_t const evals_dp = dp.rhs_evals();
+
+        // the FSAL stage makes an accepted step cost 6 evaluations (+1 to start, +6 per
+        // rejected attempt)
+        CHECK(evals_dp == 1 + 6 * (dp.accepted() + dp.rejected()));
+
+        // fixed-dt RK4 at the smallest dt (doubling) that matches the adaptive accuracy
+        size_t N = 64;
+        while (N < (1u << 22)) {
+            rk4_integrator rk(2);
+            if (run(osc, rk, T / double(N), T, x0).first <= maxerr) break;
+            N *= 2;
+        }
+        size_t const evals_rk = 4 * N;
+
+        fmt::println("  DP54: max err = {:.2e}, {} steps (+{} rej), {} rhs evals", maxerr,
+                     dp.accepted(), dp.rejected(), evals_dp);
+        fmt::println("  RK4 : {} steps for the same accuracy, {} rhs evals", N, evals_rk);
+        CHECK(maxerr < 1.0e-6);
+        CHECK(double(evals_rk) / double(evals_dp) > 4.0);
+        fmt::println("");
+    }
+
+    TEST_CASE("DP54: dense output between steps")
+    {
+        fmt::println("");
+        fmt::println("integrators: DP54 dense output (uniform samples from large steps)");
+        fmt::println("");
+
+        oscillator const osc{1.0, 100.0, 1.0};
+        double const x0 = 1.0, T = 5.0, dt_out = 1.0e-3;
+
+        dp54_integrator dp(2);
+        std::vector<double> u{x0, 0.0};
+        double dt = 1.0e-3, maxerr = 0.0, t_last = -1.0, max_gap = 0.0;
+        size_t n_out = 0;
+        double const t_end = dp.integrate_dense(
+            osc, u, 0.0, T, dt, 1.0e-10, 1.0e-8, dt_out,
+            [&](double t, std::vector<double> const& y) {
+                if (t_last >= 0.0) max_gap = std::max(max_gap, t - t_last);
+                t_last = t;
+                ++n_out;
+                maxerr = std::max(maxerr, std::abs(y[0] - osc.x_exact(t, x0)));
+            });
+
+        fmt::println("  {} samples from {} steps, max err = {:.2e}", n_out, dp.accepted(),
+                     maxerr);
+        CHECK(t_end == doctest::Approx(T));
+        CHECK(n_out == size_t(T / dt_out + 0.5) + 1); // t0, t0 + dt_out, ..., T
+        CHECK(max_gap < dt_out * (1.0 + 1.0e-9));
+        CHECK(dp.accepted() * 5 < n_out); // the steps are far larger than the spacing
+        CHECK(maxerr < 1.0e-6);           // interpolant ~ as accurate as the steps
+
+        // the interpolant reproduces both ends of the last step exactly
+        std::vector<double> y;
+        dp.dense(dp.t_curr(), y);
+        CHECK(y[0] == doctest::Approx(u[0]).epsilon(1.0e-12));
+        CHECK(dp.t_curr() == doctest::Approx(T));
+        fmt::println("");
+    }
+
+    TEST_CASE("DP54: zero-crossing event location")
+    {
+        fmt::println("");
+        fmt::println("integrators: DP54 event location");
+        fmt::println("");
+
+        // (a) undamped oscillator x'' = -wn^2 x, x(0) = 1: first zero of x at pi/(2 wn)
+        oscillator const osc{1.0, 100.0, 0.0};
+        dp54_integrator dp(2);
+        std::vector<double> u{1.0, 0.0};
+        double dt = 1.0e-3;
+        auto const ev = dp.integrate_to_event(
+            osc, [](double, std::vector<double> const& y) { return y[0]; }, u, 0.0, 1.0,
+            dt, 1.0e-12, 1.0e-10);
+        double const t_zero = 0.5 * std::numbers::pi / osc.wn();
+        fmt::println("  oscillator: t_event = {:.15f} (exact {:.15f}), x = {:.2e}", ev.t,
+                     t_zero, u[0]);
+        CHECK(ev.found);
+        CHECK(std::abs(ev.t - t_zero) < 1.0e-9);
+        CHECK(std::abs(u[0]) < 1.0e-9);
+        CHECK(u[1] == doctest::Approx(-osc.wn()).epsilon(1.0e-8)); // v = -wn at the zero
+
+        // (b) falling ball y'' = -g from y0 = 2: impact y = 0 at sqrt(2 y0 / g); the
+        // bounce (v -> -e v) restarts from the located state, twice. Free fall is a
+        // quadratic, integrated exactly, so the controller would grow the step without
+        // bound -- dt_max keeps it below the flight time (events are seen per step).
+        double const g = 9.81, e = 0.8, y0 = 2.0;
+        auto fall = [g](double, std::vector<double> const& y, std::vector<double>& dy) {
+            dy[0] = y[1];
+            dy[1] = -g;
+        };
+        auto ground = [](double, std::vector<double> const& y) { return y[0]; };
+        dp54_integrator ball(2, 1.0e-12, 0.1);
+        std::vector<double> s{y0, 0.0};
+        double t = 0.0, h = 1.0e-2, v_impact = std::sqrt(2.0 * g * y0),
+               t_exact = std::sqrt(2.0 * y0 / g);
+        for (int bounce = 0; bounce < 3; ++bounce) {
+            auto const hit = ball.integrate_to_event(fall, ground, s, t, 10.0, h, 1.0e-12,
+                                                     1.0e-10);
+            fmt::println("  bounce {}: t = {:.12f} (exact {:.12f}), v = {:.9f}", bounce,
+                         hit.t, t_exact, s[1]);
+            CHECK(hit.found);
+            CHECK(std::abs(hit.t - t_exact) < 1.0e-9);
+            CHECK(s[1] == doctest::Approx(-v_impact).epsilon(1.0e-9));
+            t = hit.t;
+            s[0] = 0.0;
+            s[1] = -e * s[1]; // rebound; the next crossing is 2 v / g later
+            v_impact *= e;
+            t_exact += 2.0 * v_impact / g;
+        }
+
+        // no sign change within the horizon -> not found, state at t_end
+        dp54_integrator none(2);
+        std::vector<double> w{1.0, 0.0};
+        double hn = 1.0e-3;
+        auto const miss = none.integrate_to_event(
+            osc, [](double, std::vector<double> const& y) { return y[0] + 2.0; }, w, 0.0,
+            0.5, hn, 1.0e-10, 1.0e-8);
+        CHECK(!miss.found);
+        CHECK(miss.t == doctest::Approx(0.5));
+        fmt::println("");
+    }
+
+} // TEST_SUITE("integrators: DP54 adaptive (dense output + events)")
+
+// =================================================================================
+// Implicit L-stable SDIRK3 for STIFF problems.
+//
+// (1) on a non-stiff problem it is simply a 3rd-order method; (2) on the stiff
+// Prothero-Robinson problem y' = lambda (y - phi(t)) + phi'(t), lambda = -1e7, it runs
+// at a step 4 orders of magnitude beyond the explicit stability limit (where RK4 blows
+// up) and tracks the smooth solution y = phi(t); the linear problem has a constant
+// Jacobian, so J and its LU are built once and reused by every step.
+// =================================================================================
+TEST_SUITE("integrators: SDIRK3 implicit (stiff)")
+{
+
+    TEST_CASE("SDIRK3: convergence order (non-stiff) ~ 3rd")
+    {
+        fmt::println("");
+        fmt::println("integrators: SDIRK3 convergence order (error ratio on dt halving)");
+        fmt::println("");
+
+        oscillator const osc{1.0, 100.0, 1.0};
+        double const x0 = 1.0, T = 2.0;
+        double prev = 0.0;
+        for (double dt : {4.0e-3, 2.0e-3, 1.0e-3}) {
+            sdirk3_integrator sd(2, 1.0e-14, 1.0e-13); // Newton error << truncation error
+            auto const [err, xf] = run(osc, sd, dt, T, x0);
+            if (prev > 0.0) {
+                double const order = std::log2(prev / err);
+                fmt::println("  dt = {:.0e}: max err = {:.3e}, observed order = {:.2f}",
+                             dt, err, order);
+                CHECK(order > 2.7);
+                CHECK(order < 3.3);
+            }
+            else fmt::println("  dt = {:.0e}: max err = {:.3e}", dt, err);
+            prev = err;
+        }
+        fmt::println("");
+    }
+
+    TEST_CASE("SDIRK3: stiff Prothero-Robinson problem at a large dt")
+    {
+        fmt::println("");
+        fmt::println("integrators: SDIRK3 vs RK4 on a stiff problem (lambda = -1e7)");
+        fmt::println("");
+
+        double const lambda = -1.0e7, dt = 1.0e-3, T = 2.0;
+        auto pr = [lambda](double t, std::vector<double> const& u,
+                           std::vector<double>& du) {
+            du[0] = lambda * (u[0] - std::sin(t)) + std::cos(t);
+        };
+        size_t const N = size_t(T / dt + 0.5);
+
+        sdirk3_integrator sd(1);
+        std::vector<double> u{0.0};
+        double t = 0.0, maxerr = 0.0;
+        for (size_t i = 0; i < N; ++i) {
+            t = sd.step(pr, u, t, dt);
+            maxerr = std::max(maxerr, std::abs(u[0] - std::sin(t)));
+        }
+
+        rk4_integrator rk(1);
+        std::vector<double> v{0.0};
+        double tr = 0.0;
+        for (size_t i = 0; i < 20 && std::abs(v[0]) < 1.0e100; ++i)
+            tr = rk.step(pr, v, tr, dt);
+
+        fmt::println("  SDIRK3: dt = {:.0e} (|lambda| dt = {:.0e}), max err = {:.2e}", dt,
+                     -lambda * dt, maxerr);
+        fmt::println("          {} steps, {} rhs evals, {} Jacobian(s), {} LU, {} Newton "
+                     "its",
+                     sd.steps(), sd.rhs_evals(), sd.jacobians(), sd.factorizations(),
+                     sd.newton_iterations());
+        fmt::println("  RK4   : |y| = {:.2e} after {:.0e} s (unstable)", std::abs(v[0]),
+                     tr);
+        CHECK(maxerr < 1.0e-6);       // follows the smooth solution, no stiff transient
+        CHECK(sd.jacobians() == 1);   // linear problem: J never goes stale ...
+        CHECK(sd.factorizations() == 1); // ... and neither does its LU at constant dt
+        CHECK(!(std::abs(v[0]) < 1.0e3)); // the explicit method at the same dt diverges
+        fmt::println("");
+    }
+
+} // TEST_SUITE("integrators: SDIRK3 implicit (stiff)")
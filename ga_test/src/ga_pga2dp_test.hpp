@@ -981,6 +981,51 @@ TEST_SUITE("PGA 2DP Tests")
         fmt::println("");
     }
 
+    TEST_CASE("Vec2dp: batch moves on SoA containers (vec2dp_soa, bivec2dp_soa)")
+    {
+        fmt::println("Vec2dp: batch moves on SoA containers");
+
+        // 201 elements: 3 full kernel blocks of 64 plus a tail of 9
+        size_t const n = 201;
+        std::vector<vec2dp> vp;
+        std::vector<bivec2dp> vl;
+        for (size_t i = 0; i < n; ++i) {
+            value_t const s = static_cast<value_t>(i);
+            vp.push_back(vec2dp{std::sin(s), std::cos(0.7 * s), 1.0});
+            vl.push_back(wdg(vp.back(), vec2dp{std::cos(s), std::sin(s), 0.0}));
+        }
+
+        vec2dp_soa sp(vp);
+        CHECK(sp.size() == n);
+        CHECK(sp.to_vector() == vp);
+
+        auto const M = rgpr(get_motor(vec2dp{-2, 1, 0}),
+                            get_motor(vec2dp{1, 0.5, 1}, deg2rad(15)));
+
+        // same results as the AoS batch overloads (to rounding)
+        auto const rp = move2dp(vp, M);
+        auto const rl = move2dp(vl, M);
+        vec2dp_soa op;
+        bivec2dp_soa ol;
+        move2dp(sp, M, op);
+        move2dp(bivec2dp_soa(vl), M, ol);
+        REQUIRE(op.size() == n);
+        REQUIRE(ol.size() == n);
+
+        auto ip = sp;
+        move2dp_inplace(ip, M);
+        auto il = bivec2dp_soa(vl);
+        move2dp_inplace(il, M);
+        for (size_t i = 0; i < n; ++i) {
+            CHECK(op[i] == rp[i]);
+            CHECK(ol[i] == rl[i]);
+            CHECK(ip[i] == op[i]);
+            CHECK(il[i] == ol[i]);
+        }
+
+        fmt::println("");
+    }
+
     TEST_CASE("Vec2dp: modeling force & torque = forque")
     {
 
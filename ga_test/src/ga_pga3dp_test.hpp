@@ -4,6 +4,7 @@
 #include "doctest/doctest.h"
 
 #include <chrono>
+#include <cstdint> // std::uintptr_t
 #include <iostream>
 #include <tuple>
 #include <vector>
@@ -15,6 +16,7 @@
 
 // include functions to be tested
 #include "ga/ga_pga.hpp"
+#include "ga_simd_test_helpers.hpp" // simd_test::check_product (SIMD backend tests)
 
 #include "ga/ga_ega.hpp" // for hd::ga::ega::cmpl() and hd::ga::ega::dot()
 
@@ -1369,6 +1371,195 @@ TEST_SUITE("PGA 3DP Tests")
         fmt::println("");
     }
 
+    TEST_CASE("Vec3dp: batch moves on SoA containers (vec3dp_soa, bivec3dp_soa, ...)")
+    {
+        fmt::println("Vec3dp: batch moves on SoA containers");
+
+        // 1003 elements: 15 full kernel blocks of 64 plus a tail of 43
+        size_t const n = 1003;
+        std::vector<vec3dp> vp;
+        std::vector<bivec3dp> vl;
+        std::vector<trivec3dp> vt;
+        for (size_t i = 0; i < n; ++i) {
+            value_t const s = static_cast<value_t>(i);
+            vp.push_back(vec3dp{std::sin(s), std::cos(0.7 * s), std::sin(1.3 * s), 1.0});
+            vl.push_back(wdg(vp.back(), vec3dp{std::cos(s), 0.5, std::sin(s), 0.0}));
+            vt.push_back(wdg(vl.back(), vec3dp{0.2, std::cos(2.1 * s), -0.4, 1.0}));
+        }
+
+        // layout: one aligned array per component, round trip to AoS is lossless
+        vec3dp_soa sp(vp);
+        CHECK(sp.size() == n);
+        CHECK(sp.capacity() >= n);
+        for (size_t k = 0; k < vec3dp_soa::ncomp; ++k) {
+            CHECK(reinterpret_cast<std::uintptr_t>(sp.data(k)) % soa_alignment == 0);
+        }
+        CHECK(sp[17].y == vp[17].y);
+        CHECK(sp.component(3)[500] == vp[500].w);
+        CHECK(sp.to_vector() == vp);
+
+        auto const M = rgpr(get_motor(vec3dp{-2, 1, 1, 0}),
+                            get_motor(e42_3dp + 0.5 * e43_3dp, deg2rad(15)));
+
+        // same results as the AoS batch overloads (to rounding)
+        auto const rp = move3dp(vp, M);
+        auto const rl = move3dp(vl, M);
+        auto const rt = move3dp(vt, M);
+        vec3dp_soa op;
+        bivec3dp_soa ol;
+        trivec3dp_soa ot;
+        move3dp(sp, M, op);
+        move3dp(bivec3dp_soa(vl), M, ol);
+        move3dp(trivec3dp_soa(vt), M, ot);
+        REQUIRE(op.size() == n);
+        REQUIRE(ol.size() == n);
+        REQUIRE(ot.size() == n);
+        for (size_t i = 0; i < n; ++i) {
+            CHECK(op[i] == rp[i]);
+            CHECK(ol[i] == rl[i]);
+            CHECK(ot[i] == rt[i]);
+        }
+
+        // in place, and out == in, give the same as the out-parameter form
+        auto ip = sp;
+        move3dp_inplace(ip, M);
+        auto jp = sp;
+        move3dp(jp, M, jp);
+        auto il = bivec3dp_soa(vl);
+        move3dp_inplace(il, M);
+        auto it = trivec3dp_soa(vt);
+        move3dp_inplace(it, M);
+        for (size_t i = 0; i < n; ++i) {
+            CHECK(ip[i] == op[i]);
+            CHECK(jp[i] == op[i]);
+            CHECK(il[i] == ol[i]);
+            CHECK(it[i] == ot[i]);
+        }
+
+        // growth keeps the contents; the out container is reused
+        vec3dp_soa gp;
+        for (auto const& p : vp) {
+            gp.push_back(p);
+        }
+        CHECK(gp.to_vector() == vp);
+        gp.resize(10);
+        move3dp(gp, M, op);
+        CHECK(op.size() == 10);
+        CHECK(op[9] == rp[9]);
+
+        fmt::println("");
+    }
+
+    TEST_CASE("Vec3dp: batch moves on spans (caller-owned storage, in place)")
+    {
+        fmt::println("Vec3dp: batch moves on spans");
+
+        size_t const n = 37;
+        std::vector<vec3dp> vp;
+        std::vector<bivec3dp> vl;
+        std::vector<trivec3dp> vt;
+        for (size_t i = 0; i < n; ++i) {
+            value_t const s = static_cast<value_t>(i);
+            vp.push_back(vec3dp{std::sin(s), std::cos(0.7 * s), std::sin(1.3 * s), 1.0});
+            vl.push_back(wdg(vp.back(), vec3dp{std::cos(s), 0.5, std::sin(s), 0.0}));
+            vt.push_back(wdg(vl.back(), vec3dp{0.2, std::cos(2.1 * s), -0.4, 1.0}));
+        }
+        auto const M = rgpr(get_motor(vec3dp{-2, 1, 1, 0}),
+                            get_motor(e42_3dp + 0.5 * e43_3dp, deg2rad(15)));
+        auto const rp = move3dp(vp, M);
+        auto const rl = move3dp(vl, M);
+        auto const rt = move3dp(vt, M);
+
+        // out-parameter form: the output buffer is owned (and reused) by the caller
+        std::vector<vec3dp> op(n);
+        std::vector<bivec3dp> ol(n);
+        std::vector<trivec3dp> ot(n);
+        move3dp(vp, M, std::span(op));
+        move3dp(vl, M, std::span(ol));
+        move3dp(vt, M, std::span(ot));
+        for (size_t i = 0; i < n; ++i) {
+            CHECK(op[i] == rp[i]);
+            CHECK(ol[i] == rl[i]);
+            CHECK(ot[i] == rt[i]);
+        }
+
+        // in place, also on a sub-range of a larger buffer
+        auto ip = vp;
+        move3dp_inplace(std::span(ip), M);
+        auto il = vl;
+        move3dp_inplace(std::span(il).subspan(5, 10), M);
+        auto it = vt;
+        move3dp_inplace(std::span(it), M);
+        for (size_t i = 0; i < n; ++i) {
+            CHECK(ip[i] == rp[i]);
+            CHECK(il[i] == ((i >= 5 && i < 15) ? rl[i] : vl[i]));
+            CHECK(it[i] == rt[i]);
+        }
+
+        // sizes of in and out must match
+        CHECK_THROWS_AS(move3dp(vp, M, std::span(op).first(n - 1)),
+                        std::invalid_argument);
+
+        fmt::println("");
+    }
+
+    TEST_CASE("Vec3dp: precomputed motor transform (xform3dp)")
+    {
+        fmt::println("Vec3dp: precomputed motor transform (xform3dp)");
+
+        auto const M1 = get_motor(vec3dp{-2, 1, 1, 0});
+        auto const M2 = get_motor(e42_3dp + 0.5 * e43_3dp, deg2rad(15));
+        auto const xf1 = get_xform(M1);
+        auto const xf2 = get_xform(M2);
+
+        // a plain value type: cheap to copy and to cache per frame
+        static_assert(std::is_trivially_copyable_v<xform3dp>);
+
+        // single elements: same result as move3dp_opt on every grade
+        vec3dp const p{0.3, -0.2, 1.1, 1.0};
+        bivec3dp const l = wdg(p, vec3dp{1.0, 0.5, -0.7, 0.0});
+        trivec3dp const pl = wdg(l, vec3dp{-0.4, 2.0, 0.1, 1.0});
+        CHECK(xf1(p) == move3dp_opt(p, M1));
+        CHECK(xf1(l) == move3dp_opt(l, M1));
+        CHECK(xf1(pl) == move3dp_opt(pl, M1));
+
+        // default constructed: identity on all grades
+        xform3dp const id;
+        CHECK(id(p) == p);
+        CHECK(id(l) == l);
+        CHECK(id(pl) == pl);
+
+        // composition: (xf2 * xf1)(x) == xf2(xf1(x)), i.e. first M1, then M2
+        auto const xf21 = xf2 * xf1;
+        CHECK(xf21(p) == move3dp_opt(move3dp_opt(p, M1), M2));
+        CHECK(xf21(l) == move3dp_opt(move3dp_opt(l, M1), M2));
+        CHECK(xf21(pl) == move3dp_opt(move3dp_opt(pl, M1), M2));
+        CHECK(xf21(p) == get_xform(rgpr(M2, M1))(p));
+
+        // batches: std::vector / std::span and SoA containers, also in place
+        std::vector<vec3dp> vp;
+        for (size_t i = 0; i < 70; ++i) {
+            value_t const s = static_cast<value_t>(i);
+            vp.push_back(vec3dp{std::sin(s), std::cos(0.7 * s), 0.1 * s, 1.0});
+        }
+        auto const rp = move3dp(vp, M2);
+        std::vector<vec3dp> op(vp.size());
+        xf2(vp, op);
+        vec3dp_soa sp(vp), sq;
+        xf2(sp, sq);
+        auto ip = vp;
+        xf2.apply_inplace(ip);
+        xf2.apply_inplace(sp);
+        for (size_t i = 0; i < vp.size(); ++i) {
+            CHECK(op[i] == rp[i]);
+            CHECK(sq[i] == rp[i]);
+            CHECK(ip[i] == rp[i]);
+            CHECK(sp[i] == rp[i]);
+        }
+
+        fmt::println("");
+    }
+
     ////////////////////////////////////////////////////////////////////////////////
     // MVec3dp<T> basic test cases
     ////////////////////////////////////////////////////////////////////////////////
@@ -5258,6 +5449,33 @@ TEST_SUITE("PGA 3DP Tests")
         CHECK(rexp(arg1 + arg2) == get_motor(e1_3dp * dist));
     }
 
+    TEST_CASE("MVec3dp: SIMD backend for the full multivector products")
+    {
+        fmt::println("MVec3dp: SIMD backend for the full multivector products");
+
+        // each SIMD product against its scalar reference (see ga_simd_test_helpers.hpp)
+        simd_test::check_product<MVec3dp>(
+            [](auto const& A, auto const& B) { return gpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return A * B; });
+        simd_test::check_product<MVec3dp>(
+            [](auto const& A, auto const& B) { return wdg_simd(A, B); },
+            [](auto const& A, auto const& B) { return wdg(A, B); });
+        simd_test::check_product<MVec3dp>(
+            [](auto const& A, auto const& B) { return rwdg_simd(A, B); },
+            [](auto const& A, auto const& B) { return rwdg(A, B); });
+        simd_test::check_product<MVec3dp>(
+            [](auto const& A, auto const& B) { return rgpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return rgpr(A, B); });
+
+        // integral value types are exact on both paths
+        simd_test::check_product_exact<MVec3dp>(
+            [](auto const& A, auto const& B) { return gpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return A * B; });
+        simd_test::check_product_exact<MVec3dp>(
+            [](auto const& A, auto const& B) { return rgpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return rgpr(A, B); });
+    }
+
 
 } // PGA 3DP Tests
 
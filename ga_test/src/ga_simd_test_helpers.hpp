@@ -0,0 +1,99 @@
+#pragma once
+
+// Copyright 2024-2026, Daniel Hug. All rights reserved.
+// Licensed under the terms specified in LICENSE.txt file.
+
+// Shared checks for the SIMD backend of the full multivector products (*_simd() in
+// ga_pga3dp_ops_simd.hpp, ga_sta4ds_ops_simd.hpp and ga_cga3dc_ops_simd.hpp), used by
+// the test cases of the pga3dp, sta4ds and cga3dc test files.
+
+#include "doctest/doctest.h"
+
+#include <algorithm> // std::max
+#include <array>
+#include <bit>   // std::bit_cast
+#include <cmath> // std::abs, std::sin, std::cos
+#include <cstddef>
+
+namespace simd_test {
+
+// number of components of the multivector template MV (MVec16_t / MVec32_t)
+template <template <typename> class MV>
+inline constexpr size_t ncomp = sizeof(MV<double>) / sizeof(double);
+
+// multivector with the single component c_n = 1 (a basis blade in component order)
+template <template <typename> class MV, typename T = double> MV<T> blade(size_t n)
+{
+    std::array<T, ncomp<MV>> c{};
+    c[n] = T(1);
+    return std::bit_cast<MV<T>>(c);
+}
+
+// deterministic general multivector with all components populated
+template <template <typename> class MV, typename T = double>
+MV<T> general(double f, double p)
+{
+    std::array<T, ncomp<MV>> c{};
+    for (size_t n = 0; n < ncomp<MV>; ++n) {
+        c[n] = T(std::sin(f * double(n) + p));
+    }
+    return std::bit_cast<MV<T>>(c);
+}
+
+// largest component difference of two multivectors of the same value type
+template <typename MVT> double dist(MVT const& X, MVT const& Y)
+{
+    using T = decltype(X.c0);
+    constexpr size_t N = sizeof(MVT) / sizeof(T);
+    auto const x = std::bit_cast<std::array<T, N>>(X);
+    auto const y = std::bit_cast<std::array<T, N>>(Y);
+    double d = 0.0;
+    for (size_t n = 0; n < N; ++n) {
+        d = std::max(d, std::abs(double(x[n]) - double(y[n])));
+    }
+    return d;
+}
+
+// Check simd(A, B) against the scalar reference ref(A, B): on every pair of basis
+// blades (the products are bilinear, so this covers all arguments up to rounding;
+// the SIMD path sums the terms in a different order) and on general double, float,
+// long double (one-lane fallback) and mixed-type multivectors.
+template <template <typename> class MV, typename F, typename G>
+void check_product(F&& simd, G&& ref)
+{
+    for (size_t i = 0; i < ncomp<MV>; ++i) {
+        for (size_t j = 0; j < ncomp<MV>; ++j) {
+            auto const A = blade<MV>(i);
+            auto const B = blade<MV>(j);
+            CHECK(dist(simd(A, B), ref(A, B)) < 1.0e-15);
+        }
+    }
+    auto const A = general<MV>(1.3, 0.2);
+    auto const B = general<MV>(0.7, 0.5);
+    auto const Af = general<MV, float>(1.3, 0.2);
+    auto const Bf = general<MV, float>(0.7, 0.5);
+    CHECK(dist(simd(A, B), ref(A, B)) < 1.0e-12);
+    CHECK(dist(simd(Af, Bf), ref(Af, Bf)) < 1.0e-4);
+    CHECK(dist(simd(Af, B), ref(Af, B)) < 1.0e-12);
+    auto const Al = general<MV, long double>(1.3, 0.2);
+    auto const Bl = general<MV, long double>(0.7, 0.5);
+    CHECK(dist(simd(Al, Bl), ref(Al, Bl)) < 1.0e-12);
+}
+
+// integral value types: all terms are exact, so SIMD and scalar results must agree
+// exactly (pga3dp, sta4ds; the cga3dc overloads reject integral types)
+template <template <typename> class MV, typename F, typename G>
+void check_product_exact(F&& simd, G&& ref)
+{
+    std::array<int, ncomp<MV>> a{};
+    std::array<int, ncomp<MV>> b{};
+    for (size_t n = 0; n < ncomp<MV>; ++n) {
+        a[n] = int(n * 7 % 5) - 2;
+        b[n] = int(n * 3 % 7) - 3;
+    }
+    auto const A = std::bit_cast<MV<int>>(a);
+    auto const B = std::bit_cast<MV<int>>(b);
+    CHECK(dist(simd(A, B), ref(A, B)) == 0.0);
+}
+
+} // namespace simd_test
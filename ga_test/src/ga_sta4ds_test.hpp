@@ -19,6 +19,7 @@
 
 // include functions to be tested
 #include "ga/ga_sta.hpp"
+#include "ga_simd_test_helpers.hpp" // simd_test::check_product (SIMD backend tests)
 
 using namespace hd::ga;      // use ga types, constants, etc.
 using namespace hd::ga::sta; // use specific operations of STA (Space-Time Algebra)
@@ -745,6 +746,51 @@ TEST_SUITE("STA 3D Tests")
                      "(vec/bivec/trivec, scalar + batch)");
     }
 
+    TEST_CASE("G<1,3,0>: transform_opt() on spans and precomputed transform (xform4ds)")
+    {
+        fmt::println("G<1,3,0>: transform_opt() on spans and precomputed transform");
+
+        auto const Rr = get_rotor(g12_4ds, 0.6);
+        auto const Rb = get_boost(g14_4ds, 0.5);
+        auto const Rgen = Rb * Rr; // mixes boost + rotation -> all c0..c7 populated
+
+        vec4ds x{2.0, 3.0, 5.0, 7.0};
+        bivec4ds Bgen{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        trivec4ds Tgen{1.0, 2.0, 3.0, 4.0};
+        std::vector<vec4ds> vs{x, g1_4ds, g4_4ds};
+        std::vector<bivec4ds> Bs{Bgen, g14_4ds, g23_4ds};
+        std::vector<trivec4ds> Ts{Tgen, g123_4ds};
+        auto const vo = transform_opt(vs, Rgen); // allocating batch as the reference
+        auto const Bo = transform_opt(Bs, Rgen);
+        auto const To = transform_opt(Ts, Rgen);
+
+        // span overloads: caller-owned output buffer, or in place
+        std::vector<vec4ds> vs_out(vs.size());
+        transform_opt(vs, Rgen, std::span(vs_out));
+        transform_inplace(std::span(Bs), Rgen);
+        transform_inplace(std::span(Ts), Rgen);
+        for (size_t i = 0; i < vs.size(); ++i) {
+            CHECK(is_close(vs_out[i], vo[i]));
+            CHECK(is_close(Bs[i], Bo[i]));
+        }
+        CHECK(is_close(Ts[0], To[0]));
+        CHECK(is_close(Ts[1], To[1]));
+        CHECK_THROWS_AS(transform_opt(vs, Rgen, std::span(vs_out).first(2)),
+                        std::invalid_argument);
+
+        // precomputed transform object: the same matrices, built once per rotor;
+        // composition (xf2 * xf1)(x) == xf2(xf1(x))
+        auto const xf = get_xform(Rgen);
+        CHECK(is_close(xf(x), transform_opt(x, Rgen)));
+        CHECK(is_close(xf(Bgen), transform_opt(Bgen, Rgen)));
+        CHECK(is_close(xf(Tgen), transform_opt(Tgen, Rgen)));
+        CHECK(is_close((get_xform(Rr) * get_xform(Rb))(x),
+                       transform(transform(x, Rb), Rr)));
+
+        fmt::println("transform_opt: span == batch (vec/bivec/trivec, in place); "
+                     "get_xform == transform_opt, composes");
+    }
+
     ////////////////////////////////////////////////////////////////////////////////
     // ops.hpp step 3: spacetime split of a vector (time + relative space)
     ////////////////////////////////////////////////////////////////////////////////
@@ -2254,4 +2300,28 @@ TEST_SUITE("STA 3D Tests")
         fmt::println("");
     }
 
+    TEST_CASE("MVec4ds: SIMD backend for the full multivector products")
+    {
+        fmt::println("MVec4ds: SIMD backend for the full multivector products");
+
+        // each SIMD product against its scalar reference (see ga_simd_test_helpers.hpp)
+        simd_test::check_product<MVec4ds>(
+            [](auto const& A, auto const& B) { return gpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return A * B; });
+        simd_test::check_product<MVec4ds>(
+            [](auto const& A, auto const& B) { return wdg_simd(A, B); },
+            [](auto const& A, auto const& B) { return wdg(A, B); });
+        simd_test::check_product<MVec4ds>(
+            [](auto const& A, auto const& B) { return rwdg_simd(A, B); },
+            [](auto const& A, auto const& B) { return rwdg(A, B); });
+
+        // integral value types are exact on both paths
+        simd_test::check_product_exact<MVec4ds>(
+            [](auto const& A, auto const& B) { return gpr_simd(A, B); },
+            [](auto const& A, auto const& B) { return A * B; });
+        simd_test::check_product_exact<MVec4ds>(
+            [](auto const& A, auto const& B) { return rwdg_simd(A, B); },
+            [](auto const& A, auto const& B) { return rwdg(A, B); });
+    }
+
 } // STA 3D Tests
@@ -0,0 +1,137 @@
+// Benchmark: pga3dp inertia map --- the general dense 6x6 Inertia3dp vs the structured
+// PrincipalInertia3dp (mass + principal moments + optional cm offset).
+//
+// Standalone utility (ga + fmt, no doctest). NOT part of the test run; build and run
+// it on demand via the `ga_pga_bench_inertia` target. Compiled with -O3/NDEBUG
+// regardless of CMAKE_BUILD_TYPE (see ga_test/utilities/CMakeLists.txt).
+//
+// Three kernels are timed for a set of bodies (a distinct inertia per body, as in a
+// scene of many free bodies), each reporting ns/eval and the speedup relative to the
+// dense baseline:
+//   APPLY    --- I[Omega]           (twist -> momentum)
+//   INVERSE  --- I^-1[P]            (dense: the precomputed I_inv mat-vec)
+//   EULER    --- compute_omega_dot  (one of each: the free-body RK4 stage rhs)
+//
+// Takeaway (see ga/ga_pga3dp_ops_mechanics.hpp, PrincipalInertia3dp): the block form
+// needs about half the multiplies of the dense mat-vec and no stored 6x6 inverse.
+
+#include "ga/ga_pga.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace hd::ga;
+using namespace hd::ga::pga;
+
+namespace {
+
+struct Result {
+    std::string name;
+    double ns_per_eval;
+};
+
+// Print one kernel block: the per-method rows (ns/eval + speedup vs the first/baseline
+// row + a "fastest" marker).
+void report(char const* title, char const* subtitle, std::vector<Result> const& rows)
+{
+    double const base = rows.front().ns_per_eval; // row 0 is the dense baseline
+    double best = rows.front().ns_per_eval;
+    for (auto const& r : rows)
+        best = std::min(best, r.ns_per_eval);
+
+    std::printf("%s - %s\n", title, subtitle);
+    std::printf("  %-24s %9s  %8s   %s\n", "method", "ns/eval", "speedup", "note");
+    for (auto const& r : rows) {
+        std::printf("  %-24s %9.3f  %7.2fx   %s\n", r.name.c_str(), r.ns_per_eval,
+                    base / r.ns_per_eval, r.ns_per_eval == best ? "<- fastest" : "");
+    }
+    std::printf("\n");
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<value_t> dist(-1.0, 1.0);
+    std::uniform_real_distribution<value_t> pos(0.5, 2.0);
+
+    // a distinct body per slot: random mass / moments and a small cm offset
+    size_t const N = 4096;
+    std::vector<principal_inertia3dp> Ip;
+    std::vector<inertia3dp> I, I_inv;
+    std::vector<bivec3dp> Om;
+    Ip.reserve(N);
+    I.reserve(N);
+    I_inv.reserve(N);
+    Om.reserve(N);
+    for (size_t i = 0; i < N; ++i) {
+        Ip.push_back(get_principal_inertia(
+            pos(rng), pos(rng), pos(rng), pos(rng),
+            vec3dp{0.1 * dist(rng), 0.1 * dist(rng), 0.1 * dist(rng), 1.0}));
+        I.push_back(Ip.back().dense());
+        I_inv.push_back(get_inertia_inverse(I.back()));
+        Om.emplace_back(dist(rng), dist(rng), dist(rng), dist(rng), dist(rng),
+                        dist(rng));
+    }
+    bivec3dp const F{0.0, 0.0, -9.81, 0.0, 0.0, 0.0}; // a body-frame wrench
+
+    int const reps = 2000;
+    double checksum = 0.0; // accumulated so the timed work cannot be optimized away
+
+    // time fn(i) over all bodies, reps times; returns ns per evaluation
+    auto time_kernel = [&](auto&& fn) -> double {
+        auto const t0 = std::chrono::steady_clock::now();
+        value_t acc = 0.0;
+        for (int r = 0; r < reps; ++r)
+            for (size_t i = 0; i < N; ++i) {
+                auto const B = fn(i);
+                acc += B.vx + B.vy + B.vz + B.mx + B.my + B.mz;
+            }
+        auto const t1 = std::chrono::steady_clock::now();
+        checksum += acc;
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() /
+               (double(N) * reps);
+    };
+
+    auto dense_apply = [&](size_t i) { return I[i](Om[i]); };
+    auto struct_apply = [&](size_t i) { return Ip[i](Om[i]); };
+    auto dense_inv = [&](size_t i) { return I_inv[i](Om[i]); };
+    auto struct_inv = [&](size_t i) { return Ip[i].inverse(Om[i]); };
+    auto dense_euler = [&](size_t i) {
+        return compute_omega_dot(I_inv[i], F, Om[i], I[i]);
+    };
+    auto struct_euler = [&](size_t i) { return compute_omega_dot(Ip[i], F, Om[i]); };
+
+    // warmup pass (discarded) to settle caches / CPU frequency before measuring
+    (void)time_kernel(dense_euler);
+    (void)time_kernel(struct_euler);
+
+#ifdef NDEBUG
+    char const* mode = "-O3 / NDEBUG (optimized)";
+#else
+    char const* mode = "DEBUG build -- timings NOT meaningful, rebuild optimized";
+#endif
+
+    std::printf("pga3dp inertia benchmark   (N=%zu bodies x %d reps, %s, double)\n", N,
+                reps, mode);
+    std::printf("============================================================="
+                "==========\n\n");
+
+    report("APPLY  ", "I[Omega]",
+           {{"Inertia3dp (baseline)", time_kernel(dense_apply)},
+            {"PrincipalInertia3dp", time_kernel(struct_apply)}});
+    report("INVERSE", "I^-1[P]",
+           {{"Inertia3dp I_inv", time_kernel(dense_inv)},
+            {"PrincipalInertia3dp", time_kernel(struct_inv)}});
+    report("EULER  ", "compute_omega_dot",
+           {{"Inertia3dp (baseline)", time_kernel(dense_euler)},
+            {"PrincipalInertia3dp", time_kernel(struct_euler)}});
+
+    std::printf("(checksum %.3f -- ignore; prevents dead-code elimination)\n", checksum);
+    return 0;
+}